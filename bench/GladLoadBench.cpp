@@ -0,0 +1,113 @@
+#include "glad.h"
+
+#include "Util.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+/**
+ * @brief Time loading the GL entry points three ways: gladLoadGLLoader,
+ * which looks up every function of the versions the context reports,
+ * gladLoadGLLoaderUpTo capped at the 3.3 the executables ask for, and
+ * gladLoadGLLoaderLazy, which looks functions up on their first call. Each
+ * load is followed by the calls a typical first frame makes, since that is
+ * where the lazy lookups happen
+ *
+ * usage: gladloadbench [--headless] [runs]
+ */
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    long lookups = 0;
+    GLADloadproc context_loader = nullptr;
+
+    void* counting_loader(const char* name) {
+        lookups++;
+        return context_loader(name);
+    }
+
+    void first_frame() {
+        GLuint vao;
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        GLuint vbo;
+        glGenBuffers(1, &vbo);
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glViewport(0, 0, 64, 64);
+        glEnable(GL_DEPTH_TEST);
+        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        glBindVertexArray(0);
+        glDeleteBuffers(1, &vbo);
+        glDeleteVertexArrays(1, &vao);
+        glGetError();
+    }
+
+    struct Mode {
+        const char* name;
+        int (*load)();
+        std::chrono::nanoseconds load_time{0};
+        std::chrono::nanoseconds frame_time{0};
+        long lookups = 0;
+        bool failed = false;
+    };
+
+    double us(std::chrono::nanoseconds ns, int runs) {
+        return std::chrono::duration<double, std::micro>(ns).count() / runs;
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    util::ContextOptions defaults;
+    defaults.width = 64;
+    defaults.height = 64;
+    defaults.title = "GladLoadBench";
+    defaults.visible = false;
+    util::ContextOptions options = util::parse_context_options(argc, argv, defaults);
+    int runs = argc > 1 ? std::atoi(argv[1]) : 100;
+
+    util::Context context(options);
+    if (!context.valid()) {
+        return -1;
+    }
+    context_loader = context.loader();
+
+    Mode modes[] = {
+        {"eager", [] { return gladLoadGLLoader(counting_loader); }},
+        {"eager up to 3.3", [] { return gladLoadGLLoaderUpTo(counting_loader, 3, 3); }},
+        {"lazy", [] { return gladLoadGLLoaderLazy(counting_loader); }},
+    };
+
+    // interleaved so every mode sees the same warm caches
+    for (int run = 0; run < runs; run++) {
+        for (Mode& mode : modes) {
+            lookups = 0;
+            auto start = Clock::now();
+            mode.failed |= !mode.load();
+            auto loaded = Clock::now();
+            first_frame();
+            auto end = Clock::now();
+
+            mode.load_time += loaded - start;
+            mode.frame_time += end - loaded;
+            mode.lookups = lookups;
+        }
+    }
+
+    std::cout << "GL " << GLVersion.major << "." << GLVersion.minor
+        << ", " << runs << " runs, " << gladLazyCount() << " entry points\n";
+    for (const Mode& mode : modes) {
+        std::cout << mode.name << "\n"
+            << "  load         " << us(mode.load_time, runs) << " us\n"
+            << "  first frame  " << us(mode.frame_time, runs) << " us\n"
+            << "  lookups      " << mode.lookups;
+        if (mode.failed) {
+            std::cout << "  (failed)";
+        }
+        std::cout << "\n";
+    }
+    std::cout << std::flush;
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include "glad.h"
+
+#include "NullBackend.hpp"
+#include "Shaders.hpp"
+#include "StateCache.hpp"
+#include "Trace.hpp"
+#include "bindings/HelloUniforms.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+
+/**
+ * @brief Run the render loop of hellouniforms for N frames on the null
+ * backend, so only the CPU side of submission is measured: the library,
+ * the layers over the glad table and the calls themselves, with no driver
+ * below. Runs the loop bare, under the state cache and under the state
+ * cache and the trace
+ *
+ * usage: nullsubmitbench [N]
+ */
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief The body of the hellouniforms loop, without the window
+     *
+     * @return the time per frame
+     */
+    std::chrono::nanoseconds run(int frames) {
+        namespace program = shaders::bindings::HelloUniforms;
+
+        float vertices[] = {
+            0.5f, -0.5f, 0.0f,
+           -0.5f, -0.5f, 0.0f,
+            0.0f,  0.5f, 0.0f,
+        };
+
+        shaders::Shader shader(program::vert_path, program::frag_path);
+
+        unsigned int VBO, VAO;
+        glGenVertexArrays(1, &VAO);
+        glGenBuffers(1, &VBO);
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        const shaders::VertexFormat format{3 * sizeof(float), {{"aPos", 3}}};
+        shader.vertex_layout(format).apply();
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+
+        auto start = Clock::now();
+        for (int i = 0; i < frames; i++) {
+            glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+
+            float green_val = (std::sin(i * 0.01f) / 2.0f) + 0.5f;
+            shader.set_vec4(program::u_color, 0, green_val, 0, 0);
+            shader.use();
+
+            glBindVertexArray(VAO);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+
+            if (gl::trace_installed()) {
+                gl::end_trace_frame();
+            }
+        }
+        auto elapsed = Clock::now() - start;
+
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &VBO);
+        glDeleteProgram(shader.id);
+        return elapsed / std::max(frames, 1);
+    }
+
+    void report(const char* name, int frames) {
+        std::uint64_t draws = gl::null_backend_stats().draws;
+        std::chrono::nanoseconds per_frame = run(frames);
+        std::cout << name << ": " << per_frame.count() << " ns/frame, "
+            << gl::null_backend_stats().draws - draws << " draws" << std::endl;
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 100000;
+
+    gl::load_null_backend();
+    report("bare", frames);
+    gl::unload_null_backend();
+
+    gl::load_null_backend();
+    gl::install_state_cache();
+    report("state cache", frames);
+    const gl::StateCacheStats& state_stats = gl::state_cache_stats();
+    std::cout << "  state calls: " << state_stats.forwarded << " forwarded, "
+        << state_stats.elided << " elided" << std::endl;
+
+    gl::install_trace();
+    // keeps a single frame so the history does not grow with N
+    gl::set_trace_history(1);
+    report("state cache and trace", frames);
+    gl::uninstall_trace();
+    gl::uninstall_state_cache();
+    gl::unload_null_backend();
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include "glad.h"
+
+#include "PipelineCache.hpp"
+#include "ShaderLibrary.hpp"
+#include "Util.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Build every pairing of M vertex and N fragment shaders three ways:
+ * a monolithic program per pair like the Shader constructor, a monolithic
+ * program per pair linked from shader objects compiled once, and separable
+ * stages combined into program pipelines. Sources carry a per run salt so
+ * the driver's shader cache cannot help any of them
+ *
+ * usage: pipelinelinkbench [--headless] [M] [N]
+ */
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    std::string vert_source(int seed, long salt) {
+        return
+            "#version 410 core\n"
+            "// run " + std::to_string(salt) + "\n"
+            "layout (location = 0) in vec3 aPos;\n"
+            "layout (location = 0) out vec3 col;\n"
+            "out gl_PerVertex { vec4 gl_Position; };\n"
+            "void main() {\n"
+            "    vec3 p = aPos;\n"
+            "    for (int i = 0; i < " + std::to_string(4 + seed % 8) + "; i++) {\n"
+            "        p = p * " + std::to_string(seed) + ".0 + sin(p.yzx);\n"
+            "    }\n"
+            "    col = p;\n"
+            "    gl_Position = vec4(p, 1.0);\n"
+            "}\n";
+    }
+
+    std::string frag_source(int seed, long salt) {
+        return
+            "#version 410 core\n"
+            "// run " + std::to_string(salt) + "\n"
+            "layout (location = 0) in vec3 col;\n"
+            "out vec4 frag_colour;\n"
+            "uniform float u_time;\n"
+            "void main() {\n"
+            "    vec3 c = col;\n"
+            "    for (int i = 0; i < " + std::to_string(4 + seed % 8) + "; i++) {\n"
+            "        c = fract(c * " + std::to_string(seed) + ".0 + cos(c.zxy + u_time));\n"
+            "    }\n"
+            "    frag_colour = vec4(c, 1.0);\n"
+            "}\n";
+    }
+
+    GLuint compile(GLenum type, const std::string& code) {
+        const GLchar* code_ptr = code.c_str();
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &code_ptr, NULL);
+        glCompileShader(shader);
+        return shader;
+    }
+
+    double ms(std::chrono::nanoseconds ns) {
+        return std::chrono::duration<double, std::milli>(ns).count();
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    util::ContextOptions defaults;
+    defaults.width = 64;
+    defaults.height = 64;
+    defaults.title = "PipelineLinkBench";
+    defaults.major = 4;
+    defaults.minor = 1;
+    defaults.visible = false;
+    util::ContextOptions options = util::parse_context_options(argc, argv, defaults);
+    int m = argc > 1 ? std::atoi(argv[1]) : 8;
+    int n = argc > 2 ? std::atoi(argv[2]) : 8;
+
+    util::Context context(options);
+    if (!context.valid()) {
+        return -1;
+    }
+
+    if (!shaders::pipelines_supported()) {
+        std::cout << "Program pipelines need GL 4.1" << std::endl;
+        return -1;
+    }
+
+    long salt = Clock::now().time_since_epoch().count();
+    std::vector<std::string> verts;
+    std::vector<std::string> frags;
+    // each way gets its own seeds so none of them compiles what another did
+    for (int way = 0; way < 3; way++) {
+        for (int i = 0; i < m; i++) {
+            verts.push_back(vert_source(way * (m + n) + i + 1, salt));
+        }
+        for (int j = 0; j < n; j++) {
+            frags.push_back(frag_source(way * (m + n) + m + j + 1, salt));
+        }
+    }
+    auto vert = [&](int way, int i) -> const std::string& {
+        return verts[way * m + i];
+    };
+    auto frag = [&](int way, int j) -> const std::string& {
+        return frags[way * n + j];
+    };
+
+    // monolithic, both stages compiled again for every pair
+    shaders::ShaderLibrary monolithic;
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            std::size_t index = monolithic.add_source(vert(0, i), frag(0, j), "monolithic");
+            glDeleteProgram(monolithic.get(index).id);
+        }
+    }
+
+    // monolithic, every shader object compiled once and attached to N or M
+    // programs. Still M x N links
+    auto start = Clock::now();
+    std::vector<GLuint> vert_objs;
+    std::vector<GLuint> frag_objs;
+    for (int i = 0; i < m; i++) {
+        vert_objs.push_back(compile(GL_VERTEX_SHADER, vert(1, i)));
+    }
+    for (int j = 0; j < n; j++) {
+        frag_objs.push_back(compile(GL_FRAGMENT_SHADER, frag(1, j)));
+    }
+    int failed = 0;
+    for (GLuint v : vert_objs) {
+        for (GLuint f : frag_objs) {
+            GLuint prgm = glCreateProgram();
+            glAttachShader(prgm, v);
+            glAttachShader(prgm, f);
+            glLinkProgram(prgm);
+            GLint success = GL_FALSE;
+            glGetProgramiv(prgm, GL_LINK_STATUS, &success);
+            failed += success ? 0 : 1;
+            glDeleteProgram(prgm);
+        }
+    }
+    auto shared = Clock::now() - start;
+    for (GLuint v : vert_objs) {
+        glDeleteShader(v);
+    }
+    for (GLuint f : frag_objs) {
+        glDeleteShader(f);
+    }
+
+    // separable, M + N links and M x N pipelines
+    shaders::PipelineCache cache;
+    std::vector<std::size_t> vert_stages;
+    std::vector<std::size_t> frag_stages;
+    for (int i = 0; i < m; i++) {
+        vert_stages.push_back(cache.add_stage_source(GL_VERTEX_SHADER, vert(2, i), "vert"));
+    }
+    for (int j = 0; j < n; j++) {
+        frag_stages.push_back(cache.add_stage_source(GL_FRAGMENT_SHADER, frag(2, j), "frag"));
+    }
+    for (std::size_t v : vert_stages) {
+        for (std::size_t f : frag_stages) {
+            failed += cache.pipeline(v, f) == 0 ? 1 : 0;
+        }
+    }
+
+    const shaders::LibraryTimings& mono = monolithic.timings();
+    const shaders::PipelineStats& piped = cache.stats();
+
+    std::cout << m << " x " << n << " = " << m * n << " programs";
+    if (failed > 0) {
+        std::cout << ", " << failed << " failed";
+    }
+    std::cout << "\n";
+    std::cout << "monolithic        " << ms(mono.wall) << " ms  ("
+        << 2 * m * n << " compiles, " << m * n << " links)\n";
+    std::cout << "shared objects    " << ms(shared) << " ms  ("
+        << m + n << " compiles, " << m * n << " links)\n";
+    std::cout << "pipelines         " << ms(piped.stage_time + piped.assemble_time)
+        << " ms  (" << m + n << " compiles, " << m + n << " links, "
+        << piped.pipelines << " pipelines)\n";
+    std::cout << "  stages " << ms(piped.stage_time) << " ms"
+        << "  assemble " << ms(piped.assemble_time) << " ms" << std::endl;
+    return 0;
+}
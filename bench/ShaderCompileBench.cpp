@@ -0,0 +1,101 @@
+#include "glad.h"
+
+#include "ShaderLibrary.hpp"
+#include "Util.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Compile N generated programs one at a time, checking status after
+ * each like the Shader constructor, then all at once through ShaderLibrary.
+ * Every source is unique so driver side caches cannot help
+ * 
+ * usage: shadercompilebench [--headless] [N]
+ */
+
+namespace {
+    std::string vert_source(int seed, int variant) {
+        return
+            "#version 330 core\n"
+            "layout (location = 0) in vec3 aPos;\n"
+            "out vec3 col;\n"
+            "void main() {\n"
+            "    vec3 p = aPos;\n"
+            "    for (int i = 0; i < " + std::to_string(4 + variant % 8) + "; i++) {\n"
+            "        p = p * " + std::to_string(seed) + ".0 + sin(p.yzx);\n"
+            "    }\n"
+            "    col = p;\n"
+            "    gl_Position = vec4(p, 1.0);\n"
+            "}\n";
+    }
+
+    std::string frag_source(int seed, int variant) {
+        return
+            "#version 330 core\n"
+            "in vec3 col;\n"
+            "out vec4 frag_colour;\n"
+            "uniform float u_time;\n"
+            "void main() {\n"
+            "    vec3 c = col;\n"
+            "    for (int i = 0; i < " + std::to_string(4 + variant % 8) + "; i++) {\n"
+            "        c = fract(c * " + std::to_string(seed) + ".0 + cos(c.zxy + u_time));\n"
+            "    }\n"
+            "    frag_colour = vec4(c, 1.0);\n"
+            "}\n";
+    }
+
+    double ms(std::chrono::nanoseconds ns) {
+        return std::chrono::duration<double, std::milli>(ns).count();
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    util::ContextOptions defaults;
+    defaults.width = 64;
+    defaults.height = 64;
+    defaults.title = "ShaderCompileBench";
+    defaults.visible = false;
+    util::ContextOptions options = util::parse_context_options(argc, argv, defaults);
+    int n = argc > 1 ? std::atoi(argv[1]) : 64;
+
+    util::Context context(options);
+    if (!context.valid()) {
+        return -1;
+    }
+
+    // serial, status checked straight after every program
+    shaders::ShaderLibrary serial;
+    for (int i = 0; i < n; i++) {
+        std::size_t index = serial.add_source(
+            vert_source(i + 1, i), frag_source(i + 1, i), "serial"
+        );
+        glDeleteProgram(serial.get(index).id);
+    }
+
+    // batched, status checked once everything is submitted
+    shaders::ShaderLibrary batched;
+    for (int i = 0; i < n; i++) {
+        batched.add_source(
+            vert_source(n + i + 1, i), frag_source(n + i + 1, i), "batched"
+        );
+    }
+    batched.finish();
+    for (std::size_t i = 0; i < batched.size(); i++) {
+        glDeleteProgram(batched.get(i).id);
+    }
+
+    std::cout << n << " programs, GL_KHR_parallel_shader_compile: "
+        << (batched.parallel() ? "yes" : "no") << "\n";
+
+    for (const shaders::ShaderLibrary* lib : {&serial, &batched}) {
+        const shaders::LibraryTimings& t = lib->timings();
+        std::cout << (lib == &serial ? "serial " : "batched")
+            << "  wall " << ms(t.wall) << " ms"
+            << "  submit " << ms(t.submit) << " ms"
+            << "  wait " << ms(t.wait) << " ms" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include "MappedSource.hpp"
+#include "Shaders.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+/**
+ * @brief Time the shader source readers on generated files of growing size
+ * 
+ * usage: sourcereadbench [iterations]
+ */
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    // what read_shader_file used to do
+    std::string read_istreambuf(const char* path) {
+        std::ifstream f_stream(path);
+        return std::string(
+            (std::istreambuf_iterator<char>(f_stream)),
+            (std::istreambuf_iterator<char>())
+        );
+    }
+
+    // what the Shader constructor used to do
+    std::string read_stringstream(const char* path) {
+        std::ifstream file(path);
+        std::stringstream stream;
+        stream << file.rdbuf();
+        return stream.str();
+    }
+
+    void write_source(const std::filesystem::path& path, std::size_t bytes) {
+        std::ofstream file(path);
+        file << "#version 330 core\n";
+        std::size_t written = 0;
+        for (int i = 0; written < bytes; i++) {
+            std::string fn =
+                "float f" + std::to_string(i) + "(float x) {\n"
+                "    // generated padding to make a large translation unit\n"
+                "    return sin(x * " + std::to_string(i) + ".0) + cos(x);\n"
+                "}\n";
+            file << fn;
+            written += fn.size();
+        }
+    }
+
+    template <typename Reader>
+    double bench(const char* path, int iterations, Reader read) {
+        std::size_t checksum = 0;
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; i++) {
+            checksum += read(path);
+        }
+        auto elapsed = Clock::now() - start;
+        if (checksum == 0) {
+            std::cout << "empty read" << std::endl;
+        }
+        return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 50;
+    std::filesystem::path dir =
+        std::filesystem::temp_directory_path() / "learn_opengl_sourcereadbench";
+    std::filesystem::create_directories(dir);
+
+    std::cout << "size KiB, istreambuf us, stringstream us, "
+        "read_shader_file us, MappedSource us" << std::endl;
+
+    for (std::size_t kib : {4, 64, 1024, 16384}) {
+        std::filesystem::path path = dir / ("gen_" + std::to_string(kib) + ".frag");
+        write_source(path, kib * 1024);
+        const char* p = path.c_str();
+
+        // each reader touches every byte so a lazy mapping is not free
+        auto sum = [](std::string_view s) {
+            std::size_t total = s.size();
+            for (std::size_t i = 0; i < s.size(); i += 64) {
+                total += static_cast<unsigned char>(s[i]);
+            }
+            return total;
+        };
+
+        double t_istreambuf = bench(p, iterations,
+            [&](const char* f) { return sum(read_istreambuf(f)); });
+        double t_stringstream = bench(p, iterations,
+            [&](const char* f) { return sum(read_stringstream(f)); });
+        double t_read = bench(p, iterations,
+            [&](const char* f) { return sum(shaders::read_shader_file(f)); });
+        double t_mapped = bench(p, iterations,
+            [&](const char* f) { return sum(shaders::MappedSource(f).view()); });
+
+        std::cout << kib << ", " << t_istreambuf << ", " << t_stringstream
+            << ", " << t_read << ", " << t_mapped << std::endl;
+    }
+
+    std::filesystem::remove_all(dir);
+    return 0;
+}
@@ -0,0 +1,47 @@
+# Writes every file under SHADER_DIR into OUTPUT as constexpr std::string_view
+# data, sorted by path for lookup in src/Sources.cpp.
+#
+# usage: cmake -DSHADER_DIR=<dir> -DOUTPUT=<header> -P EmbedShaders.cmake
+
+get_filename_component(prefix ${SHADER_DIR} NAME)
+file(GLOB_RECURSE files RELATIVE ${SHADER_DIR} ${SHADER_DIR}/*)
+list(SORT files)
+list(LENGTH files count)
+
+set(delim "__glsl__")
+set(entries "")
+
+foreach(file ${files})
+    file(READ ${SHADER_DIR}/${file} content)
+
+    string(FIND "${content}" ")${delim}\"" found)
+    if(NOT found EQUAL -1)
+        message(FATAL_ERROR "${file} contains the raw string delimiter ${delim}")
+    endif()
+
+    string(APPEND entries
+        "        File{\"${prefix}/${file}\", R\"${delim}(${content})${delim}\"},\n"
+    )
+endforeach()
+
+file(WRITE ${OUTPUT}
+"// Generated from ${prefix}/ by cmake/EmbedShaders.cmake, do not edit
+#ifndef EMBEDDEDSHADERS_HPP
+#define EMBEDDEDSHADERS_HPP
+
+#include <array>
+#include <string_view>
+
+namespace shaders::embedded {
+
+    struct File {
+        std::string_view path;
+        std::string_view source;
+    };
+
+    inline constexpr std::array<File, ${count}> files = {
+${entries}    };
+} // namespace shaders::embedded
+
+#endif
+")
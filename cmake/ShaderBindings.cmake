@@ -0,0 +1,214 @@
+# Writes a header per program into OUTPUT_DIR with typed handles for the
+# uniforms, vertex inputs and uniform blocks its sources declare, see
+# include/Bindings.hpp. A program is the .vert and .frag under SHADER_DIR
+# that share a name. Includes are followed the way src/Preprocessor.cpp
+# resolves them. #if blocks are not evaluated, so every variant's
+# declarations are included. Headers are only rewritten when they change.
+#
+# usage: cmake -DSHADER_DIR=<dir> -DOUTPUT_DIR=<dir> -P ShaderBindings.cmake
+
+cmake_minimum_required(VERSION 3.22)
+
+get_filename_component(prefix ${SHADER_DIR} NAME)
+
+set(ident "[A-Za-z_][A-Za-z0-9_]*")
+set(precision "(highp |mediump |lowp )?")
+
+# The C++ type a handle carries for a GLSL type, empty if there is none
+function(cpp_type glsl out)
+    if(glsl MATCHES "^(float|int|bool)$")
+        set(type ${glsl})
+    elseif(glsl STREQUAL "uint")
+        set(type "unsigned int")
+    elseif(glsl MATCHES "^(vec2|vec3|vec4|ivec2|ivec4|mat3|mat4)$")
+        set(type "std140::${glsl}")
+    elseif(glsl MATCHES "^[iu]?(sampler|image)")
+        # set with the texture unit
+        set(type int)
+    else()
+        set(type "")
+    endif()
+    set(${out} "${type}" PARENT_SCOPE)
+endfunction()
+
+# A source and everything it includes
+function(collect_sources root out)
+    set(pending ${root})
+    set(seen "")
+    while(pending)
+        list(POP_FRONT pending path)
+        get_filename_component(path ${path} ABSOLUTE)
+        if(path IN_LIST seen OR NOT EXISTS ${path})
+            continue()
+        endif()
+        list(APPEND seen ${path})
+
+        file(READ ${path} text)
+        get_filename_component(dir ${path} DIRECTORY)
+        string(REGEX MATCHALL "#[ \t]*include[ \t]*[\"<][^\">]*[\">]" includes "${text}")
+        foreach(directive ${includes})
+            string(REGEX REPLACE ".*[\"<]([^\">]*)[\">]$" "\\1" name "${directive}")
+            if(EXISTS ${dir}/${name})
+                list(APPEND pending ${dir}/${name})
+            else()
+                list(APPEND pending ${SHADER_DIR}/${name})
+            endif()
+        endforeach()
+    endwhile()
+    set(${out} ${seen} PARENT_SCOPE)
+endfunction()
+
+# Adds name|type|location entries for the declarations in one source to
+# the caller's uniforms, inputs and blocks
+function(parse_source path stage)
+    file(READ ${path} text)
+    string(REGEX REPLACE "/\\*([^*]|\\*+[^*/])*\\*+/" " " text "${text}")
+    string(REGEX REPLACE "//[^\n]*" "" text "${text}")
+    string(REGEX REPLACE "#[^\n]*" "" text "${text}")
+    string(REGEX REPLACE "[ \t\r\n]+" " " text "${text}")
+
+    # uniform blocks first, their members are not uniforms of their own
+    set(block_re "uniform (${ident}) ?{[^}]*}[^;]*;")
+    while(TRUE)
+        string(REGEX MATCH "${block_re}" match "${text}")
+        if(NOT match)
+            break()
+        endif()
+        list(APPEND blocks "${CMAKE_MATCH_1}")
+        string(REPLACE "${match}" " " text "${text}")
+    endwhile()
+
+    # the text is a list of statements now
+    foreach(statement IN LISTS text)
+        # drop anything up to the end of a function body
+        string(REGEX REPLACE "^.*[{}]" "" statement "${statement}")
+        string(STRIP "${statement}" statement)
+
+        set(layout_re "^(layout ?\\(([^)]*)\\) )?")
+        set(array_re "( ?\\[ ?([0-9]*) ?\\])?")
+        if(statement MATCHES
+            "${layout_re}uniform ${precision}(${ident}) (${ident})${array_re}( ?=.*)?$")
+            set(list uniforms)
+        elseif(stage STREQUAL "vert" AND statement MATCHES
+            "${layout_re}in ${precision}(${ident}) (${ident})${array_re}$")
+            set(list inputs)
+        else()
+            continue()
+        endif()
+
+        set(layout "${CMAKE_MATCH_2}")
+        set(type ${CMAKE_MATCH_4})
+        set(name ${CMAKE_MATCH_5})
+        set(location -1)
+        if(layout MATCHES "location ?= ?([0-9]+)")
+            set(location ${CMAKE_MATCH_1})
+        endif()
+        list(APPEND ${list} "${name}|${type}|${location}")
+    endforeach()
+
+    set(uniforms ${uniforms} PARENT_SCOPE)
+    set(inputs ${inputs} PARENT_SCOPE)
+    set(blocks ${blocks} PARENT_SCOPE)
+endfunction()
+
+file(GLOB programs RELATIVE ${SHADER_DIR} ${SHADER_DIR}/*.vert ${SHADER_DIR}/*.frag)
+set(stems "")
+foreach(program ${programs})
+    get_filename_component(stem ${program} NAME_WE)
+    list(APPEND stems ${stem})
+endforeach()
+list(REMOVE_DUPLICATES stems)
+list(SORT stems)
+
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+foreach(stem ${stems})
+    set(uniforms "")
+    set(inputs "")
+    set(blocks "")
+    set(files "")
+    set(paths "")
+
+    foreach(stage vert frag)
+        if(NOT EXISTS ${SHADER_DIR}/${stem}.${stage})
+            continue()
+        endif()
+        list(APPEND files "${prefix}/${stem}.${stage}")
+        string(APPEND paths
+            "    inline constexpr const char* ${stage}_path = \"${prefix}/${stem}.${stage}\";\n"
+        )
+
+        collect_sources(${SHADER_DIR}/${stem}.${stage} sources)
+        foreach(source ${sources})
+            parse_source(${source} ${stage})
+        endforeach()
+    endforeach()
+
+    list(REMOVE_DUPLICATES uniforms)
+    list(REMOVE_DUPLICATES inputs)
+    list(REMOVE_DUPLICATES blocks)
+
+    set(body "")
+    foreach(entry ${uniforms})
+        string(REPLACE "|" ";" fields "${entry}")
+        list(GET fields 0 name)
+        list(GET fields 1 glsl)
+        list(GET fields 2 location)
+        cpp_type(${glsl} type)
+        if(type)
+            string(APPEND body
+                "    inline constexpr Uniform<${type}> ${name}{\"${name}\", ${location}};\n"
+            )
+        else()
+            string(APPEND body
+                "    // ${glsl} has no typed setter\n"
+                "    inline constexpr UniformHandle ${name} = uniform(\"${name}\");\n"
+            )
+        endif()
+    endforeach()
+
+    if(inputs)
+        string(APPEND body "\n")
+    endif()
+    foreach(entry ${inputs})
+        string(REPLACE "|" ";" fields "${entry}")
+        list(GET fields 0 name)
+        list(GET fields 1 glsl)
+        list(GET fields 2 location)
+        cpp_type(${glsl} type)
+        if(NOT type)
+            set(type void)
+        endif()
+        string(APPEND body
+            "    inline constexpr Attribute<${type}> ${name}{\"${name}\", ${location}};\n"
+        )
+    endforeach()
+
+    if(blocks)
+        string(APPEND body "\n")
+    endif()
+    foreach(name ${blocks})
+        string(APPEND body "    inline constexpr UniformBlock ${name}{\"${name}\"};\n")
+    endforeach()
+
+    string(MAKE_C_IDENTIFIER ${stem} namespace)
+    string(TOUPPER ${namespace} guard)
+    string(REPLACE ";" ", " from "${files}")
+
+    file(WRITE ${OUTPUT_DIR}/${stem}.hpp.tmp
+"// Generated from ${from} by cmake/ShaderBindings.cmake, do not edit
+#ifndef BINDINGS_${guard}_HPP
+#define BINDINGS_${guard}_HPP
+
+#include \"Shaders.hpp\"
+
+namespace shaders::bindings::${namespace} {
+
+${paths}
+${body}} // namespace shaders::bindings::${namespace}
+
+#endif
+")
+    file(COPY_FILE ${OUTPUT_DIR}/${stem}.hpp.tmp ${OUTPUT_DIR}/${stem}.hpp ONLY_IF_DIFFERENT)
+    file(REMOVE ${OUTPUT_DIR}/${stem}.hpp.tmp)
+endforeach()
@@ -0,0 +1,84 @@
+#include "glad.h"
+#include "Capture.hpp"
+#include "Util.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <string_view>
+
+/**
+ * @brief Replay a capture written by gl::start_capture() on a hidden window,
+ * or headless, with a context of the version it was captured with, and print
+ * the time spent in GL calls per frame and per entry point
+ *
+ * A headless context names its own framebuffer and renderbuffers first, so
+ * captures of a window replay with shifted names there, counted as diverged
+ *
+ * usage: glreplay [--headless] <capture> [top]
+ */
+
+namespace {
+    double us(std::chrono::nanoseconds ns) {
+        return std::chrono::duration<double, std::micro>(ns).count();
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    util::ContextOptions defaults;
+    defaults.title = "GlReplay";
+    defaults.visible = false;
+    util::ContextOptions options = util::parse_context_options(argc, argv, defaults);
+
+    if (argc < 2) {
+        std::cout << "usage: glreplay [--headless] <capture> [top]" << std::endl;
+        return -1;
+    }
+    std::size_t top = argc > 2 ? std::atoi(argv[2]) : 10;
+
+    std::optional<gl::CaptureInfo> info = gl::read_capture_info(argv[1]);
+    if (!info) {
+        std::cout << "Not a capture: " << argv[1] << std::endl;
+        return -1;
+    }
+
+    options.major = info->major;
+    options.minor = info->minor;
+    util::Context context(options);
+    if (!context.valid()) {
+        return -1;
+    }
+
+    std::optional<gl::ReplayStats> stats = gl::replay_capture(argv[1]);
+    if (!stats) {
+        return -1;
+    }
+
+    std::cout << "GL " << info->major << "." << info->minor << " capture, "
+        << stats->calls << " calls, " << stats->frames.size() << " frames\n";
+    if (stats->skipped + stats->approximated + stats->diverged > 0) {
+        std::cout << "  " << stats->skipped << " skipped, " << stats->approximated
+            << " approximated, " << stats->diverged << " diverged\n";
+    }
+
+    std::cout << "  frame 0 (loading)  " << us(stats->frames.front()) << " us\n";
+    if (stats->frames.size() > 1) {
+        auto first = stats->frames.begin() + 1;
+        auto [min, max] = std::minmax_element(first, stats->frames.end());
+        auto total = std::accumulate(first, stats->frames.end(), std::chrono::nanoseconds(0));
+        std::cout << "  frames 1-" << stats->frames.size() - 1 << "  min " << us(*min)
+            << " us, mean " << us(total) / (stats->frames.size() - 1)
+            << " us, max " << us(*max) << " us\n";
+    }
+
+    std::size_t shown = std::min(top, stats->functions.size());
+    for (std::size_t i = 0; i < shown; i++) {
+        const gl::TracedCall& call = stats->functions[i];
+        std::cout << "  " << call.name << " x" << call.calls << "  " << us(call.time)
+            << " us, longest " << us(call.longest) << " us\n";
+    }
+    std::cout << std::flush;
+    return 0;
+}
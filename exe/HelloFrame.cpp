@@ -0,0 +1,157 @@
+#include "glad.h"
+#include "Capture.hpp"
+#include "GpuProfiler.hpp"
+#include "Preprocessor.hpp"
+#include "StateCache.hpp"
+#include "Trace.hpp"
+#include "Shaders.hpp"
+#include "UniformBuffers.hpp"
+#include "bindings/HelloFrame.hpp"
+
+#include "Util.hpp"
+
+#include <iostream>
+#include <string_view>
+
+/**
+ * @brief The hellouniforms triangle, its time and matrices streamed through
+ * a UniformRing as the shared Frame block, with the tools for looking at a
+ * frame: GPU time per pass from the profiler, the calls made per frame from
+ * the trace and a capture that glreplay plays back
+ *
+ * usage: helloframe [--headless] [--trace] [--capture file]
+ */
+int main(int argc, char** argv) {
+    util::ContextOptions options = util::parse_context_options(argc, argv);
+
+    bool trace = false;
+    const char* capture_path = NULL;
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        if (arg == "--trace") {
+            trace = true;
+        } else if (arg == "--capture" && i + 1 < argc) {
+            capture_path = argv[++i];
+        } else {
+            std::cerr << "usage: helloframe [--headless] [--trace] [--capture file]"
+                << std::endl;
+            return -1;
+        }
+    }
+
+    namespace program = shaders::bindings::HelloFrame;
+
+    util::Context context(options);
+    if (!context.valid()) {
+        return -1;
+    }
+
+    // everything from here on can be replayed with glreplay. Started before
+    // the state cache so only the calls that reach the driver are recorded
+    if (capture_path != NULL) {
+        gl::start_capture(capture_path);
+    }
+
+    gl::install_state_cache();
+
+    // counts the calls the application makes, elided or not
+    if (trace) {
+        gl::install_trace();
+    }
+
+    float vertices[] = {
+        0.5f, -0.5f, 0.0f,
+       -0.5f, -0.5f, 0.0f,
+        0.0f,  0.5f, 0.0f,
+    };
+
+    // the sources include common/Frame.glsl
+    shaders::Preprocessor preprocessor;
+    shaders::Shader shader(program::vert_path, program::frag_path, preprocessor, {});
+
+    unsigned int VBO, VAO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    const shaders::VertexFormat format{3 * sizeof(float), {{"aPos", 3}}};
+    shader.vertex_layout(format).apply();
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    // GPU time of the frame and its passes, read back a few frames late
+    gl::GpuProfiler profiler;
+
+    // the Frame block every program shares, the camera does not move
+    shaders::UniformRing ring;
+    const std140::mat4 identity{{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}}};
+    shaders::FrameUniforms frame{};
+    frame.view = identity;
+    frame.projection = identity;
+    frame.camera_position = {0, 0, 1, 1};
+    shader.set_vec4(program::u_color, 0, 1, 0, 0);
+
+    // one step per frame, so runs without a window repeat exactly
+    util::LoopOptions loop;
+    loop.frame_time = loop.step;
+
+    auto update = [&](double time, double step) {
+        frame.time = static_cast<float>(time + step);
+        frame.delta_time = static_cast<float>(step);
+    };
+
+    auto render = [&](double) {
+        ring.begin_frame();
+        ring.set_frame(frame);
+
+        profiler.begin("frame");
+        {
+            gl::GpuScope clear(profiler, "clear");
+            glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT);
+        }
+
+        {
+            gl::GpuScope draw(profiler, "triangle");
+            shader.use();
+
+            glBindVertexArray(VAO);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+        }
+        profiler.end();
+        profiler.end_frame();
+        ring.end_frame();
+
+        if (trace) {
+            gl::end_trace_frame();
+        }
+        if (capture_path != NULL) {
+            gl::end_capture_frame();
+        }
+    };
+
+    util::run_loop(context, update, render, loop);
+
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &VBO);
+    glDeleteProgram(shader.id);
+
+    profiler.print(std::cout);
+
+    const gl::StateCacheStats& state_stats = gl::state_cache_stats();
+    std::cout << "State calls: " << state_stats.forwarded << " forwarded, "
+        << state_stats.elided << " elided" << std::endl;
+
+    if (capture_path != NULL) {
+        gl::stop_capture();
+        const gl::CaptureStats& capture = gl::capture_stats();
+        std::cout << "Capture: " << capture.calls << " calls, " << capture.frames
+            << " frames, " << capture.bytes << " bytes" << std::endl;
+    }
+
+    if (trace && !gl::trace_history().empty()) {
+        gl::print_trace(std::cout, gl::trace_history().back());
+    }
+    return 0;
+}
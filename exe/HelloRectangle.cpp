@@ -1,18 +1,19 @@
 #include "glad.h"
+#include "StateCache.hpp"
 
 #include "Shaders.hpp"
 #include "Util.hpp"
 
-#include <GLFW/glfw3.h>
 #include <iostream>
 #include <string.h>
 
-int main(int argc, char const *argv[]) {
+int main(int argc, char** argv) {
+    util::ContextOptions options = util::parse_context_options(argc, argv);
 
     if (argc != 2) {
         std::cerr << 
             "Usage:\n" <<
-            "   hellorectangle <arg>\n" <<
+            "   hellorectangle [--headless] <arg>\n" <<
             "       -l - wireframe mode\n" <<
             "       -f - fill mode\n" << 
         std::endl;
@@ -20,27 +21,14 @@ int main(int argc, char const *argv[]) {
         return EXIT_FAILURE;
     }
 
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-    // Window
-    GLFWwindow *window = glfwCreateWindow(1280, 720, "LearnOpenGL", NULL, NULL);
-    if (window == NULL) {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
-        return -1;
-    }
-    glfwMakeContextCurrent(window);
-
-    if (!gladLoadGLLoader((GLADloadproc) glfwGetProcAddress)) {
-        std::cout << "Failed to initialize GLAD" << std::endl;
+    // Window, or a framebuffer with --headless
+    util::Context context(options);
+    if (!context.valid()) {
         return -1;
     }
 
-    glViewport(0, 0, 1280, 720);
-    glfwSetFramebufferSizeCallback(window, util::framebuffer_size_callback);
+    // the render loop rebinds the same program and VAO every frame
+    gl::install_state_cache();
 
     // Rectangle
     float vertices[] = {
@@ -67,20 +55,17 @@ int main(int argc, char const *argv[]) {
 
     // Check shader compile success
     int success;
-    char info_log[512];
 
     glGetShaderiv(vertex_shader, GL_COMPILE_STATUS, &success);
     if(!success) {
-        glGetShaderInfoLog(vertex_shader, 512, NULL, info_log);
         std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n"
-            << info_log << std::endl;
+            << shaders::shader_info_log(vertex_shader) << std::endl;
     }
 
     glGetShaderiv(frag_shader, GL_COMPILE_STATUS, &success);
     if(!success) {
-        glGetShaderInfoLog(frag_shader, 512, NULL, info_log);
         std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n"
-            << info_log << std::endl;
+            << shaders::shader_info_log(frag_shader) << std::endl;
     }
 
     // Shader program
@@ -92,9 +77,8 @@ int main(int argc, char const *argv[]) {
     // Check shader link success
     glGetProgramiv(shader_pgrm, GL_LINK_STATUS, &success);
     if(!success) {
-        glGetShaderInfoLog(shader_pgrm, 512, NULL, info_log);
         std::cout << "ERROR::SHADER::VERTEX::LINKING_FAILED\n"
-            << info_log << std::endl;
+            << shaders::program_info_log(shader_pgrm) << std::endl;
     }
 
     // Delete shaders
@@ -114,8 +98,10 @@ int main(int argc, char const *argv[]) {
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indecies), indecies, GL_STATIC_DRAW);
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
+    // attributes are matched to the vertex shader by name
+    const shaders::VertexFormat format{3 * sizeof(float), {{"aPos", 3}}};
+    shaders::Shader shader(shader_pgrm);
+    shader.vertex_layout(format).apply();
 
     // Unbinding for safety
     glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -129,7 +115,7 @@ int main(int argc, char const *argv[]) {
     } else {
         std::cerr << 
             "Usage:\n" <<
-            "   hellorectangle <arg>\n" <<
+            "   hellorectangle [--headless] <arg>\n" <<
             "       -l - wireframe mode\n" <<
             "       -f - fill mode\n" << 
         std::endl;
@@ -138,9 +124,7 @@ int main(int argc, char const *argv[]) {
     }
 
     // Render loop
-    while(!glfwWindowShouldClose(window)) {
-        util::process_input(window);
-
+    while(!context.should_close()) {
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
@@ -149,15 +133,12 @@ int main(int argc, char const *argv[]) {
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
         glBindVertexArray(0); // why?
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        context.end_frame();
     }
 
     // Deallocate
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
     glDeleteProgram(shader_pgrm);
-    
-    glfwTerminate();
     return 0;
 }
\ No newline at end of file
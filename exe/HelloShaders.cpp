@@ -1,35 +1,23 @@
 #include "glad.h"
+#include "StateCache.hpp"
 
 #include "Shaders.hpp"
 #include "Util.hpp"
 
-#include <GLFW/glfw3.h>
 #include <iostream>
 #include <math.h>
 
-int main() {
+int main(int argc, char** argv) {
+    util::ContextOptions options = util::parse_context_options(argc, argv);
 
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-    // Window
-    GLFWwindow *window = glfwCreateWindow(1280, 720, "LearnOpenGL", NULL, NULL);
-    if (window == NULL) {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
+    // Window, or a framebuffer with --headless
+    util::Context context(options);
+    if (!context.valid()) {
         return -1;
     }
-    glfwMakeContextCurrent(window);
 
-    if (!gladLoadGLLoader((GLADloadproc) glfwGetProcAddress)) {
-        std::cout << "Failed to initialize GLAD" << std::endl;
-        return -1;
-    }
-
-    glViewport(0, 0, 1280, 720);
-    glfwSetFramebufferSizeCallback(window, util::framebuffer_size_callback);
+    // the render loop rebinds the same program and VAO every frame
+    gl::install_state_cache();
 
     // Vertex shader
     unsigned int vertex_shader = glCreateShader(GL_VERTEX_SHADER);
@@ -43,21 +31,18 @@ int main() {
 
     // Check vert shader compile success
     int success;
-    char info_log[512];
 
     glGetShaderiv(vertex_shader, GL_COMPILE_STATUS, &success);
     if(!success) {
-        glGetShaderInfoLog(vertex_shader, 512, NULL, info_log);
         std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n"
-            << info_log << std::endl;
+            << shaders::shader_info_log(vertex_shader) << std::endl;
     }
 
     // Check frag shader compile success
     glGetShaderiv(frag_shader, GL_COMPILE_STATUS, &success);
     if(!success) {
-        glGetShaderInfoLog(frag_shader, 512, NULL, info_log);
         std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n"
-            << info_log << std::endl;
+            << shaders::shader_info_log(frag_shader) << std::endl;
     }
 
     // Shader program
@@ -69,9 +54,8 @@ int main() {
     // Check shader link success
     glGetProgramiv(shader_pgrm, GL_LINK_STATUS, &success);
     if(!success) {
-        glGetShaderInfoLog(shader_pgrm, 512, NULL, info_log);
         std::cout << "ERROR::SHADER::VERTEX::LINKING_FAILED\n"
-            << info_log << std::endl;
+            << shaders::program_info_log(shader_pgrm) << std::endl;
     }
 
     // Triangle vertices and colours
@@ -96,49 +80,44 @@ int main() {
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     /**
-     * col
+     * aPos and aCol are matched by name against the vertex shader, which
+     * decides their locations; a mismatch is reported here
      * 
-     * 0 - location 0 for aPos in .vert
      * 3 - no. components per attribute
      * GL_FLOAT - type
-     * GL_TRUE - normalization flag
-     * 6 * sizeof(float) - the data is in strides of 6 floats (6 * 4 bits)
-     * (void *)0 - start index (pos data starts at 0, col data starts at 3 * 4 bits)
+     * true - normalization flag
+     * 6 * sizeof(float) - the data is in strides of 6 floats (6 * 4 bytes)
+     * 0, 3 * sizeof(float) - pos data starts at 0, col data starts at 3 * 4 bytes
      */
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_TRUE, 6 * sizeof(float), (void *)0);
-    glEnableVertexAttribArray(0);
-
-    glVertexAttribPointer(
-        1, 3, GL_FLOAT, GL_TRUE, 6 * sizeof(float), (void *)(3 * sizeof(float))
-    );
-    glEnableVertexAttribArray(1);
+    const shaders::VertexFormat format{
+        6 * sizeof(float),
+        {
+            {"aPos", 3, GL_FLOAT, true, 0},
+            {"aCol", 3, GL_FLOAT, true, 3 * sizeof(float)},
+        },
+    };
+    shaders::Shader shader(shader_pgrm);
+    shader.vertex_layout(format).apply();
 
     // Unbinding for safety
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);   
 
     // Render loop
-    while(!glfwWindowShouldClose(window)) {
-        util::process_input(window);
-
+    while(!context.should_close()) {
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        glUseProgram(shader_pgrm);
-
         glUseProgram(shader_pgrm);
         glBindVertexArray(VAO);
         glDrawArrays(GL_TRIANGLES, 0, 3);
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+        context.end_frame();
     }
 
     // Deallocate
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
     glDeleteProgram(shader_pgrm);
-    
-    glfwTerminate();
     return 0;
 }
\ No newline at end of file
@@ -1,35 +1,52 @@
 #include "glad.h"
+#include "StateCache.hpp"
+#include "ProgramCache.hpp"
 #include "Shaders.hpp"
+#include "SourceLoader.hpp"
+#include "WarmUp.hpp"
+#include "bindings/HelloUniforms.hpp"
+#ifdef LEARN_OPENGL_HOT_RELOAD
+#include "ShaderWatcher.hpp"
+#endif
 
 #include "Util.hpp"
 
-#include <GLFW/glfw3.h>
+#include <chrono>
+#include <cmath>
+#include <future>
 #include <iostream>
-#include <math.h>
-
-int main() {
+#include <string_view>
+
+// usage: hellouniforms [--headless] [--records compile_records.json]
+int main(int argc, char** argv) {
+    util::ContextOptions options = util::parse_context_options(argc, argv);
+
+    const char* records_path = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (std::string_view(argv[i]) == "--records" && i + 1 < argc) {
+            records_path = argv[++i];
+        } else {
+            std::cerr << "usage: hellouniforms [--headless] [--records file]" << std::endl;
+            return -1;
+        }
+    }
 
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    // typed handles generated from the sources
+    namespace program = shaders::bindings::HelloUniforms;
 
-    // Window
-    GLFWwindow *window = glfwCreateWindow(1280, 720, "LearnOpenGL", NULL, NULL);
-    if (window == NULL) {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
-        return -1;
-    }
-    glfwMakeContextCurrent(window);
+    // read the sources while the window and context are created
+    shaders::SourceLoader loader(1);
+    std::future<shaders::ProgramSources> sources =
+        loader.load(program::vert_path, program::frag_path);
 
-    if (!gladLoadGLLoader((GLADloadproc) glfwGetProcAddress)) {
-        std::cout << "Failed to initialize GLAD" << std::endl;
+    // Window, or a framebuffer with --headless
+    util::Context context(options);
+    if (!context.valid()) {
         return -1;
     }
 
-    glViewport(0, 0, 1280, 720);
-    glfwSetFramebufferSizeCallback(window, util::framebuffer_size_callback);
+    // the render loop rebinds the same program and VAO every frame
+    gl::install_state_cache();
 
     // Triangle vertices and colours
     float vertices[] = {
@@ -38,52 +55,13 @@ int main() {
         0.0f,  0.5f, 0.0f,
     };
 
-    // Vertex shader
-    unsigned int vertex_shader = glCreateShader(GL_VERTEX_SHADER);
-    shaders::load_shader(vertex_shader, "shaders/HelloUniforms.vert");
-    glCompileShader(vertex_shader);
-
-    // Fragment shader
-    unsigned int frag_shader = glCreateShader(GL_FRAGMENT_SHADER);
-    shaders::load_shader(frag_shader, "shaders/HelloUniforms.frag");
-    glCompileShader(frag_shader);
-
-    // Check vert shader compile success
-    int success;
-    char info_log[512];
-
-    glGetShaderiv(vertex_shader, GL_COMPILE_STATUS, &success);
-    if(!success) {
-        glGetShaderInfoLog(vertex_shader, 512, NULL, info_log);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n"
-            << info_log << std::endl;
-    }
+    shaders::ProgramCache program_cache(SHADER_CACHE_DIR);
+    shaders::Shader shader(sources.get(), program_cache);
 
-    // Check frag shader compile success
-    glGetShaderiv(frag_shader, GL_COMPILE_STATUS, &success);
-    if(!success) {
-        glGetShaderInfoLog(frag_shader, 512, NULL, info_log);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n"
-            << info_log << std::endl;
-    }
-
-    // Shader program
-    unsigned int shader_pgrm = glCreateProgram();
-    glAttachShader(shader_pgrm, vertex_shader);
-    glAttachShader(shader_pgrm, frag_shader);
-    glLinkProgram(shader_pgrm);
-
-    // Check shader link success
-    glGetProgramiv(shader_pgrm, GL_LINK_STATUS, &success);
-    if(!success) {
-        glGetShaderInfoLog(shader_pgrm, 512, NULL, info_log);
-        std::cout << "ERROR::SHADER::VERTEX::LINKING_FAILED\n"
-            << info_log << std::endl;
-    }
-
-    // Delete shaders
-    glDeleteShader(vertex_shader);
-    glDeleteShader(frag_shader);
+#ifdef LEARN_OPENGL_HOT_RELOAD
+    shaders::ShaderWatcher watcher;
+    watcher.watch(shader);
+#endif
 
     // VBO and VAO and linking vertex attributes
     unsigned int VBO, VAO;
@@ -94,40 +72,88 @@ int main() {
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(0);
+    // attributes are matched to the vertex shader by name
+    const shaders::VertexFormat format{3 * sizeof(float), {{"aPos", 3}}};
+    shader.vertex_layout(format).apply();
 
     // Unbinding for safety
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);   
 
-    // Render loop
-    while(!glfwWindowShouldClose(window)) {
-        util::process_input(window);
+    // draw once off screen so the first frame does not stall compiling
+    shaders::WarmUp warm_up;
+    warm_up.warm(shader, {format});
+
+    // the colour is simulated at a fixed 120 Hz and interpolated per frame.
+    // Without a window every frame is one step, so screenshots repeat
+    util::LoopOptions loop;
+    if (context.backend() != util::Backend::WINDOW) {
+        loop.frame_time = loop.step;
+    }
+    float previous_green = 0.5f;
+    float green = 0.5f;
+
+    auto update = [&](double time, double step) {
+        previous_green = green;
+        green = static_cast<float>(std::sin(time + step) / 2.0 + 0.5);
+    };
+
+    auto render = [&](double alpha) {
+#ifdef LEARN_OPENGL_HOT_RELOAD
+        watcher.poll();
+#endif
 
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
 
-        glUseProgram(shader_pgrm);
-
-        // Update uniform
-        float t = glfwGetTime();
-        float green_val = (sin(t) / 2.0f) + 0.5f;
-        int loc = glad_glGetUniformLocation(shader_pgrm, "u_color");
-        glUniform4f(loc, 0, green_val, 0, 0);
+        // Update uniform, sent to the driver by use() if it changed
+        float green_val = previous_green + (green - previous_green) * static_cast<float>(alpha);
+        shader.set_vec4(program::u_color, 0, green_val, 0, 0);
+        shader.use();
 
         glBindVertexArray(VAO);
         glDrawArrays(GL_TRIANGLES, 0, 3);
+    };
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
-    }
+    // Render loop
+    util::LoopStats loop_stats = util::run_loop(context, update, render, loop);
 
     // Deallocate
     glDeleteVertexArrays(1, &VAO);
     glDeleteBuffers(1, &VBO);
-    glDeleteProgram(shader_pgrm);
-    
-    glfwTerminate();
+    glDeleteProgram(shader.id);
+
+    const shaders::ProgramCacheStats& stats = program_cache.stats();
+    std::cout << "Program cache: " << stats.hits << " hits, "
+        << stats.misses << " misses, " << stats.rejected << " rejected, "
+        << std::chrono::duration<double, std::milli>(stats.time_saved).count()
+        << " ms saved" << std::endl;
+
+    const shaders::UniformStats& uniform_stats = shader.uniform_stats();
+    std::cout << "Uniform writes: " << uniform_stats.requested << " requested, "
+        << uniform_stats.elided << " elided, " << uniform_stats.issued
+        << " issued" << std::endl;
+
+    std::cout << "Loop: " << loop_stats.frames << " frames, " << loop_stats.steps
+        << " steps, " << loop_stats.dropped << " s dropped" << std::endl;
+
+    const gl::StateCacheStats& state_stats = gl::state_cache_stats();
+    std::cout << "State calls: " << state_stats.forwarded << " forwarded, "
+        << state_stats.elided << " elided" << std::endl;
+
+    if (const shaders::ProgramRecord* build = shader.build_record()) {
+        auto ms = [](std::chrono::nanoseconds ns) {
+            return std::chrono::duration<double, std::milli>(ns).count();
+        };
+        std::cout << "Shader build: read " << ms(build->read) << " ms, compile "
+            << ms(build->vertex.compile + build->fragment.compile) << " ms, "
+            << (build->cached ? "binary load " : "link ") << ms(build->link)
+            << " ms, first use " << ms(build->first_use) << " ms, warm-up "
+            << ms(build->warm_up) << " ms" << std::endl;
+    }
+
+    if (records_path != NULL) {
+        shaders::export_compile_records(records_path);
+    }
     return 0;
 }
\ No newline at end of file
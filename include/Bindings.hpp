@@ -0,0 +1,63 @@
+#ifndef BINDINGS_HPP
+#define BINDINGS_HPP
+
+#include "glad.h"
+#include "Hash.hpp"
+#include "Std140.hpp"
+
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief Typed handles generated from the GLSL sources by
+ * cmake/ShaderBindings.cmake, one header per program under bindings/
+ *
+ * A handle carries the GLSL type of its uniform as T, using the std140
+ * types for vectors and matrices and int for samplers. The typed Shader
+ * setters only accept the matching type, so a wrong type or a misspelt
+ * name is a compile error instead of a silent no-op.
+ */
+namespace shaders {
+
+    /**
+     * @brief A uniform declared in a program's sources
+     *
+     */
+    template <typename T>
+    struct Uniform {
+        std::string_view name;
+        std::uint32_t hash;
+        // from layout(location = N), -1 when the driver assigns it
+        GLint location;
+
+        explicit constexpr Uniform(std::string_view name, GLint location = -1)
+            : name(name), hash(hash::fnv1a_32(name)), location(location) {
+        }
+    };
+
+    /**
+     * @brief A vertex shader input declared in a program's sources
+     *
+     */
+    template <typename T>
+    struct Attribute {
+        std::string_view name;
+        // from layout(location = N), -1 when the driver assigns it
+        GLint location;
+
+        explicit constexpr Attribute(std::string_view name, GLint location = -1)
+            : name(name), location(location) {
+        }
+    };
+
+    /**
+     * @brief A uniform block declared in a program's sources, see
+     * block_binding()
+     *
+     */
+    struct UniformBlock {
+        std::string_view name;
+    };
+} // namespace shaders
+
+#endif
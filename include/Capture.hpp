@@ -0,0 +1,120 @@
+#ifndef CAPTURE_HPP
+#define CAPTURE_HPP
+
+#include "glad.h"
+#include "Trace.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+namespace gl {
+
+    /**
+     * @brief Totals of the capture in progress
+     *
+     */
+    struct CaptureStats {
+        std::uint64_t calls = 0;
+        std::uint64_t frames = 0;
+        std::uint64_t bytes = 0;
+        // pointer arguments whose size is not known. Replay passes null for
+        // what the call reads and skips calls that write through them
+        std::uint64_t unknown = 0;
+    };
+
+    /**
+     * @brief Record every call made through the glad table to a file
+     *
+     * Each call is written with its arguments. The data behind pointer
+     * arguments is stored where its size follows from the other arguments:
+     * buffer uploads, uniform arrays, shader sources, strings and name
+     * arrays. Pointers that are offsets into a bound buffer (vertex
+     * attributes, indices, indirect draws) are stored as offsets, output
+     * pointers as the size the call writes through them. Other pointers are
+     * counted in CaptureStats::unknown. Writes through mapped buffers are not seen.
+     *
+     * Start right after glad has loaded, so the objects later frames use
+     * are created in the capture too, and before the state cache, so only
+     * the calls that reach the driver are recorded. Only the calling
+     * thread's calls are recorded, and the capture is stopped on it. The
+     * file is in the byte order of the machine.
+     *
+     * @param path the capture file
+     * @return whether the file could be opened
+     */
+    bool start_capture(const std::filesystem::path& path);
+
+    /**
+     * @brief Mark the end of a frame, e.g. after glfwSwapBuffers, and write
+     * it to the file
+     *
+     */
+    void end_capture_frame();
+
+    /**
+     * @brief Put the wrapped pointers back and close the file
+     *
+     */
+    void stop_capture();
+
+    bool capturing();
+
+    const CaptureStats& capture_stats();
+
+    /**
+     * @brief What a capture file says about itself
+     *
+     */
+    struct CaptureInfo {
+        // the version of the context it was captured with
+        int major = 0;
+        int minor = 0;
+        // entry points known when it was captured
+        std::size_t functions = 0;
+    };
+
+    /**
+     * @brief Read the header of a capture file
+     *
+     * @param path the capture file
+     * @return the header, nothing if it is not a capture
+     */
+    std::optional<CaptureInfo> read_capture_info(const std::filesystem::path& path);
+
+    /**
+     * @brief Timings of a replay
+     *
+     */
+    struct ReplayStats {
+        std::uint64_t calls = 0;
+        // entry points not loaded in this context or unknown to this build,
+        // and calls writing through a pointer of unknown size
+        std::uint64_t skipped = 0;
+        // input pointer arguments of unknown size, passed as null
+        std::uint64_t approximated = 0;
+        // calls that returned or generated something other than at capture,
+        // later calls may use different objects
+        std::uint64_t diverged = 0;
+        // time spent in GL calls per frame. The calls before the first end
+        // of frame, usually the loading, are frame 0
+        std::vector<std::chrono::nanoseconds> frames;
+        // per entry point over the whole replay, most time first
+        std::vector<TracedCall> functions;
+    };
+
+    /**
+     * @brief Make the calls of a capture on the current context, through
+     * the glad table, timing each. Only the calls are timed, decoding the
+     * file is not. Each frame is finished with glFinish, untimed, so work
+     * queued by one frame is not charged to the next
+     *
+     * @param path the capture file
+     * @return the timings, nothing if the file could not be read
+     */
+    std::optional<ReplayStats> replay_capture(const std::filesystem::path& path);
+} // namespace gl
+
+#endif
@@ -0,0 +1,116 @@
+#ifndef COMPILERECORDS_HPP
+#define COMPILERECORDS_HPP
+
+#include "glad.h"
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <ostream>
+#include <string>
+
+namespace shaders {
+
+    /**
+     * @brief The complete info log of a shader object, sized from
+     * GL_INFO_LOG_LENGTH
+     *
+     */
+    std::string shader_info_log(GLuint shader);
+
+    /**
+     * @brief The complete info log of a program object
+     *
+     */
+    std::string program_info_log(GLuint prgm);
+
+    /**
+     * @brief The complete info log of a program pipeline object
+     *
+     */
+    std::string pipeline_info_log(GLuint pipeline);
+
+    /**
+     * @brief One stage of a program build
+     *
+     */
+    struct StageRecord {
+        // GL_NONE when the program has no such stage
+        GLenum type = GL_NONE;
+        std::chrono::nanoseconds compile{0};
+        bool compiled = false;
+        std::string log;
+    };
+
+    /**
+     * @brief Where the time went building one program. Batched builds
+     * (ShaderLibrary) only see how long the calls took, time spent waiting
+     * on the driver is counted as link
+     *
+     */
+    struct ProgramRecord {
+        // the source paths, or a label for sources given as text
+        std::string label;
+        GLuint program = 0;
+        std::chrono::nanoseconds read{0};
+        std::chrono::nanoseconds preprocess{0};
+        StageRecord vertex;
+        StageRecord fragment;
+        // linking, or loading the binary when cached
+        std::chrono::nanoseconds link{0};
+        bool linked = false;
+        // loaded from the program binary cache, nothing was compiled
+        bool cached = false;
+        std::string link_log;
+        // the first Shader::use(). Drivers that defer work to the first
+        // draw do not show it here
+        std::chrono::nanoseconds first_use{0};
+        bool used = false;
+        // the draws made by WarmUp, see WarmUp.hpp
+        std::chrono::nanoseconds warm_up{0};
+        bool warmed = false;
+    };
+
+    /**
+     * @brief Start a record for a program build. Only the last 1024 records
+     * are kept, past that the oldest is dropped
+     *
+     * @param label the source paths or a name
+     * @return index of the record, stays valid when older records are
+     * dropped
+     */
+    std::size_t add_compile_record(std::string label);
+
+    /**
+     * @brief The record at an index from add_compile_record(). A dropped
+     * record reads as empty and writes to it are lost
+     *
+     */
+    ProgramRecord& compile_record(std::size_t index);
+
+    /**
+     * @brief The programs built so far, in order, up to the last 1024.
+     * Reloads add a record of their own
+     *
+     */
+    const std::deque<ProgramRecord>& compile_records();
+
+    /**
+     * @brief Write the records as JSON, together with the vendor, renderer
+     * and version of the current context
+     *
+     * @param out the stream
+     */
+    void write_compile_records(std::ostream& out);
+
+    /**
+     * @brief Write the records as JSON to a file
+     *
+     * @param path the file path
+     * @return whether the file was written
+     */
+    bool export_compile_records(const std::filesystem::path& path);
+} // namespace shaders
+
+#endif
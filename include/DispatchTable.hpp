@@ -0,0 +1,68 @@
+#ifndef DISPATCHTABLE_HPP
+#define DISPATCHTABLE_HPP
+
+#include "glad.h"
+
+namespace gl {
+
+    /**
+     * @brief The entry points of one GL context, owned by it
+     *
+     * glad keeps its table per thread, see GLAD_THREAD_LOCAL. Load a
+     * DispatchTable once per context, then call make_current() on every
+     * thread the context is made current on, e.g. an upload or compile
+     * thread with a context shared with the render context. The library
+     * calls GL through the table of the calling thread, and caches built
+     * from it (extensions) are per thread too.
+     *
+     * Layers (state cache, trace, capture) replace pointers in the table
+     * of the thread that installs them and keep their state per thread as
+     * well, so each thread can install its own. The null backend keeps one
+     * state for the process. Load tables before installing layers, or only
+     * make tables with layers current on the thread that installed them.
+     */
+    class DispatchTable {
+    public:
+        DispatchTable();
+        ~DispatchTable();
+
+        DispatchTable(const DispatchTable&) = delete;
+        DispatchTable& operator=(const DispatchTable&) = delete;
+
+        /**
+         * @brief Load the entry points of the context current on this
+         * thread. Also makes the table current on this thread
+         *
+         * @param load e.g. glfwGetProcAddress
+         * @return whether glad could load the context
+         */
+        bool load(GLADloadproc load);
+
+        /**
+         * @brief Copy the table of this thread, e.g. after gladLoadGLLoader
+         *
+         */
+        void capture();
+
+        /**
+         * @brief Make this the table of the calling thread. Call after
+         * making the table's context current on the thread
+         *
+         */
+        void make_current() const;
+
+        /**
+         * @brief Clear the table of the calling thread, e.g. after releasing
+         * its context, so stray calls fail at NULL
+         *
+         */
+        static void release();
+
+        GladGLContext* get() const;
+
+    private:
+        GladGLContext* table;
+    };
+} // namespace gl
+
+#endif
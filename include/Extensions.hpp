@@ -0,0 +1,72 @@
+#ifndef EXTENSIONS_HPP
+#define EXTENSIONS_HPP
+
+#include "glad.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace gl {
+
+    /**
+     * @brief A set of extension names, copied into one string and found
+     * through an open addressing hash table
+     *
+     */
+    class ExtensionSet {
+    public:
+        ExtensionSet() = default;
+
+        /**
+         * @brief Copy the names, duplicates and empty names are dropped
+         *
+         * @param names the extension names
+         */
+        explicit ExtensionSet(const std::vector<std::string_view>& names);
+
+        bool contains(std::string_view name) const;
+
+        std::size_t size() const;
+
+    private:
+        struct Slot {
+            std::uint32_t hash = 0;
+            std::uint32_t offset = 0;
+            // 0 for an empty slot
+            std::uint32_t length = 0;
+        };
+
+        // every name followed by a null
+        std::string names;
+        // a power of two, at least twice the number of names
+        std::vector<Slot> slots;
+        std::size_t count = 0;
+    };
+
+    /**
+     * @brief The extensions of the context current on this thread, queried
+     * on the first call on the thread and kept until reload_extensions()
+     *
+     */
+    const ExtensionSet& extensions();
+
+    /**
+     * @brief Query the extensions again, e.g. after making a different
+     * context current
+     *
+     */
+    void reload_extensions();
+
+    /**
+     * @brief Whether the current context supports an extension. A hash and
+     * usually one comparison, cheap enough for per frame decisions
+     *
+     * @param name the name including its GL_ prefix
+     */
+    bool has_extension(std::string_view name);
+} // namespace gl
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef GLADFUNCTIONS_HPP
+#define GLADFUNCTIONS_HPP
+
+#include "glad.h"
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace gl {
+
+    /**
+     * @brief Every entry point in the glad table, in load order. Generated
+     * with glad as glad_functions.inc, include it with GLAD_FUNCTION(name)
+     * defined to expand the list
+     *
+     */
+    enum Function : std::size_t {
+#define GLAD_FUNCTION(name) FN_##name,
+#include "glad_functions.inc"
+#undef GLAD_FUNCTION
+        FUNCTION_COUNT
+    };
+
+    /**
+     * @brief The name of an entry point, e.g. "glDrawArrays"
+     *
+     */
+    const char* function_name(Function function);
+
+    /**
+     * @brief The entry point with a name, if glad has one
+     *
+     */
+    std::optional<Function> find_function(std::string_view name);
+} // namespace gl
+
+#endif
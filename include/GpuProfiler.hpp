@@ -0,0 +1,193 @@
+#ifndef GPUPROFILER_HPP
+#define GPUPROFILER_HPP
+
+#include "glad.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace gl {
+
+    /**
+     * @brief One marker of a frame, measured on the GPU
+     *
+     */
+    struct GpuPass {
+        const char* name = "";
+        // 0 for the outermost markers
+        std::uint32_t depth = 0;
+        // index in GpuFrame::passes, -1 for the outermost markers
+        std::int32_t parent = -1;
+        // from the first marker of the frame to the start of this one
+        std::chrono::nanoseconds start{0};
+        std::chrono::nanoseconds time{0};
+    };
+
+    /**
+     * @brief The markers of one frame as a tree, parents before their
+     * children in the order they began
+     *
+     */
+    struct GpuFrame {
+        std::uint64_t frame = 0;
+        std::vector<GpuPass> passes;
+        // from the start of the first marker to the end of the last
+        std::chrono::nanoseconds time{0};
+    };
+
+    /**
+     * @brief The GPU time of a named pass over the recent frames, summed
+     * per frame where a name is used more than once
+     *
+     */
+    struct GpuPassStats {
+        std::string name;
+        // the depth it was last seen at
+        std::uint32_t depth = 0;
+        std::size_t samples = 0;
+        std::chrono::nanoseconds min{0};
+        std::chrono::nanoseconds avg{0};
+        std::chrono::nanoseconds p99{0};
+    };
+
+    /**
+     * @brief Times nested sections of GPU work with timestamp queries,
+     * without ever waiting for them
+     *
+     * begin() and end() each write a GL_TIMESTAMP query with
+     * glQueryCounter, which unlike GL_TIME_ELAPSED queries nest freely.
+     * Queries come from a pool that grows to what the frames in flight
+     * need. end_frame() reads back frames at least `latency` frames old
+     * whose queries are available, a frame the GPU has not finished yet
+     * is tried again at the next end_frame(). Timer queries are core from
+     * 3.3, without them or ARB_timer_query the markers do nothing.
+     *
+     * Create, use and destroy it with the same context current.
+     */
+    class GpuProfiler {
+    public:
+        /**
+         * @brief Check the current context for timer queries
+         *
+         * @param latency frames to wait before reading a frame back
+         * @param window frames the rolling statistics cover
+         */
+        explicit GpuProfiler(std::size_t latency = 3, std::size_t window = 120);
+        ~GpuProfiler();
+
+        GpuProfiler(const GpuProfiler&) = delete;
+        GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+        bool supported() const;
+
+        /**
+         * @brief Start a marker, nested in the markers still open
+         *
+         * @param name kept by pointer, e.g. a string literal
+         */
+        void begin(const char* name);
+
+        /**
+         * @brief End the innermost open marker
+         *
+         */
+        void end();
+
+        /**
+         * @brief Close the frame, e.g. after swapping buffers, and read
+         * back the finished frames. Markers left open are ended
+         *
+         */
+        void end_frame();
+
+        /**
+         * @brief The most recent frame read back, NULL before the first
+         *
+         */
+        const GpuFrame* last_frame() const;
+
+        /**
+         * @brief Statistics of every pass seen in the window, in the order
+         * the passes were first seen
+         *
+         */
+        std::vector<GpuPassStats> stats() const;
+
+        /**
+         * @brief Frames ended but not read back yet
+         *
+         */
+        std::size_t pending() const;
+
+        /**
+         * @brief Print the statistics of every pass, indented by depth
+         *
+         */
+        void print(std::ostream& out) const;
+
+    private:
+        struct Marker {
+            const char* name;
+            std::uint32_t depth;
+            std::int32_t parent;
+            GLuint begin;
+            // 0 while open
+            GLuint end;
+        };
+
+        struct InFlight {
+            std::uint64_t frame = 0;
+            std::vector<Marker> markers;
+            // written last, available once the whole frame is
+            GLuint last = 0;
+        };
+
+        struct Samples {
+            std::size_t order;
+            std::uint32_t depth;
+            // the frame of the newest sample
+            std::uint64_t frame;
+            std::deque<std::chrono::nanoseconds> times;
+        };
+
+        GLuint query();
+        bool resolve(InFlight& frame);
+
+        std::size_t latency;
+        std::size_t window;
+        bool enabled;
+        std::vector<GLuint> pool;
+        std::vector<GLuint> all_queries;
+        InFlight current;
+        // indices in current.markers of the open markers
+        std::vector<std::int32_t> open;
+        std::deque<InFlight> in_flight;
+        GpuFrame last;
+        bool has_last = false;
+        std::unordered_map<std::string, Samples> samples;
+    };
+
+    /**
+     * @brief A marker for the rest of a scope
+     *
+     */
+    class GpuScope {
+    public:
+        GpuScope(GpuProfiler& profiler, const char* name);
+        ~GpuScope();
+
+        GpuScope(const GpuScope&) = delete;
+        GpuScope& operator=(const GpuScope&) = delete;
+
+    private:
+        GpuProfiler& profiler;
+    };
+} // namespace gl
+
+#endif
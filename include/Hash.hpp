@@ -0,0 +1,59 @@
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief Compile time string hashing
+ *
+ */
+namespace hash {
+
+    constexpr std::uint32_t FNV1A_32_OFFSET = 0x811c9dc5u;
+    constexpr std::uint32_t FNV1A_32_PRIME = 0x01000193u;
+
+    /**
+     * @brief 32 bit FNV-1a hash of a string
+     *
+     * @param str the string to hash
+     * @param seed the value to start from, pass a previous hash to chain strings
+     * @return the hash
+     */
+    constexpr std::uint32_t fnv1a_32(
+        std::string_view str,
+        std::uint32_t seed = FNV1A_32_OFFSET
+    ) {
+        std::uint32_t h = seed;
+        for (char c : str) {
+            h ^= static_cast<std::uint8_t>(c);
+            h *= FNV1A_32_PRIME;
+        }
+        return h;
+    }
+
+    constexpr std::uint64_t FNV1A_64_OFFSET = 0xcbf29ce484222325ull;
+    constexpr std::uint64_t FNV1A_64_PRIME = 0x00000100000001b3ull;
+
+    /**
+     * @brief 64 bit FNV-1a hash of a string, for content hashes where 32 bits
+     * would collide too easily
+     *
+     * @param str the string to hash
+     * @param seed the value to start from, pass a previous hash to chain strings
+     * @return the hash
+     */
+    constexpr std::uint64_t fnv1a_64(
+        std::string_view str,
+        std::uint64_t seed = FNV1A_64_OFFSET
+    ) {
+        std::uint64_t h = seed;
+        for (char c : str) {
+            h ^= static_cast<std::uint8_t>(c);
+            h *= FNV1A_64_PRIME;
+        }
+        return h;
+    }
+} // namespace hash
+
+#endif
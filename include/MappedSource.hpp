@@ -0,0 +1,50 @@
+#ifndef MAPPEDSOURCE_HPP
+#define MAPPEDSOURCE_HPP
+
+#include <cstddef>
+#include <string_view>
+
+namespace shaders {
+
+    /**
+     * @brief Read-only memory map of a shader source file. The mapping is
+     * released when the object is destroyed, glShaderSource copies the text
+     * so it only has to live until the call returns
+     *
+     */
+    class MappedSource {
+    public:
+        /**
+         * @brief Map a file
+         *
+         * @param path the file path
+         */
+        explicit MappedSource(const char* path);
+        ~MappedSource();
+
+        MappedSource(MappedSource&& other) noexcept;
+        MappedSource& operator=(MappedSource&& other) noexcept;
+
+        MappedSource(const MappedSource&) = delete;
+        MappedSource& operator=(const MappedSource&) = delete;
+
+        /**
+         * @brief Whether the file could be opened, an empty file is open
+         *
+         */
+        bool is_open() const;
+
+        const char* data() const;
+        std::size_t size() const;
+        std::string_view view() const;
+
+    private:
+        void* addr;
+        std::size_t length;
+        bool open;
+
+        void unmap();
+    };
+} // namespace shaders
+
+#endif
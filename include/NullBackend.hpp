@@ -0,0 +1,54 @@
+#ifndef NULLBACKEND_HPP
+#define NULLBACKEND_HPP
+
+#include "glad.h"
+
+#include <cstdint>
+
+namespace gl {
+
+    /**
+     * @brief What has been submitted to the null backend since it was
+     * loaded
+     *
+     */
+    struct NullBackendStats {
+        // draw calls of any kind, a multi-draw counts once
+        std::uint64_t draws = 0;
+        // bytes given to buffer uploads, not writes through mapped buffers
+        std::uint64_t bytes = 0;
+    };
+
+    /**
+     * @brief Fill the glad table with stubs that need no context, so the
+     * CPU side of a render loop can be profiled without a driver below it
+     *
+     * Every entry point does nothing and returns zero, except the ones the
+     * library and the executables depend on. Object names are generated
+     * and deleted, bindings and the viewport are remembered, buffers keep
+     * their data and can be mapped, shaders always compile and programs
+     * always link. Linking scans the GLSL of the attached shaders for
+     * uniforms, uniform blocks (sized by std140 rules) and vertex inputs so
+     * reflection sees what a driver would. Uniform values are not kept,
+     * glGetUniform reads nothing. The table reports GL 4.6 with no
+     * extensions and no program binary formats.
+     *
+     * Load instead of gladLoadGL and before any layer (state cache, trace,
+     * capture), those install over the stubs as they would over a driver.
+     * Calls must be made on one thread.
+     */
+    void load_null_backend();
+
+    /**
+     * @brief Put back the table, GLVersion and version flags from before
+     * load_null_backend() and drop every object
+     *
+     */
+    void unload_null_backend();
+
+    bool null_backend_loaded();
+
+    const NullBackendStats& null_backend_stats();
+} // namespace gl
+
+#endif
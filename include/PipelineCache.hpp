@@ -0,0 +1,132 @@
+#ifndef PIPELINECACHE_HPP
+#define PIPELINECACHE_HPP
+
+#include "glad.h"
+#include "Shaders.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace shaders {
+
+    /**
+     * @brief Whether the context has separable programs and program
+     * pipeline objects (GL 4.1)
+     *
+     */
+    bool pipelines_supported();
+
+    /**
+     * @brief Counters for comparing against linking every pair
+     *
+     */
+    struct PipelineStats {
+        std::size_t stages = 0;
+        std::size_t pipelines = 0;
+        // pipeline() calls answered from the cache
+        std::uint64_t hits = 0;
+        // compiling and linking the separable stage programs
+        std::chrono::nanoseconds stage_time{0};
+        // creating and validating pipeline objects
+        std::chrono::nanoseconds assemble_time{0};
+    };
+
+    /**
+     * @brief Separable single stage programs (GL_PROGRAM_SEPARABLE) and the
+     * program pipelines assembled from them
+     *
+     * Each stage compiles and links once no matter how many stages it is
+     * paired with, and a pipeline for a vertex/fragment pair is created the
+     * first time the pair is asked for. With M vertex and N fragment shaders
+     * that is M + N links instead of M x N. Stages are linked on their own,
+     * so the outputs of one must match the inputs of the next by location
+     * or by name, and vertex shaders past #version 410 have to redeclare
+     * gl_PerVertex. Owns every program and pipeline it creates. Requires a
+     * current GL 4.1 context.
+     */
+    class PipelineCache {
+    public:
+        PipelineCache();
+        ~PipelineCache();
+
+        PipelineCache(const PipelineCache&) = delete;
+        PipelineCache& operator=(const PipelineCache&) = delete;
+
+        bool supported() const;
+
+        /**
+         * @brief Read a source and build it into a separable program
+         *
+         * @param type GL_VERTEX_SHADER or GL_FRAGMENT_SHADER
+         * @param path path to the source code
+         * @return index of the stage in the cache
+         */
+        std::size_t add_stage(GLenum type, const char* path);
+
+        /**
+         * @brief Build a source into a separable program
+         *
+         * @param type GL_VERTEX_SHADER or GL_FRAGMENT_SHADER
+         * @param code the source code
+         * @param label name used in error messages
+         * @return index of the stage in the cache
+         */
+        std::size_t add_stage_source(
+            GLenum type, std::string_view code, std::string label
+        );
+
+        /**
+         * @brief The program of a stage, for reflection and uniforms. Its
+         * uniforms are sent when a pipeline using it is use()d
+         *
+         * @param index stage index
+         */
+        Shader& stage(std::size_t index);
+
+        /**
+         * @brief Get the pipeline for a pair of stages, creating and
+         * validating it the first time
+         *
+         * @param vert index of a vertex stage
+         * @param frag index of a fragment stage
+         * @return the pipeline object, 0 if the stages do not fit together
+         */
+        GLuint pipeline(std::size_t vert, std::size_t frag);
+
+        /**
+         * @brief Bind the pipeline for a pair of stages and flush the
+         * uniforms of both. Unbinds the current program, which would
+         * otherwise take precedence over the pipeline
+         *
+         * @param vert index of a vertex stage
+         * @param frag index of a fragment stage
+         */
+        void use(std::size_t vert, std::size_t frag);
+
+        std::size_t size() const;
+
+        const PipelineStats& stats() const;
+
+    private:
+        struct Stage {
+            std::string label;
+            GLenum type;
+            // index into compile_records()
+            std::size_t record;
+            Shader shader;
+        };
+
+        std::deque<Stage> stages;
+        // keyed on the vertex index in the high half, fragment in the low
+        std::unordered_map<std::uint64_t, GLuint> pipelines;
+        bool separable;
+        PipelineStats counters;
+    };
+} // namespace shaders
+
+#endif
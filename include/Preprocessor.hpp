@@ -0,0 +1,128 @@
+#ifndef PREPROCESSOR_HPP
+#define PREPROCESSOR_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace shaders {
+
+    /**
+     * @brief A set of #defines selecting one variant of a shader
+     *
+     */
+    struct Variant {
+        std::vector<std::pair<std::string, std::string>> defines;
+
+        /**
+         * @brief Permutation key, independent of the order of the defines
+         *
+         */
+        std::uint64_t key() const;
+    };
+
+    /**
+     * @brief Every combination of a set of feature flags, each defined as 1
+     * when enabled. The first variant has no flags set
+     *
+     * @param features the flag names
+     * @return 2^n variants
+     */
+    std::vector<Variant> permutations(const std::vector<std::string>& features);
+
+    /**
+     * @brief Shader text ready for glShaderSource
+     *
+     */
+    struct PreprocessedSource {
+        std::string code;
+        // "#line L S" directives use S as an index into files
+        std::vector<std::string> files;
+    };
+
+    /**
+     * @brief Rewrite "S:L" / "S(L)" locations in a driver info log to
+     * "file:L" using the file table of a preprocessed source
+     *
+     * @param log the info log
+     * @param files the file table
+     * @return the rewritten log
+     */
+    std::string remap_log(std::string_view log, const std::vector<std::string>& files);
+
+    /**
+     * @brief Resolves #include directives and injects #defines
+     *
+     * Includes are looked up next to the including file, then under the
+     * root directory. A file containing "#pragma once" is only included
+     * once. Every file is read once per Preprocessor however many variants
+     * are built from it, and each variant's text is cached by key. Not
+     * thread safe.
+     */
+    class Preprocessor {
+    public:
+        /**
+         * @brief Construct a new Preprocessor object
+         *
+         * @param root directory includes are resolved against
+         */
+        explicit Preprocessor(std::filesystem::path root = "shaders");
+
+        /**
+         * @brief Preprocess one variant of a source file
+         *
+         * @param path the file path
+         * @param variant the defines to inject after #version
+         * @return the cached result, valid until clear()
+         */
+        const PreprocessedSource& process(
+            const std::string& path, const Variant& variant = {}
+        );
+
+        /**
+         * @brief Preprocess many variants of a source file from one read
+         *
+         * @param path the file path
+         * @param variants the variants
+         * @return the cached results in the order of variants
+         */
+        std::vector<const PreprocessedSource*> process_all(
+            const std::string& path, const std::vector<Variant>& variants
+        );
+
+        const std::filesystem::path& root() const;
+
+        /**
+         * @brief Forget every file and variant, for when sources change
+         *
+         */
+        void clear();
+
+    private:
+        struct Expanded {
+            std::string version;
+            std::string body;
+            std::vector<std::string> files;
+        };
+
+        std::filesystem::path include_root;
+        std::unordered_map<std::string, Expanded> expanded;
+        std::unordered_map<std::uint64_t, PreprocessedSource> variants;
+
+        const Expanded& expand(const std::string& path);
+        bool expand_file(
+            const std::filesystem::path& path, Expanded& out,
+            std::vector<std::filesystem::path>& stack,
+            std::vector<std::filesystem::path>& once
+        );
+        std::filesystem::path resolve(
+            const std::filesystem::path& from, const std::string& name
+        ) const;
+    };
+} // namespace shaders
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef PROGRAMCACHE_HPP
+#define PROGRAMCACHE_HPP
+
+#include "glad.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+
+namespace shaders {
+
+    /**
+     * @brief Counters for confirming the cache actually saves time
+     *
+     */
+    struct ProgramCacheStats {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t rejected = 0;
+        std::uint64_t stored = 0;
+        std::chrono::nanoseconds load_time{0};
+        std::chrono::nanoseconds time_saved{0};
+    };
+
+    /**
+     * @brief On-disk cache of linked program binaries
+     * (glGetProgramBinary/glProgramBinary, GL 4.1)
+     *
+     * Entries are keyed on a hash of the sources and the driver's vendor,
+     * renderer and version strings, so a driver update never loads a stale
+     * binary. When binaries are not supported every lookup is a miss.
+     * Requires a current context.
+     */
+    class ProgramCache {
+    public:
+        /**
+         * @brief Construct a new ProgramCache object
+         *
+         * @param dir the directory to keep binaries in, created if missing
+         */
+        explicit ProgramCache(std::filesystem::path dir);
+
+        /**
+         * @brief Whether the context can save and load program binaries
+         *
+         */
+        bool supported() const;
+
+        /**
+         * @brief Compute the cache key for a pair of sources
+         *
+         * @param v_code vertex source code
+         * @param f_code fragment source code
+         * @return the key
+         */
+        std::uint64_t key(std::string_view v_code, std::string_view f_code) const;
+
+        /**
+         * @brief Create a program from a cached binary
+         *
+         * @param key the cache key
+         * @return the linked program or 0 on a miss. Entries the driver
+         * rejects or that are corrupt are deleted and counted as rejected
+         */
+        GLuint load(std::uint64_t key);
+
+        /**
+         * @brief Save the binary of a linked program
+         *
+         * @param key the cache key
+         * @param prgm the program, ignored if it failed to link
+         * @param build_time how long compiling and linking took, used to
+         * report time saved by later hits
+         */
+        void store(
+            std::uint64_t key, GLuint prgm, std::chrono::nanoseconds build_time
+        );
+
+        const ProgramCacheStats& stats() const;
+
+    private:
+        std::filesystem::path dir;
+        std::uint64_t driver_hash;
+        bool binary_supported;
+        ProgramCacheStats counters;
+
+        std::filesystem::path entry_path(std::uint64_t key) const;
+    };
+} // namespace shaders
+
+#endif
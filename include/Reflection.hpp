@@ -0,0 +1,128 @@
+#ifndef REFLECTION_HPP
+#define REFLECTION_HPP
+
+#include "glad.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace shaders {
+
+    /**
+     * @brief An active attribute or uniform of a linked program
+     *
+     */
+    struct ActiveVariable {
+        std::string name;
+        // -1 for uniforms inside a block
+        GLint location;
+        GLenum type;
+        // array length, 1 otherwise
+        GLint size;
+    };
+
+    /**
+     * @brief An active uniform block of a linked program
+     *
+     */
+    struct ActiveBlock {
+        std::string name;
+        GLuint index;
+        GLuint binding;
+        GLint data_size;
+    };
+
+    /**
+     * @brief Everything a linked program takes as input
+     *
+     */
+    struct Reflection {
+        std::vector<ActiveVariable> attributes;
+        std::vector<ActiveVariable> uniforms;
+        std::vector<ActiveBlock> blocks;
+    };
+
+    /**
+     * @brief Query the active attributes, uniforms and uniform blocks of a
+     * linked program
+     *
+     * @param prgm the program object
+     * @return the reflection, empty if the program did not link
+     */
+    Reflection reflect(GLuint prgm);
+
+    /**
+     * @brief One attribute in a vertex buffer
+     *
+     */
+    struct VertexAttribute {
+        // the attribute name in the vertex shader
+        std::string name;
+        GLint components;
+        GLenum type = GL_FLOAT;
+        bool normalized = false;
+        std::size_t offset = 0;
+    };
+
+    /**
+     * @brief How a mesh lays out its vertices in one buffer
+     *
+     */
+    struct VertexFormat {
+        // bytes between vertices, 0 when tightly packed
+        std::size_t stride;
+        std::vector<VertexAttribute> attributes;
+
+        std::uint64_t key() const;
+    };
+
+    /**
+     * @brief One glVertexAttribPointer call
+     *
+     */
+    struct VertexBinding {
+        GLuint location;
+        GLint components;
+        GLenum type;
+        bool normalized;
+        // glVertexAttribIPointer
+        bool integer;
+        GLsizei stride;
+        std::size_t offset;
+    };
+
+    /**
+     * @brief A vertex format resolved against a program's attributes
+     *
+     */
+    struct VertexLayout {
+        // every attribute the program reads is provided and compatible
+        bool valid = false;
+        std::vector<VertexBinding> bindings;
+
+        /**
+         * @brief Point the bound vertex array's attributes at the buffer
+         * bound to GL_ARRAY_BUFFER and enable them
+         *
+         */
+        void apply() const;
+    };
+
+    /**
+     * @brief Match a vertex format against the attributes of a program by
+     * name. Missing attributes and mismatched types are printed as errors
+     * here, when the mesh is loaded, instead of showing up as garbage on
+     * screen. Attributes the program does not read are ignored
+     *
+     * @param reflection the program
+     * @param format the mesh's vertex format
+     * @return the layout, not valid if anything did not match
+     */
+    VertexLayout match_vertex_format(
+        const Reflection& reflection, const VertexFormat& format
+    );
+} // namespace shaders
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef SHADERLIBRARY_HPP
+#define SHADERLIBRARY_HPP
+
+#include "glad.h"
+#include "Shaders.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace shaders {
+
+    /**
+     * @brief Wall clock timings of a batch of programs
+     *
+     */
+    struct LibraryTimings {
+        std::size_t programs = 0;
+        // time spent inside add() and submit()
+        std::chrono::nanoseconds submit{0};
+        // time spent waiting on status queries when programs were first used
+        std::chrono::nanoseconds wait{0};
+        // first add() to the last program becoming usable
+        std::chrono::nanoseconds wall{0};
+    };
+
+    /**
+     * @brief Builds many programs at once without blocking on each one
+     *
+     * add() starts compiling both stages and submit() starts every pending
+     * link, but nothing queries GL_COMPILE_STATUS or GL_LINK_STATUS until a
+     * program is needed through get(). The driver is then free to compile in
+     * the background and, with GL_KHR_parallel_shader_compile, in parallel;
+     * ready() asks the driver without blocking.
+     */
+    class ShaderLibrary {
+    public:
+        ShaderLibrary();
+        ~ShaderLibrary();
+
+        ShaderLibrary(const ShaderLibrary&) = delete;
+        ShaderLibrary& operator=(const ShaderLibrary&) = delete;
+
+        /**
+         * @brief Read both sources and start compiling them
+         *
+         * @param v_path path to vertex source code
+         * @param f_path path to fragment source code
+         * @return index of the program in the library
+         */
+        std::size_t add(const char* v_path, const char* f_path);
+
+        /**
+         * @brief Start compiling a vertex and fragment source pair
+         *
+         * @param v_code vertex source code
+         * @param f_code fragment source code
+         * @param label name used in error messages
+         * @return index of the program in the library
+         */
+        std::size_t add_source(
+            std::string_view v_code, std::string_view f_code,
+            std::string label
+        );
+
+        /**
+         * @brief Start linking every program that has not been linked yet
+         *
+         */
+        void submit();
+
+        /**
+         * @brief Whether get() can return without waiting on the driver.
+         * Without GL_KHR_parallel_shader_compile this cannot be known and
+         * any linked program counts as ready
+         *
+         * @param index program index
+         */
+        bool ready(std::size_t index) const;
+
+        /**
+         * @brief Get a program, checking its compile and link status the
+         * first time. Blocks until the driver is done with it
+         *
+         * @param index program index
+         * @return the shader
+         */
+        Shader& get(std::size_t index);
+
+        /**
+         * @brief Submit and check every program in the library
+         *
+         */
+        void finish();
+
+        std::size_t size() const;
+
+        /**
+         * @brief Whether the driver reports GL_KHR_parallel_shader_compile
+         *
+         */
+        bool parallel() const;
+
+        const LibraryTimings& timings() const;
+
+    private:
+        struct Entry {
+            std::string label;
+            GLuint vert = 0;
+            GLuint frag = 0;
+            GLuint prgm = 0;
+            // index into compile_records()
+            std::size_t record = 0;
+            std::optional<Shader> shader;
+        };
+
+        std::deque<Entry> entries;
+        bool parallel_compile;
+        LibraryTimings times;
+        std::chrono::steady_clock::time_point first_add;
+
+        void link(Entry& entry);
+        void check(Entry& entry);
+    };
+} // namespace shaders
+
+#endif
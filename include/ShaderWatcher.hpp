@@ -0,0 +1,88 @@
+#ifndef SHADERWATCHER_HPP
+#define SHADERWATCHER_HPP
+
+#include "Shaders.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace shaders {
+
+    /**
+     * @brief Reloads shaders when their source files change (Linux, inotify)
+     *
+     * A background thread waits for writes to the watched sources, including
+     * files pulled in by #include, then reads and preprocesses the new text.
+     * The render thread calls poll() once per frame, which is a single atomic
+     * load until something has changed; the relink and swap happen inside
+     * poll() so a program never changes mid-frame. A source that fails to
+     * compile leaves the old program running.
+     */
+    class ShaderWatcher {
+    public:
+        ShaderWatcher();
+        ~ShaderWatcher();
+
+        ShaderWatcher(const ShaderWatcher&) = delete;
+        ShaderWatcher& operator=(const ShaderWatcher&) = delete;
+
+        /**
+         * @brief Reload a shader whenever one of its sources changes. The
+         * shader must outlive the watcher or be passed to unwatch()
+         *
+         * @param shader a shader built from files
+         */
+        void watch(Shader& shader);
+
+        /**
+         * @brief Stop watching a shader
+         *
+         * @param shader the shader
+         */
+        void unwatch(Shader& shader);
+
+        /**
+         * @brief Swap in any reloaded programs. Call from the render thread
+         * at a frame boundary
+         *
+         * @return the number of programs replaced
+         */
+        std::size_t poll();
+
+    private:
+        struct Watched {
+            Shader* shader;
+            SourceInfo info;
+            std::vector<std::filesystem::path> files;
+        };
+
+        struct Pending {
+            Shader* shader;
+            PreprocessedSource v;
+            PreprocessedSource f;
+        };
+
+        int inotify_fd;
+        int wake_fd;
+        std::thread worker;
+
+        std::mutex mutex;
+        std::vector<Watched> watched;
+        std::map<int, std::filesystem::path> dirs;
+        std::vector<Pending> pending;
+        std::atomic<bool> changed;
+
+        void watch_files(Watched& entry);
+        void watch_dir(const std::filesystem::path& dir);
+        void run();
+        void reload(const std::vector<std::filesystem::path>& paths);
+    };
+} // namespace shaders
+
+#endif
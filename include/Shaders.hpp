@@ -2,8 +2,23 @@
 #define SHADERS_HPP
 
 #include "glad.h"
+#include "Bindings.hpp"
+#include "CompileRecords.hpp"
+#include "Hash.hpp"
+#include "Preprocessor.hpp"
+#include "Reflection.hpp"
 
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 /**
  * @brief Reading, compiling and linking shaders
@@ -11,6 +26,8 @@
  */
 namespace shaders {
 
+    class ProgramCache;
+
     /**
      * @brief Read a shader file
      * 
@@ -25,7 +42,7 @@ namespace shaders {
      * @param shader the shader onj int
      * @param shader_string the shader code
      */
-    void shader_source(GLuint shader, const std::string& shader_string);
+    void shader_source(GLuint shader, std::string_view shader_string);
 
     /**
      * @brief Attach vertex shader source code to a shader object and compile
@@ -35,6 +52,71 @@ namespace shaders {
      */
     void load_shader(GLuint shader_obj, const char *path);
 
+    /**
+     * @brief Precomputed handle to a uniform, see uniform()
+     * 
+     */
+    struct UniformHandle {
+        std::uint32_t hash;
+    };
+
+    /**
+     * @brief Hash a uniform name into a handle. Usable at compile time so
+     * render loops can look uniforms up without touching the name. A handle
+     * does not find either of two uniforms whose names hash the same, look
+     * those up by name
+     * 
+     * @param name the uniform name as declared in the shader
+     * @return the handle
+     */
+    constexpr UniformHandle uniform(std::string_view name) {
+        return UniformHandle{hash::fnv1a_32(name)};
+    }
+
+    /**
+     * @brief Uniform write counts of a Shader, see Shader::flush()
+     * 
+     */
+    struct UniformStats {
+        // set_* calls
+        std::size_t requested = 0;
+        // writes that never reached the driver, because the value was
+        // already set or was replaced before the flush
+        std::size_t elided = 0;
+        // glUniform* calls made
+        std::size_t issued = 0;
+    };
+
+    /**
+     * @brief Where a Shader's sources came from, so they can be read again
+     * 
+     */
+    struct SourceInfo {
+        std::string v_path;
+        std::string f_path;
+        bool preprocessed = false;
+        std::filesystem::path include_root;
+        Variant variant;
+        // every file read, including ones pulled in by #include
+        std::vector<std::string> files;
+    };
+
+    /**
+     * @brief Both sources of a program in memory, ready to compile. See
+     * SourceLoader for reading them off the context thread
+     * 
+     */
+    struct ProgramSources {
+        SourceInfo info;
+        // files only set when preprocessed
+        PreprocessedSource vert;
+        PreprocessedSource frag;
+        // both files were found
+        bool ok = false;
+        std::chrono::nanoseconds read{0};
+        std::chrono::nanoseconds preprocess{0};
+    };
+
     /**
      * @brief Class for reading, compiling and linking shaders on initialization
      * 
@@ -52,34 +134,344 @@ namespace shaders {
         Shader(const char* v_path, const char* f_path);
 
         /**
-         * @brief Use/activate the shader
+         * @brief Construct a new Shader object, loading the linked program
+         * from a binary cache when possible and storing it on a miss
+         * 
+         * @param v_path path to vertex source code
+         * @param f_path path to fragment source code
+         * @param cache the program binary cache
+         */
+        Shader(const char* v_path, const char* f_path, ProgramCache& cache);
+
+        /**
+         * @brief Construct a new Shader object from preprocessed sources.
+         * Compile errors point at the original files
+         * 
+         * @param v_path path to vertex source code
+         * @param f_path path to fragment source code
+         * @param preprocessor resolves #include and injects the defines
+         * @param variant the defines
+         */
+        Shader(
+            const char* v_path, const char* f_path,
+            Preprocessor& preprocessor, const Variant& variant = {}
+        );
+
+        /**
+         * @brief Construct a new Shader object from sources already in
+         * memory. Only compiles and links
+         * 
+         * @param sources the sources, e.g. from SourceLoader::load()
+         */
+        explicit Shader(const ProgramSources& sources);
+
+        /**
+         * @brief Construct a new Shader object from sources already in
+         * memory, loading the linked program from a binary cache when
+         * possible and storing it on a miss
+         * 
+         * @param sources the sources
+         * @param cache the program binary cache
+         */
+        Shader(const ProgramSources& sources, ProgramCache& cache);
+
+        /**
+         * @brief Wrap an already linked program and cache its uniforms
+         * 
+         * @param prgm the program object
+         * @param record index of the program's compile record, if it was
+         * built by the library
+         */
+        explicit Shader(GLuint prgm, std::optional<std::size_t> record = std::nullopt);
+
+        /**
+         * @brief Replace the program with one built from new sources. If the
+         * new sources fail to compile or link the current program is kept.
+         * Changes id on success
+         * 
+         * @param v_code vertex source code
+         * @param f_code fragment source code
+         * @return whether the program was replaced
+         */
+        bool reload(const std::string& v_code, const std::string& f_code);
+
+        /**
+         * @brief Replace the program with one built from new preprocessed
+         * sources, see reload(const std::string&, const std::string&)
+         * 
+         * @param v vertex source
+         * @param f fragment source
+         * @return whether the program was replaced
+         */
+        bool reload(const PreprocessedSource& v, const PreprocessedSource& f);
+
+        /**
+         * @brief Where the sources came from, empty paths when the shader
+         * wraps an existing program
+         * 
+         */
+        const SourceInfo& sources() const;
+
+        /**
+         * @brief Timings and info logs of the build that produced the
+         * current program, see CompileRecords.hpp
+         * 
+         * @return the record, nullptr when the shader wraps an existing
+         * program
+         */
+        const ProgramRecord* build_record() const;
+        ProgramRecord* build_record();
+
+        /**
+         * @brief Use/activate the shader and flush() its uniforms
          * 
          */
         void use();
 
+        /**
+         * @brief Send every uniform that changed since the last flush to
+         * the driver, one call per changed uniform. The program must be
+         * current; use() flushes, so only uniforms set after use() need an
+         * explicit flush before drawing
+         * 
+         */
+        void flush();
+
+        const UniformStats& uniform_stats() const;
+        void reset_uniform_stats();
+
+        /**
+         * @brief Look up a uniform location in the cache populated at link
+         * time. Does not query the driver
+         * 
+         * @param name uniform name
+         * @return the location or -1 if the uniform is not active
+         */
+        GLint uniform_location(std::string_view name) const;
+
+        /**
+         * @brief Look up a uniform location in the cache populated at link
+         * time. Does not query the driver
+         * 
+         * @param handle uniform handle
+         * @return the location or -1 if the uniform is not active
+         */
+        GLint uniform_location(UniformHandle handle) const;
+
+        /**
+         * @brief Point a uniform block at a uniform buffer binding. Every
+         * block is already bound to block_binding() of its name on link,
+         * this overrides it until the next link
+         * 
+         * @param name block name
+         * @param binding the binding point
+         * @return whether the program has an active block with that name
+         */
+        bool bind_uniform_block(const char* name, GLuint binding);
+
+        /**
+         * @brief The active attributes, uniforms and uniform blocks, queried
+         * once after every link
+         * 
+         */
+        const Reflection& reflection() const;
+
+        /**
+         * @brief Match a vertex format against the program's attributes.
+         * The result is cached per format until the program is relinked;
+         * mismatches are reported on the first call
+         * 
+         * @param format the mesh's vertex format
+         * @return the layout to apply() to the mesh's vertex array
+         */
+        const VertexLayout& vertex_layout(const VertexFormat& format);
+
+        /**
+         * @brief Uniform utility function. Values are kept in a shadow copy
+         * and sent on the next flush() only if they differ from what the
+         * program already holds
+         * 
+         * @param name uniform name
+         * @param val the value to set
+         */
+        void set_bool(std::string_view name, bool val);
+        void set_bool(UniformHandle handle, bool val);
+
         /**
          * @brief Uniform utility function
          * 
-         * @param name shader name
+         * @param name uniform name
          * @param val the value to set
          */
-        void set_bool(const std::string& name, bool val) const;
+        void set_int(std::string_view name, int val);
+        void set_int(UniformHandle handle, int val);
 
         /**
          * @brief Uniform utility function
          * 
-         * @param name shader name
+         * @param name uniform name
          * @param val the value to set
          */
-        void set_int(const std::string& name, int val) const;
+        void set_float(std::string_view name, float val);
+        void set_float(UniformHandle handle, float val);
 
         /**
          * @brief Uniform utility function
          * 
-         * @param name shader name
+         * @param name uniform name
+         * @param x, y, z, w the values to set
+         */
+        void set_vec4(std::string_view name, float x, float y, float z, float w);
+        void set_vec4(UniformHandle handle, float x, float y, float z, float w);
+
+        /**
+         * @brief Typed uniform utility functions for the handles generated
+         * into bindings/, see Bindings.hpp. Only the setter matching the
+         * uniform's GLSL type compiles. A uniform with a layout location is
+         * found by it, without hashing
+         * 
+         * @param u the uniform
          * @param val the value to set
          */
-        void set_float(const std::string& name, float val) const;
+        void set_bool(Uniform<bool> u, bool val);
+        void set_int(Uniform<int> u, int val);
+        void set_float(Uniform<float> u, float val);
+        void set_vec4(Uniform<std140::vec4> u, float x, float y, float z, float w);
+
+        void set(Uniform<bool> u, bool val);
+        void set(Uniform<int> u, int val);
+        void set(Uniform<unsigned int> u, unsigned int val);
+        void set(Uniform<float> u, float val);
+        void set(Uniform<std140::vec2> u, const std140::vec2& val);
+        void set(Uniform<std140::vec3> u, const std140::vec3& val);
+        void set(Uniform<std140::vec4> u, const std140::vec4& val);
+        void set(Uniform<std140::ivec2> u, const std140::ivec2& val);
+        void set(Uniform<std140::ivec4> u, const std140::ivec4& val);
+        void set(Uniform<std140::mat3> u, const std140::mat3& val);
+        void set(Uniform<std140::mat4> u, const std140::mat4& val);
+
+        template <typename T>
+        GLint uniform_location(Uniform<T> u) const {
+            std::uint32_t slot = find_slot(u);
+            return slot != NO_SLOT ? values[slot].location : -1;
+        }
+
+    private:
+        /**
+         * @brief Entry in the uniform table, sorted by name hash
+         * 
+         */
+        struct UniformEntry {
+            std::uint32_t hash;
+            std::uint32_t slot;
+            // index into uniform_names, compared on lookups by name
+            std::uint32_t name;
+        };
+
+        enum class UniformKind : std::uint8_t {
+            int1,
+            int2,
+            int4,
+            uint1,
+            float1,
+            float2,
+            float3,
+            float4,
+            mat3,
+            mat4
+        };
+
+        // a value's bits, matrices packed by column without std140 padding
+        using UniformBits = std::array<std::uint32_t, 16>;
+
+        static constexpr std::uint32_t NO_SLOT = UINT32_MAX;
+
+        /**
+         * @brief Shadow copy of one uniform location. "name" and "name[0]"
+         * share a slot
+         * 
+         */
+        struct UniformValue {
+            GLint location;
+            UniformKind kind;
+            // current holds the value in the program
+            bool known;
+            // in dirty, waiting for flush()
+            bool queued;
+            UniformBits current;
+            UniformBits pending;
+        };
+
+        std::vector<UniformEntry> uniforms;
+        std::vector<std::string> uniform_names;
+        std::vector<UniformValue> values;
+        // slot of each location, NO_SLOT where there is none
+        std::vector<std::uint32_t> location_slots;
+        std::vector<std::uint32_t> dirty;
+        UniformStats stats;
+        SourceInfo info;
+        Reflection reflected;
+        // deque so references handed out stay valid
+        std::deque<std::pair<std::uint64_t, VertexLayout>> layouts;
+        // index into compile_records()
+        std::optional<std::size_t> record;
+        // the next use() is timed into the record
+        bool first_use = false;
+
+        /**
+         * @brief Reflect the newly linked program, bind its uniform blocks
+         * and rebuild the uniform table
+         * 
+         */
+        void reflect_program();
+
+        /**
+         * @brief Build the name hash to location table from the reflected
+         * uniforms
+         * 
+         */
+        void cache_uniforms();
+
+        /**
+         * @brief The shadow slot of a uniform
+         * 
+         * @return NO_SLOT if the uniform is not active
+         */
+        std::uint32_t find_slot(UniformHandle handle) const;
+        std::uint32_t find_slot(std::string_view name, std::uint32_t hash) const;
+        std::uint32_t find_slot(GLint location) const;
+
+        std::uint32_t find_slot(std::string_view name) const {
+            return find_slot(name, hash::fnv1a_32(name));
+        }
+
+        template <typename T>
+        std::uint32_t find_slot(Uniform<T> u) const {
+            return u.location >= 0 ? find_slot(u.location) : find_slot(u.name, u.hash);
+        }
+
+        /**
+         * @brief Queue a value unless the program already has it
+         * 
+         */
+        void set_value(std::uint32_t slot, UniformKind kind, const UniformBits& bits);
+        void set_value(UniformHandle handle, UniformKind kind, const UniformBits& bits);
+
+        /**
+         * @brief Take over a newly linked program, or delete it and keep the
+         * current one if it failed to link
+         * 
+         */
+        bool swap_program(GLuint prgm);
+
+        void set_files(const PreprocessedSource& v, const PreprocessedSource& f);
+
+        /**
+         * @brief Add a compile record for a build from info's paths and
+         * make it the shader's record
+         * 
+         */
+        ProgramRecord& start_record();
     };
 } // namespace shaders
 
@@ -0,0 +1,105 @@
+#ifndef SOURCELOADER_HPP
+#define SOURCELOADER_HPP
+
+#include "Preprocessor.hpp"
+#include "Shaders.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace shaders {
+
+    /**
+     * @brief Read both sources of a program into memory. Makes no GL calls
+     *
+     * @param v_path path to vertex source code
+     * @param f_path path to fragment source code
+     * @return the sources, not ok if either file is missing
+     */
+    ProgramSources read_sources(const std::string& v_path, const std::string& f_path);
+
+    /**
+     * @brief Read and preprocess both sources of a program with a
+     * Preprocessor of its own. Makes no GL calls
+     *
+     * @param v_path path to vertex source code
+     * @param f_path path to fragment source code
+     * @param include_root directory includes are resolved against
+     * @param variant the defines
+     * @return the sources
+     */
+    ProgramSources preprocess_sources(
+        const std::string& v_path, const std::string& f_path,
+        const std::filesystem::path& include_root, const Variant& variant = {}
+    );
+
+    /**
+     * @brief Reads and preprocesses shader sources on worker threads
+     *
+     * load() can be called before the window and context exist, so the file
+     * reads overlap with context creation. The futures are then passed to
+     * the ProgramSources constructors of Shader on the context thread, which
+     * only compile and link. Pending loads are finished before the loader
+     * is destroyed.
+     */
+    class SourceLoader {
+    public:
+        /**
+         * @brief Start the workers
+         *
+         * @param threads number of workers, 0 for one per core up to 4.
+         * Reads are I/O bound, more rarely helps
+         */
+        explicit SourceLoader(unsigned threads = 0);
+        ~SourceLoader();
+
+        SourceLoader(const SourceLoader&) = delete;
+        SourceLoader& operator=(const SourceLoader&) = delete;
+
+        /**
+         * @brief Start reading both sources of a program, see read_sources()
+         *
+         * @param v_path path to vertex source code
+         * @param f_path path to fragment source code
+         * @return the sources once read
+         */
+        std::future<ProgramSources> load(std::string v_path, std::string f_path);
+
+        /**
+         * @brief Start reading and preprocessing both sources of a program,
+         * see preprocess_sources()
+         *
+         * @param v_path path to vertex source code
+         * @param f_path path to fragment source code
+         * @param include_root directory includes are resolved against
+         * @param variant the defines
+         * @return the sources once preprocessed
+         */
+        std::future<ProgramSources> load(
+            std::string v_path, std::string f_path,
+            std::filesystem::path include_root, Variant variant = {}
+        );
+
+        std::size_t threads() const;
+
+    private:
+        std::vector<std::thread> workers;
+
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::deque<std::packaged_task<ProgramSources()>> jobs;
+        bool stopping;
+
+        std::future<ProgramSources> submit(std::packaged_task<ProgramSources()> job);
+        void run();
+    };
+} // namespace shaders
+
+#endif
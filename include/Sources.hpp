@@ -0,0 +1,61 @@
+#ifndef SOURCES_HPP
+#define SOURCES_HPP
+
+#include "MappedSource.hpp"
+
+#include <optional>
+#include <string_view>
+
+namespace shaders {
+
+    /**
+     * @brief Look up a file compiled into the library from shaders/ at build
+     * time. Never touches the filesystem
+     *
+     * @param path the path relative to the repository, e.g.
+     * "shaders/HelloUniforms.vert"
+     * @return the source, or nothing if the file was not embedded
+     */
+    std::optional<std::string_view> embedded_source(std::string_view path);
+
+    /**
+     * @brief Whether sources are read from disk instead of the embedded
+     * copies. Defaults to true when LEARN_OPENGL_SHADERS_FROM_DISK is set in
+     * the environment or the library was built with hot reload
+     *
+     */
+    bool disk_sources();
+
+    /**
+     * @brief Read sources from disk (dev mode) or from the embedded copies
+     *
+     * @param from_disk true to read from disk
+     */
+    void set_disk_sources(bool from_disk);
+
+    /**
+     * @brief The text of a shader source, embedded when available and
+     * otherwise memory mapped from disk. Paths that were not embedded always
+     * come from disk
+     *
+     */
+    class SourceText {
+    public:
+        /**
+         * @brief Find a source
+         *
+         * @param path the file path
+         */
+        explicit SourceText(const char* path);
+
+        bool is_open() const;
+        bool embedded() const;
+        std::string_view view() const;
+
+    private:
+        std::optional<MappedSource> mapped;
+        std::string_view text;
+    };
+} // namespace shaders
+
+#endif
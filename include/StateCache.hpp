@@ -0,0 +1,60 @@
+#ifndef STATECACHE_HPP
+#define STATECACHE_HPP
+
+#include "glad.h"
+
+#include <cstddef>
+
+/**
+ * @brief Layers over the glad function pointers
+ *
+ */
+namespace gl {
+
+    /**
+     * @brief Calls seen by the state cache
+     *
+     */
+    struct StateCacheStats {
+        // calls passed on to the driver
+        std::size_t forwarded = 0;
+        // calls dropped because they would not change the state
+        std::size_t elided = 0;
+    };
+
+    /**
+     * @brief Replace the bind and enable functions in the glad table with
+     * versions that drop calls which would not change the current state
+     *
+     * Covers glUseProgram, glBindVertexArray, glBindBuffer (and the indexed
+     * glBindBufferBase/Range, which also set the generic binding),
+     * glBindTexture, glActiveTexture, glBindFramebuffer and glEnable/
+     * glDisable for the common capabilities. The glDelete* functions for
+     * the tracked objects are wrapped as well, since deleting a bound
+     * object unbinds it. Install after glad has loaded and on the thread
+     * that owns the context; the cache and its stats are that thread's.
+     * Everything starts out unknown, so the first call of each kind always
+     * reaches the driver.
+     */
+    void install_state_cache();
+
+    /**
+     * @brief Put the original glad pointers back
+     *
+     */
+    void uninstall_state_cache();
+
+    bool state_cache_installed();
+
+    /**
+     * @brief Forget all tracked state. Call after code that bypasses the
+     * glad table, e.g. a library with its own loader, has touched GL
+     *
+     */
+    void invalidate_state_cache();
+
+    const StateCacheStats& state_cache_stats();
+    void reset_state_cache_stats();
+} // namespace gl
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef STD140_HPP
+#define STD140_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief C++ types laid out like GLSL std140 uniform blocks
+ *
+ * Members of a block are declared with these types and the block's GLSL
+ * layout is described once with Layout<...>; STD140_CHECK then proves at
+ * compile time that every member sits at its std140 offset. Blocks are
+ * declared alignas(16) so their size matches the std140 block size.
+ *
+ *     struct alignas(16) Block {
+ *         using layout = std140::Layout<std140::mat4, std140::vec3, float>;
+ *         std140::mat4 model;
+ *         std140::vec3 tint;  // 16 bytes in C++, see vec3
+ *         float gain;         // std140 puts this at 76, C++ at 80: error
+ *     };
+ *     STD140_CHECK(Block, gain, 2);
+ */
+namespace std140 {
+
+    constexpr std::size_t round_up(std::size_t n, std::size_t align) {
+        return (n + align - 1) / align * align;
+    }
+
+    struct alignas(8) vec2 {
+        float x, y;
+    };
+
+    /**
+     * @brief sizeof is 16 because of the alignment. std140 lets a scalar
+     * follow in the last 4 bytes, C++ cannot; follow a vec3 with padding
+     * or another 16 byte aligned member
+     *
+     */
+    struct alignas(16) vec3 {
+        float x, y, z;
+    };
+
+    struct alignas(16) vec4 {
+        float x, y, z, w;
+    };
+
+    struct alignas(8) ivec2 {
+        std::int32_t x, y;
+    };
+
+    struct alignas(16) ivec4 {
+        std::int32_t x, y, z, w;
+    };
+
+    // GLSL bool is 4 bytes in a block
+    using boolean = std::uint32_t;
+
+    // column major, each column padded to a vec4
+    struct alignas(16) mat3 {
+        vec4 cols[3];
+    };
+
+    struct alignas(16) mat4 {
+        vec4 cols[4];
+    };
+
+    /**
+     * @brief std140 array, every element starts on a 16 byte boundary
+     *
+     */
+    template <typename T, std::size_t N>
+    struct alignas(16) array {
+        struct alignas(16) element {
+            T value;
+        };
+        element items[N];
+
+        T& operator[](std::size_t i) { return items[i].value; }
+        const T& operator[](std::size_t i) const { return items[i].value; }
+    };
+
+    /**
+     * @brief std140 base alignment and size of a member type
+     *
+     */
+    template <typename T>
+    struct traits;
+
+    template <std::size_t Align, std::size_t Size>
+    struct basic_traits {
+        static constexpr std::size_t align = Align;
+        static constexpr std::size_t size = Size;
+    };
+
+    template <> struct traits<float> : basic_traits<4, 4> {};
+    template <> struct traits<std::int32_t> : basic_traits<4, 4> {};
+    template <> struct traits<std::uint32_t> : basic_traits<4, 4> {};
+    template <> struct traits<vec2> : basic_traits<8, 8> {};
+    template <> struct traits<vec3> : basic_traits<16, 12> {};
+    template <> struct traits<vec4> : basic_traits<16, 16> {};
+    template <> struct traits<ivec2> : basic_traits<8, 8> {};
+    template <> struct traits<ivec4> : basic_traits<16, 16> {};
+    template <> struct traits<mat3> : basic_traits<16, 48> {};
+    template <> struct traits<mat4> : basic_traits<16, 64> {};
+
+    template <typename T, std::size_t N>
+    struct traits<array<T, N>>
+        : basic_traits<16, N * round_up(traits<T>::size, 16)> {};
+
+    /**
+     * @brief The std140 offsets and size of a block with members of the
+     * given types, in declaration order
+     *
+     */
+    template <typename... Ts>
+    struct Layout {
+        static constexpr std::size_t count = sizeof...(Ts);
+
+        static constexpr std::array<std::size_t, count> offsets = [] {
+            std::array<std::size_t, count> out{};
+            std::size_t offset = 0;
+            std::size_t i = 0;
+            ((offset = round_up(offset, traits<Ts>::align),
+              out[i++] = offset,
+              offset += traits<Ts>::size), ...);
+            return out;
+        }();
+
+        static constexpr std::size_t size = [] {
+            std::size_t offset = 0;
+            ((offset = round_up(offset, traits<Ts>::align) + traits<Ts>::size), ...);
+            return round_up(offset, 16);
+        }();
+
+        static constexpr std::size_t offset(std::size_t i) {
+            return offsets[i];
+        }
+    };
+} // namespace std140
+
+/**
+ * @brief Fail to compile unless a member is at the offset std140 gives the
+ * index-th type of Struct::layout
+ *
+ */
+#define STD140_CHECK(Struct, member, index) \
+    static_assert( \
+        offsetof(Struct, member) == Struct::layout::offset(index), \
+        #Struct "::" #member " is not at its std140 offset" \
+    )
+
+/**
+ * @brief Fail to compile unless the whole block has the std140 size
+ *
+ */
+#define STD140_CHECK_SIZE(Struct) \
+    static_assert( \
+        sizeof(Struct) == Struct::layout::size, \
+        #Struct " does not have its std140 size" \
+    )
+
+#endif
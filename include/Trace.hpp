@@ -0,0 +1,107 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include "glad.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <ostream>
+#include <vector>
+
+namespace gl {
+
+    /**
+     * @brief Buckets of FrameTrace::durations. The first holds calls under
+     * 250 ns, each next one is 4 times wider, the last holds the rest
+     *
+     */
+    constexpr std::size_t TRACE_BUCKETS = 8;
+
+    /**
+     * @brief The calls of one entry point in a frame
+     *
+     */
+    struct TracedCall {
+        const char* name = "";
+        std::uint64_t calls = 0;
+        // time spent in the function below the trace
+        std::chrono::nanoseconds time{0};
+        std::chrono::nanoseconds longest{0};
+    };
+
+    /**
+     * @brief The GL calls made between two end_trace_frame()
+     *
+     */
+    struct FrameTrace {
+        std::uint64_t frame = 0;
+        std::uint64_t calls = 0;
+        std::chrono::nanoseconds time{0};
+        // the entry points called, most time first
+        std::vector<TracedCall> functions;
+        // calls by how long they took, see TRACE_BUCKETS
+        std::array<std::uint64_t, TRACE_BUCKETS> durations{};
+    };
+
+    /**
+     * @brief Replace every loaded function in the glad table with a wrapper
+     * that counts its calls and times them
+     *
+     * Nothing is wrapped until this is called, so an application that never
+     * installs the trace pays nothing for it. Wrappers call whatever was in
+     * the table when they were installed: installed after the state cache,
+     * dropped calls are counted too, installed before it only the calls that
+     * reach the driver are. Install after glad has loaded and on the thread
+     * that owns the context, the counters and history are that thread's.
+     */
+    void install_trace();
+
+    /**
+     * @brief Put the wrapped pointers back, except where another layer has
+     * replaced a wrapper since. Uninstall layers in the reverse order
+     *
+     */
+    void uninstall_trace();
+
+    bool trace_installed();
+
+    /**
+     * @brief Close the current frame, e.g. after glfwSwapBuffers, and start
+     * the next
+     *
+     * @return the frame just closed, valid until the next call
+     */
+    const FrameTrace& end_trace_frame();
+
+    /**
+     * @brief The most recent frames, oldest first
+     *
+     */
+    const std::deque<FrameTrace>& trace_history();
+
+    /**
+     * @brief How many frames trace_history() keeps, 120 by default
+     *
+     */
+    void set_trace_history(std::size_t frames);
+
+    /**
+     * @brief Forget the history and the calls of the current frame
+     *
+     */
+    void reset_trace();
+
+    /**
+     * @brief Print a frame's totals, durations and busiest entry points
+     *
+     * @param out the stream
+     * @param frame the frame
+     * @param top how many entry points to list
+     */
+    void print_trace(std::ostream& out, const FrameTrace& frame, std::size_t top = 10);
+} // namespace gl
+
+#endif
@@ -0,0 +1,174 @@
+#ifndef UNIFORMBUFFERS_HPP
+#define UNIFORMBUFFERS_HPP
+
+#include "glad.h"
+#include "Std140.hpp"
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace shaders {
+
+    /**
+     * @brief Name and binding point of the per-frame block every program
+     * shares, see shaders/common/Frame.glsl
+     *
+     */
+    constexpr const char* FRAME_BLOCK = "Frame";
+    constexpr GLuint FRAME_BINDING = 0;
+
+    /**
+     * @brief The binding point every program uses for a uniform block with
+     * this name, assigned the first time the name is seen. Shaders bind
+     * their blocks on link, so look this up once at load time and bind
+     * buffers to it every frame
+     *
+     * @param name block name
+     * @return the binding point, GL_INVALID_INDEX once every one of
+     * GL_MAX_UNIFORM_BUFFER_BINDINGS is taken
+     */
+    GLuint block_binding(std::string_view name);
+
+    /**
+     * @brief Data uploaded once per frame and read by every program
+     *
+     */
+    struct alignas(16) FrameUniforms {
+        using layout = std140::Layout<
+            std140::mat4, std140::mat4, std140::vec4, float, float
+        >;
+
+        std140::mat4 view;
+        std140::mat4 projection;
+        std140::vec4 camera_position;
+        float time;
+        float delta_time;
+    };
+    STD140_CHECK(FrameUniforms, view, 0);
+    STD140_CHECK(FrameUniforms, projection, 1);
+    STD140_CHECK(FrameUniforms, camera_position, 2);
+    STD140_CHECK(FrameUniforms, time, 3);
+    STD140_CHECK(FrameUniforms, delta_time, 4);
+    STD140_CHECK_SIZE(FrameUniforms);
+
+    /**
+     * @brief A block written into a UniformRing
+     *
+     */
+    struct UniformRange {
+        GLuint buffer = 0;
+        GLintptr offset = 0;
+        GLsizeiptr size = 0;
+    };
+
+    /**
+     * @brief One large uniform buffer that uniform blocks are streamed into
+     *
+     * The buffer is split into one region per frame in flight. Blocks are
+     * appended to the current frame's region and bound with
+     * glBindBufferRange instead of setting uniforms one by one, so a draw
+     * costs one copy and one bind however many values its block holds.
+     * begin_frame() waits on the fence of the frame that last used the
+     * region, so writes never stall on or overwrite data the GPU is still
+     * reading. With GL 4.4 buffer storage the buffer stays mapped and a
+     * write is a memcpy, otherwise it is a glBufferSubData.
+     */
+    class UniformRing {
+    public:
+        /**
+         * @brief Construct a new UniformRing object
+         *
+         * @param frame_size bytes available to each frame
+         * @param frames frames in flight
+         */
+        explicit UniformRing(std::size_t frame_size = 1 << 20, std::size_t frames = 3);
+        ~UniformRing();
+
+        UniformRing(const UniformRing&) = delete;
+        UniformRing& operator=(const UniformRing&) = delete;
+
+        /**
+         * @brief Move to the next frame's region, waiting for the GPU to
+         * finish with it if it is still in use
+         *
+         */
+        void begin_frame();
+
+        /**
+         * @brief Fence the current frame's region. Call after the frame's
+         * last draw
+         *
+         */
+        void end_frame();
+
+        /**
+         * @brief Copy a block into the current frame's region
+         *
+         * @param data the block
+         * @param size its size in bytes
+         * @return where it was written, empty if the region is full
+         */
+        UniformRange write(const void* data, std::size_t size);
+
+        template <typename Block>
+        UniformRange write(const Block& block) {
+            static_assert(
+                alignof(Block) >= 16,
+                "uniform blocks are alignas(16) std140 blocks, see Std140.hpp"
+            );
+            return write(&block, sizeof(Block));
+        }
+
+        /**
+         * @brief Write a block and bind it for the next draws
+         *
+         * @param binding uniform buffer binding point
+         * @param block the block
+         */
+        template <typename Block>
+        void bind(GLuint binding, const Block& block) {
+            bind(binding, write(block));
+        }
+
+        /**
+         * @brief Bind a written block, ignored when the range is empty
+         *
+         * @param binding uniform buffer binding point
+         * @param range the block
+         */
+        static void bind(GLuint binding, UniformRange range);
+
+        /**
+         * @brief Upload the shared per-frame block and bind it to
+         * FRAME_BINDING. Call once per frame after begin_frame()
+         *
+         * @param data the frame data
+         */
+        void set_frame(const FrameUniforms& data);
+
+        /**
+         * @brief Whether the buffer is persistently mapped
+         *
+         */
+        bool persistent() const;
+
+        /**
+         * @brief Bytes written to the current frame's region
+         *
+         */
+        std::size_t used() const;
+
+    private:
+        GLuint buffer;
+        std::size_t frame_size;
+        std::size_t alignment;
+        std::size_t frame;
+        std::size_t head;
+        unsigned char* mapped;
+        std::vector<GLsync> fences;
+        bool full;
+    };
+} // namespace shaders
+
+#endif
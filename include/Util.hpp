@@ -4,10 +4,199 @@
 #include "glad.h"
 #include <GLFW/glfw3.h>
 
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+
 namespace util {
     void framebuffer_size_callback(GLFWwindow *window, int width, int height);
 
     void process_input(GLFWwindow *window);
+
+    /**
+     * @brief What a Context draws into
+     *
+     */
+    enum class Backend {
+        // a GLFW window and its default framebuffer
+        WINDOW,
+        // an EGL context with no window or display server, drawing into a
+        // framebuffer object of the requested size
+        HEADLESS,
+        // no driver at all, the glad table is gl::load_null_backend()
+        NONE,
+    };
+
+    struct ContextOptions {
+        Backend backend = Backend::WINDOW;
+        int width = 1280;
+        int height = 720;
+        const char* title = "LearnOpenGL";
+        // core profile from 3.2
+        int major = 3;
+        int minor = 3;
+        // tools that only need a context hide the window
+        bool visible = true;
+        // frames until should_close(), 0 for no limit. Nothing closes a
+        // context without a window, there 0 means 1
+        std::uint64_t frames = 0;
+        // write the last frame as a PPM image, needs a frame limit
+        const char* screenshot = nullptr;
+    };
+
+    /**
+     * @brief Take the context flags out of a command line: --headless,
+     * --null, --size WxH, --frames N and --screenshot file. The remaining
+     * arguments are moved to the front in order and argc counts them, so
+     * the program parses its own arguments as before
+     *
+     * @param argc updated to the arguments left
+     * @param argv the arguments, argv[0] is kept
+     * @param options the program's defaults, e.g. a hidden window
+     * @return the defaults with the flags applied
+     */
+    ContextOptions parse_context_options(
+        int& argc, char** argv, ContextOptions options = {}
+    );
+
+    /**
+     * @brief A GL context with glad loaded, and the framebuffer that
+     * stands in for the default one
+     *
+     * A window draws into its default framebuffer. A headless context
+     * creates a framebuffer object of the requested size with RGBA8 colour
+     * and 24 bit depth, 8 bit stencil, binds it and sets the viewport, so
+     * code that never binds framebuffer 0 runs unchanged. Headless uses
+     * EGL, surfaceless on Mesa, and is only built where CMake finds EGL.
+     */
+    class Context {
+    public:
+        explicit Context(const ContextOptions& options);
+        ~Context();
+
+        Context(const Context&) = delete;
+        Context& operator=(const Context&) = delete;
+
+        /**
+         * @brief Whether the context was created, is current and glad has
+         * loaded. Errors are printed when it is not
+         *
+         */
+        bool valid() const;
+
+        bool should_close() const;
+
+        /**
+         * @brief Finish a frame: swap, poll events and process input for a
+         * window. Writes the screenshot after the last frame
+         *
+         */
+        void end_frame();
+
+        /**
+         * @brief Seconds since the context was created, from a monotonic
+         * clock
+         *
+         */
+        double time() const;
+
+        // frames ended so far
+        std::uint64_t frame() const;
+
+        int width() const;
+        int height() const;
+
+        /**
+         * @brief The framebuffer drawn into, 0 for a window
+         *
+         */
+        GLuint framebuffer() const;
+
+        // NULL without a window
+        GLFWwindow* window() const;
+
+        Backend backend() const;
+
+        /**
+         * @brief Looks up the entry points of the context, e.g. to load
+         * glad again
+         *
+         */
+        GLADloadproc loader() const;
+
+        /**
+         * @brief Read the framebuffer into a binary PPM image
+         *
+         * @param path the image file
+         * @return whether it was written
+         */
+        bool save_frame(const std::filesystem::path& path) const;
+
+    private:
+        bool create_window();
+        bool create_headless();
+        void create_framebuffer();
+
+        std::uint64_t frame_limit() const;
+
+        ContextOptions options;
+        GLFWwindow* glfw_window = nullptr;
+        // EGLDisplay, EGLContext and EGLSurface, opaque so that only
+        // Util.cpp needs the EGL headers
+        void* egl_display = nullptr;
+        void* egl_context = nullptr;
+        void* egl_surface = nullptr;
+        GLuint fbo = 0;
+        GLuint renderbuffers[2] = {0, 0};
+        std::uint64_t frames = 0;
+        std::chrono::steady_clock::time_point start;
+        bool ok = false;
+    };
+
+    struct LoopOptions {
+        // simulated seconds per update, 120 Hz
+        double step = 1.0 / 120.0;
+        // updates per frame at most. Time beyond them is dropped so a slow
+        // frame cannot cause ever more updates
+        int max_steps = 8;
+        // when not 0, each frame advances the clock by this many seconds
+        // instead of the time that passed, e.g. for headless runs that must
+        // render the same frames every time
+        double frame_time = 0;
+    };
+
+    struct LoopStats {
+        std::uint64_t frames = 0;
+        std::uint64_t steps = 0;
+        // simulated seconds dropped by max_steps
+        double dropped = 0;
+    };
+
+    /**
+     * @brief Run the simulation at a fixed rate and render once per frame
+     * until the context should close
+     *
+     * Each frame adds the time since the last to an accumulator, runs
+     * update() once per whole step in it and renders with the fraction of a
+     * step left, which the renderer uses to interpolate between the last two
+     * states. Simulation cost is then independent of the frame rate and the
+     * results of a run independent of it too. Time comes from
+     * Context::time(), a monotonic clock in double precision.
+     *
+     * @param context ended once per frame, after render()
+     * @param update advances the simulation from time to time + step
+     * @param render draws the state at alpha in [0, 1) of the way from the
+     * previous update to the last
+     * @param options the step and its limits
+     * @return the frames and steps run
+     */
+    LoopStats run_loop(
+        Context& context,
+        const std::function<void(double time, double step)>& update,
+        const std::function<void(double alpha)>& render,
+        const LoopOptions& options = {}
+    );
 } // namespace util
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,99 @@
+#ifndef WARMUP_HPP
+#define WARMUP_HPP
+
+#include "glad.h"
+#include "PipelineCache.hpp"
+#include "Reflection.hpp"
+#include "Shaders.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace shaders {
+
+    /**
+     * @brief Totals of a WarmUp
+     *
+     */
+    struct WarmUpStats {
+        std::size_t programs = 0;
+        std::size_t draws = 0;
+        std::chrono::nanoseconds time{0};
+    };
+
+    /**
+     * @brief Draws with programs once during loading so the first frame
+     * that uses them does not stall
+     *
+     * Many drivers only generate code for a program at its first draw, and
+     * again for each new vertex layout or framebuffer format it is drawn
+     * with. warm() draws a degenerate triangle with a program into a 1x1
+     * framebuffer of the given formats, once per vertex format, then waits
+     * for the GPU so the time is attributed to that program. The bindings,
+     * viewport and program current before the call are restored.
+     */
+    class WarmUp {
+    public:
+        /**
+         * @brief Create the 1x1 framebuffer. Use the formats of the real
+         * render target, drivers may compile a variant per format
+         *
+         * @param color_format the colour attachment format
+         * @param depth_format the depth attachment format, GL_NONE for none
+         */
+        explicit WarmUp(
+            GLenum color_format = GL_RGBA8, GLenum depth_format = GL_DEPTH24_STENCIL8
+        );
+        ~WarmUp();
+
+        WarmUp(const WarmUp&) = delete;
+        WarmUp& operator=(const WarmUp&) = delete;
+
+        /**
+         * @brief Draw with a program once per vertex format, and record the
+         * time in its compile record
+         *
+         * @param shader the program, its pending uniforms are flushed
+         * @param formats the vertex formats it will be drawn with, none to
+         * draw with every attribute disabled
+         * @return the time taken
+         */
+        std::chrono::nanoseconds warm(
+            Shader& shader, const std::vector<VertexFormat>& formats = {}
+        );
+
+        /**
+         * @brief Draw with a program pipeline once per vertex format, and
+         * add the time to the compile records of both stages
+         *
+         * @param cache the pipeline cache
+         * @param vert index of a vertex stage
+         * @param frag index of a fragment stage
+         * @param formats the vertex formats it will be drawn with
+         * @return the time taken
+         */
+        std::chrono::nanoseconds warm(
+            PipelineCache& cache, std::size_t vert, std::size_t frag,
+            const std::vector<VertexFormat>& formats = {}
+        );
+
+        const WarmUpStats& stats() const;
+
+    private:
+        GLuint framebuffer;
+        GLuint renderbuffers[2];
+        GLuint vertex_buffer;
+        std::size_t buffer_size;
+        WarmUpStats counters;
+
+        /**
+         * @brief Bind the framebuffer and draw once per format with the
+         * program or pipeline already bound
+         *
+         */
+        void draw(Shader& vertex_stage, const std::vector<VertexFormat>& formats);
+    };
+} // namespace shaders
+
+#endif
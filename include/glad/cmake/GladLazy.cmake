@@ -0,0 +1,202 @@
+# Writes glad_lazy.c, the trampolines gladLoadGLLoaderLazy() installs. Each
+# function of a GL_VERSION_X_Y block in glad.c gets a trampoline with the
+# signature of its typedef in glad.h. On its first call a trampoline looks
+# the function up, points the glad_gl pointer at it unless something else
+# has been installed there since, and forwards the call. Functions that
+# appear in several version blocks are installed with the first. Installing
+# forgets what earlier loads looked up, pointers may differ per context.
+#
+# FUNCTIONS, if given, is written as a list of GLAD_FUNCTION(glName) lines,
+# every entry point once in load order, for code that wraps the glad table.
+#
+# CONTEXT, if given, is written as the GladGLContext struct, a copy of the
+# glad table, and the functions that move it in and out of the thread's.
+#
+# usage: cmake -DGLAD_H=<glad.h> -DGLAD_C=<glad.c> -DOUTPUT=<file>
+#            [-DFUNCTIONS=<file>] [-DCONTEXT=<file>] -P GladLazy.cmake
+
+cmake_minimum_required(VERSION 3.18.4)
+
+set(ident "[A-Za-z_][A-Za-z0-9_]*")
+
+# the signatures, semicolons would split the matches into list items
+file(READ ${GLAD_H} header)
+string(REPLACE ";" "" header "${header}")
+string(REGEX MATCHALL
+    "typedef [^\n]*\\(APIENTRYP PFNGL[A-Z0-9_]+PROC\\)\\([^\n]*\\)" typedefs "${header}")
+foreach(typedef ${typedefs})
+    string(REGEX MATCH
+        "^typedef (.*) \\(APIENTRYP (PFNGL[A-Z0-9_]+PROC)\\)\\((.*)\\)$" _ "${typedef}")
+    set(return_${CMAKE_MATCH_2} "${CMAKE_MATCH_1}")
+    set(params_${CMAKE_MATCH_2} "${CMAKE_MATCH_3}")
+endforeach()
+
+file(READ ${GLAD_C} source)
+string(REPLACE ";" "" source "${source}")
+string(REGEX MATCHALL
+    "static void load_GL_VERSION_[0-9]_[0-9]\\(GLADloadproc load\\) {[^}]*}" blocks "${source}")
+
+set(seen "")
+set(versions "")
+set(functions "")
+set(install "")
+foreach(block ${blocks})
+    string(REGEX MATCH "GL_VERSION_[0-9]_[0-9]" version "${block}")
+    list(APPEND versions ${version})
+    string(REGEX MATCHALL "glad_gl${ident} = \\(PFNGL[A-Z0-9_]+PROC\\)" loads "${block}")
+
+    string(APPEND install "\tif (GLAD_${version}) {\n")
+    foreach(load ${loads})
+        string(REGEX MATCH "^glad_(gl${ident}) = \\((PFNGL[A-Z0-9_]+PROC)\\)$" _ "${load}")
+        set(name ${CMAKE_MATCH_1})
+        set(proc ${CMAKE_MATCH_2})
+        if(name IN_LIST seen)
+            continue()
+        endif()
+        list(APPEND seen ${name})
+        set(proc_${name} ${proc})
+        if(NOT DEFINED return_${proc})
+            message(FATAL_ERROR "no typedef for ${proc} in ${GLAD_H}")
+        endif()
+
+        # the argument names are the last identifier of each parameter
+        set(params "${params_${proc}}")
+        set(args "")
+        if(NOT params STREQUAL "void")
+            string(REPLACE "," ";" param_list "${params}")
+            foreach(param ${param_list})
+                string(REGEX MATCH "${ident}$" arg "${param}")
+                list(APPEND args ${arg})
+            endforeach()
+        endif()
+        list(JOIN args ", " args)
+
+        if(return_${proc} STREQUAL "void")
+            set(forward "\treal_${name}(${args})")
+        else()
+            set(forward "\treturn real_${name}(${args})")
+        endif()
+
+        string(APPEND functions
+            "static GLAD_THREAD_LOCAL ${proc} real_${name};\n"
+            "static ${return_${proc}} APIENTRY lazy_${name}(${params}) {\n"
+            "\tif (real_${name} == NULL) {\n"
+            "\t\treal_${name} = (${proc})resolve(\"${name}\");\n"
+            "\t}\n"
+            "\tif (glad_${name} == lazy_${name}) glad_${name} = real_${name};\n"
+            "${forward};\n"
+            "}\n")
+        string(APPEND install
+            "\t\treal_${name} = NULL;\n"
+            "\t\tglad_${name} = lazy_${name};\n")
+    endforeach()
+    string(APPEND install "\t}\n")
+endforeach()
+
+list(LENGTH seen count)
+set(out "/* Generated by GladLazy.cmake from glad.h and glad.c, do not edit */\n\n")
+string(APPEND out
+    "#include <stdio.h>\n"
+    "#include \"glad.h\"\n\n"
+    "static GLAD_THREAD_LOCAL GLADloadproc lazy_load = NULL;\n"
+    "static GLAD_THREAD_LOCAL int lazy_resolved = 0;\n\n"
+    "static void* resolve(const char* name) {\n"
+    "\tvoid* proc = lazy_load(name);\n"
+    "\tif (proc == NULL) {\n"
+    "\t\tfprintf(stderr, \"ERROR::GLAD::NO_ENTRY_POINT %s\\n\", name);\n"
+    "\t}\n"
+    "\tlazy_resolved++;\n"
+    "\treturn proc;\n"
+    "}\n\n"
+    "${functions}\n"
+    "void glad_lazy_install(GLADloadproc load) {\n"
+    "\tlazy_load = load;\n"
+    "\tlazy_resolved = 0;\n"
+    "${install}"
+    "}\n\n"
+    "GLADloadproc glad_lazy_loader(void) {\n"
+    "\treturn lazy_load;\n"
+    "}\n\n"
+    "void glad_lazy_set_loader(GLADloadproc load) {\n"
+    "\tlazy_load = load;\n"
+    "}\n\n"
+    "int gladLazyResolved(void) {\n"
+    "\treturn lazy_resolved;\n"
+    "}\n\n"
+    "int gladLazyCount(void) {\n"
+    "\treturn ${count};\n"
+    "}\n")
+
+# only rewrite when it changes so nothing is rebuilt
+function(write_if_changed path text)
+    if(EXISTS ${path})
+        file(READ ${path} previous)
+        if(previous STREQUAL text)
+            return()
+        endif()
+    endif()
+    file(WRITE ${path} "${text}")
+endfunction()
+
+write_if_changed(${OUTPUT} "${out}")
+
+if(DEFINED FUNCTIONS)
+    set(list "/* Generated by GladLazy.cmake from glad.c, do not edit */\n\n")
+    foreach(name ${seen})
+        string(APPEND list "GLAD_FUNCTION(${name})\n")
+    endforeach()
+    write_if_changed(${FUNCTIONS} "${list}")
+endif()
+
+if(DEFINED CONTEXT)
+    set(fields "\tstruct gladGLversionStruct version;\n")
+    set(get "\tcontext->version = GLVersion;\n")
+    set(make "\tGLVersion = context->version;\n")
+    # lazy entry points not looked up yet need the loader on every thread
+    string(APPEND fields "\tGLADloadproc lazy_load;\n")
+    string(APPEND get "\tcontext->lazy_load = glad_lazy_loader();\n")
+    string(APPEND make "\tglad_lazy_set_loader(context->lazy_load);\n")
+    # fields drop the GL_ and gl prefixes, glad.h defines the full names
+    foreach(version ${versions})
+        string(SUBSTRING ${version} 3 -1 field)
+        string(APPEND fields "\tint ${field};\n")
+        string(APPEND get "\tcontext->${field} = GLAD_${version};\n")
+        string(APPEND make "\tGLAD_${version} = context->${field};\n")
+    endforeach()
+    foreach(name ${seen})
+        string(SUBSTRING ${name} 2 -1 field)
+        string(APPEND fields "\t${proc_${name}} ${field};\n")
+        string(APPEND get "\tcontext->${field} = glad_${name};\n")
+        string(APPEND make "\tglad_${name} = context->${field};\n")
+    endforeach()
+
+    set(context_out "/* Generated by GladLazy.cmake from glad.h and glad.c, do not edit */\n\n")
+    string(APPEND context_out
+        "#include <stdlib.h>\n"
+        "#include \"glad.h\"\n\n"
+        "GLADloadproc glad_lazy_loader(void);\n"
+        "void glad_lazy_set_loader(GLADloadproc load);\n\n"
+        "struct GladGLContext {\n"
+        "${fields}"
+        "};\n\n"
+        "static const GladGLContext none;\n\n"
+        "GladGLContext* gladCreateGLContext(void) {\n"
+        "\treturn (GladGLContext*)calloc(1, sizeof(GladGLContext));\n"
+        "}\n\n"
+        "void gladDestroyGLContext(GladGLContext* context) {\n"
+        "\tfree(context);\n"
+        "}\n\n"
+        "int gladLoadGLContext(GladGLContext* context, GLADloadproc load) {\n"
+        "\tint status = gladLoadGLLoader(load);\n"
+        "\tgladGetGLContextCurrent(context);\n"
+        "\treturn status;\n"
+        "}\n\n"
+        "void gladMakeGLContextCurrent(const GladGLContext* context) {\n"
+        "\tif (context == NULL) context = &none;\n"
+        "${make}"
+        "}\n\n"
+        "void gladGetGLContextCurrent(GladGLContext* context) {\n"
+        "${get}"
+        "}\n")
+    write_if_changed(${CONTEXT} "${context_out}")
+endif()
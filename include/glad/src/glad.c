@@ -31,10 +31,10 @@ static void* get_proc(const char *namez);
 #undef APIENTRY
 #endif
 #include <windows.h>
-static HMODULE libGL;
+static GLAD_THREAD_LOCAL HMODULE libGL;
 
 typedef void* (APIENTRYP PFNWGLGETPROCADDRESSPROC_PRIVATE)(const char*);
-static PFNWGLGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
+static GLAD_THREAD_LOCAL PFNWGLGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
 
 #ifdef _MSC_VER
 #ifdef __has_include
@@ -77,11 +77,11 @@ void close_gl(void) {
 }
 #else
 #include <dlfcn.h>
-static void* libGL;
+static GLAD_THREAD_LOCAL void* libGL;
 
 #if !defined(__APPLE__) && !defined(__HAIKU__)
 typedef void* (APIENTRYP PFNGLXGETPROCADDRESSPROC_PRIVATE)(const char*);
-static PFNGLXGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
+static GLAD_THREAD_LOCAL PFNGLXGETPROCADDRESSPROC_PRIVATE gladGetProcAddressPtr;
 #endif
 
 static
@@ -156,18 +156,23 @@ int gladLoadGL(void) {
     return status;
 }
 
-struct gladGLversionStruct GLVersion = { 0, 0 };
+GLAD_THREAD_LOCAL struct gladGLversionStruct GLVersion = { 0, 0 };
 
 #if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
 #define _GLAD_IS_SOME_NEW_VERSION 1
 #endif
 
-static int max_loaded_major;
-static int max_loaded_minor;
+static GLAD_THREAD_LOCAL int max_loaded_major;
+static GLAD_THREAD_LOCAL int max_loaded_minor;
 
-static const char *exts = NULL;
-static int num_exts_i = 0;
-static char **exts_i = NULL;
+static GLAD_THREAD_LOCAL const char *exts = NULL;
+static GLAD_THREAD_LOCAL int num_exts_i = 0;
+/* sorted, the pointer array and the names share one allocation */
+static GLAD_THREAD_LOCAL const char **exts_i = NULL;
+
+static int compare_exts(const void *a, const void *b) {
+    return strcmp(*(const char * const *)a, *(const char * const *)b);
+}
 
 static int get_exts(void) {
 #ifdef _GLAD_IS_SOME_NEW_VERSION
@@ -177,27 +182,38 @@ static int get_exts(void) {
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
         unsigned int index;
+        size_t bytes;
+        char *names;
 
         num_exts_i = 0;
         glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
-        if (num_exts_i > 0) {
-            exts_i = (char **)malloc((size_t)num_exts_i * (sizeof *exts_i));
+        if (num_exts_i <= 0) {
+            return 0;
+        }
+
+        /* the strings belong to the context, measure them before copying */
+        bytes = (size_t)num_exts_i * (sizeof *exts_i);
+        for(index = 0; index < (unsigned)num_exts_i; index++) {
+            const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
+            bytes += (gl_str_tmp != NULL ? strlen(gl_str_tmp) : 0) + 1;
         }
 
+        exts_i = (const char **)malloc(bytes);
         if (exts_i == NULL) {
             return 0;
         }
 
+        names = (char *)(exts_i + num_exts_i);
         for(index = 0; index < (unsigned)num_exts_i; index++) {
             const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
-            size_t len = strlen(gl_str_tmp);
+            size_t len = gl_str_tmp != NULL ? strlen(gl_str_tmp) : 0;
 
-            char *local_str = (char*)malloc((len+1) * sizeof(char));
-            if(local_str != NULL) {
-                memcpy(local_str, gl_str_tmp, (len+1) * sizeof(char));
-            }
-            exts_i[index] = local_str;
+            memcpy(names, gl_str_tmp != NULL ? gl_str_tmp : "", len);
+            names[len] = '\0';
+            exts_i[index] = names;
+            names += len + 1;
         }
+        qsort((void *)exts_i, (size_t)num_exts_i, sizeof *exts_i, compare_exts);
     }
 #endif
     return 1;
@@ -205,10 +221,6 @@ static int get_exts(void) {
 
 static void free_exts(void) {
     if (exts_i != NULL) {
-        int index;
-        for(index = 0; index < num_exts_i; index++) {
-            free((char *)exts_i[index]);
-        }
         free((void *)exts_i);
         exts_i = NULL;
     }
@@ -241,738 +253,732 @@ static int has_ext(const char *ext) {
         }
 #ifdef _GLAD_IS_SOME_NEW_VERSION
     } else {
-        int index;
-        if(exts_i == NULL) return 0;
-        for(index = 0; index < num_exts_i; index++) {
-            const char *e = exts_i[index];
-
-            if(exts_i[index] != NULL && strcmp(e, ext) == 0) {
-                return 1;
-            }
-        }
+        if(exts_i == NULL || ext == NULL) return 0;
+        return bsearch(&ext, (const void *)exts_i, (size_t)num_exts_i,
+            sizeof *exts_i, compare_exts) != NULL;
     }
 #endif
 
     return 0;
 }
-int GLAD_GL_VERSION_1_0 = 0;
-int GLAD_GL_VERSION_1_1 = 0;
-int GLAD_GL_VERSION_1_2 = 0;
-int GLAD_GL_VERSION_1_3 = 0;
-int GLAD_GL_VERSION_1_4 = 0;
-int GLAD_GL_VERSION_1_5 = 0;
-int GLAD_GL_VERSION_2_0 = 0;
-int GLAD_GL_VERSION_2_1 = 0;
-int GLAD_GL_VERSION_3_0 = 0;
-int GLAD_GL_VERSION_3_1 = 0;
-int GLAD_GL_VERSION_3_2 = 0;
-int GLAD_GL_VERSION_3_3 = 0;
-int GLAD_GL_VERSION_4_0 = 0;
-int GLAD_GL_VERSION_4_1 = 0;
-int GLAD_GL_VERSION_4_2 = 0;
-int GLAD_GL_VERSION_4_3 = 0;
-int GLAD_GL_VERSION_4_4 = 0;
-int GLAD_GL_VERSION_4_5 = 0;
-int GLAD_GL_VERSION_4_6 = 0;
-PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram = NULL;
-PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
-PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
-PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = NULL;
-PFNGLBEGINQUERYPROC glad_glBeginQuery = NULL;
-PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed = NULL;
-PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = NULL;
-PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = NULL;
-PFNGLBINDBUFFERPROC glad_glBindBuffer = NULL;
-PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = NULL;
-PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = NULL;
-PFNGLBINDBUFFERSBASEPROC glad_glBindBuffersBase = NULL;
-PFNGLBINDBUFFERSRANGEPROC glad_glBindBuffersRange = NULL;
-PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = NULL;
-PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = NULL;
-PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = NULL;
-PFNGLBINDIMAGETEXTUREPROC glad_glBindImageTexture = NULL;
-PFNGLBINDIMAGETEXTURESPROC glad_glBindImageTextures = NULL;
-PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline = NULL;
-PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
-PFNGLBINDSAMPLERPROC glad_glBindSampler = NULL;
-PFNGLBINDSAMPLERSPROC glad_glBindSamplers = NULL;
-PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
-PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit = NULL;
-PFNGLBINDTEXTURESPROC glad_glBindTextures = NULL;
-PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback = NULL;
-PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = NULL;
-PFNGLBINDVERTEXBUFFERPROC glad_glBindVertexBuffer = NULL;
-PFNGLBINDVERTEXBUFFERSPROC glad_glBindVertexBuffers = NULL;
-PFNGLBLENDCOLORPROC glad_glBlendColor = NULL;
-PFNGLBLENDEQUATIONPROC glad_glBlendEquation = NULL;
-PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = NULL;
-PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei = NULL;
-PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi = NULL;
-PFNGLBLENDFUNCPROC glad_glBlendFunc = NULL;
-PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = NULL;
-PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei = NULL;
-PFNGLBLENDFUNCIPROC glad_glBlendFunci = NULL;
-PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
-PFNGLBLITNAMEDFRAMEBUFFERPROC glad_glBlitNamedFramebuffer = NULL;
-PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
-PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
-PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
-PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
-PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_glCheckNamedFramebufferStatus = NULL;
-PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
-PFNGLCLEARPROC glad_glClear = NULL;
-PFNGLCLEARBUFFERDATAPROC glad_glClearBufferData = NULL;
-PFNGLCLEARBUFFERSUBDATAPROC glad_glClearBufferSubData = NULL;
-PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = NULL;
-PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = NULL;
-PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = NULL;
-PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = NULL;
-PFNGLCLEARCOLORPROC glad_glClearColor = NULL;
-PFNGLCLEARDEPTHPROC glad_glClearDepth = NULL;
-PFNGLCLEARDEPTHFPROC glad_glClearDepthf = NULL;
-PFNGLCLEARNAMEDBUFFERDATAPROC glad_glClearNamedBufferData = NULL;
-PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_glClearNamedBufferSubData = NULL;
-PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_glClearNamedFramebufferfi = NULL;
-PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_glClearNamedFramebufferfv = NULL;
-PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_glClearNamedFramebufferiv = NULL;
-PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_glClearNamedFramebufferuiv = NULL;
-PFNGLCLEARSTENCILPROC glad_glClearStencil = NULL;
-PFNGLCLEARTEXIMAGEPROC glad_glClearTexImage = NULL;
-PFNGLCLEARTEXSUBIMAGEPROC glad_glClearTexSubImage = NULL;
-PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = NULL;
-PFNGLCLIPCONTROLPROC glad_glClipControl = NULL;
-PFNGLCOLORMASKPROC glad_glColorMask = NULL;
-PFNGLCOLORMASKIPROC glad_glColorMaski = NULL;
-PFNGLCOLORP3UIPROC glad_glColorP3ui = NULL;
-PFNGLCOLORP3UIVPROC glad_glColorP3uiv = NULL;
-PFNGLCOLORP4UIPROC glad_glColorP4ui = NULL;
-PFNGLCOLORP4UIVPROC glad_glColorP4uiv = NULL;
-PFNGLCOMPILESHADERPROC glad_glCompileShader = NULL;
-PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D = NULL;
-PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D = NULL;
-PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = NULL;
-PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = NULL;
-PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_glCompressedTextureSubImage1D = NULL;
-PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_glCompressedTextureSubImage2D = NULL;
-PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_glCompressedTextureSubImage3D = NULL;
-PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = NULL;
-PFNGLCOPYIMAGESUBDATAPROC glad_glCopyImageSubData = NULL;
-PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_glCopyNamedBufferSubData = NULL;
-PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = NULL;
-PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = NULL;
-PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = NULL;
-PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = NULL;
-PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = NULL;
-PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_glCopyTextureSubImage1D = NULL;
-PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_glCopyTextureSubImage2D = NULL;
-PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_glCopyTextureSubImage3D = NULL;
-PFNGLCREATEBUFFERSPROC glad_glCreateBuffers = NULL;
-PFNGLCREATEFRAMEBUFFERSPROC glad_glCreateFramebuffers = NULL;
-PFNGLCREATEPROGRAMPROC glad_glCreateProgram = NULL;
-PFNGLCREATEPROGRAMPIPELINESPROC glad_glCreateProgramPipelines = NULL;
-PFNGLCREATEQUERIESPROC glad_glCreateQueries = NULL;
-PFNGLCREATERENDERBUFFERSPROC glad_glCreateRenderbuffers = NULL;
-PFNGLCREATESAMPLERSPROC glad_glCreateSamplers = NULL;
-PFNGLCREATESHADERPROC glad_glCreateShader = NULL;
-PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv = NULL;
-PFNGLCREATETEXTURESPROC glad_glCreateTextures = NULL;
-PFNGLCREATETRANSFORMFEEDBACKSPROC glad_glCreateTransformFeedbacks = NULL;
-PFNGLCREATEVERTEXARRAYSPROC glad_glCreateVertexArrays = NULL;
-PFNGLCULLFACEPROC glad_glCullFace = NULL;
-PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback = NULL;
-PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl = NULL;
-PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert = NULL;
-PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = NULL;
-PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = NULL;
-PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = NULL;
-PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines = NULL;
-PFNGLDELETEQUERIESPROC glad_glDeleteQueries = NULL;
-PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = NULL;
-PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = NULL;
-PFNGLDELETESHADERPROC glad_glDeleteShader = NULL;
-PFNGLDELETESYNCPROC glad_glDeleteSync = NULL;
-PFNGLDELETETEXTURESPROC glad_glDeleteTextures = NULL;
-PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks = NULL;
-PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = NULL;
-PFNGLDEPTHFUNCPROC glad_glDepthFunc = NULL;
-PFNGLDEPTHMASKPROC glad_glDepthMask = NULL;
-PFNGLDEPTHRANGEPROC glad_glDepthRange = NULL;
-PFNGLDEPTHRANGEARRAYVPROC glad_glDepthRangeArrayv = NULL;
-PFNGLDEPTHRANGEINDEXEDPROC glad_glDepthRangeIndexed = NULL;
-PFNGLDEPTHRANGEFPROC glad_glDepthRangef = NULL;
-PFNGLDETACHSHADERPROC glad_glDetachShader = NULL;
-PFNGLDISABLEPROC glad_glDisable = NULL;
-PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_glDisableVertexArrayAttrib = NULL;
-PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = NULL;
-PFNGLDISABLEIPROC glad_glDisablei = NULL;
-PFNGLDISPATCHCOMPUTEPROC glad_glDispatchCompute = NULL;
-PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_glDispatchComputeIndirect = NULL;
-PFNGLDRAWARRAYSPROC glad_glDrawArrays = NULL;
-PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = NULL;
-PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = NULL;
-PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance = NULL;
-PFNGLDRAWBUFFERPROC glad_glDrawBuffer = NULL;
-PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = NULL;
-PFNGLDRAWELEMENTSPROC glad_glDrawElements = NULL;
-PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = NULL;
-PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = NULL;
-PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
-PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance = NULL;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = NULL;
-PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
-PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = NULL;
-PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = NULL;
-PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback = NULL;
-PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_glDrawTransformFeedbackInstanced = NULL;
-PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream = NULL;
-PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_glDrawTransformFeedbackStreamInstanced = NULL;
-PFNGLENABLEPROC glad_glEnable = NULL;
-PFNGLENABLEVERTEXARRAYATTRIBPROC glad_glEnableVertexArrayAttrib = NULL;
-PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = NULL;
-PFNGLENABLEIPROC glad_glEnablei = NULL;
-PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = NULL;
-PFNGLENDQUERYPROC glad_glEndQuery = NULL;
-PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed = NULL;
-PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = NULL;
-PFNGLFENCESYNCPROC glad_glFenceSync = NULL;
-PFNGLFINISHPROC glad_glFinish = NULL;
-PFNGLFLUSHPROC glad_glFlush = NULL;
-PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = NULL;
-PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_glFlushMappedNamedBufferRange = NULL;
-PFNGLFRAMEBUFFERPARAMETERIPROC glad_glFramebufferParameteri = NULL;
-PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = NULL;
-PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = NULL;
-PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = NULL;
-PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = NULL;
-PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D = NULL;
-PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = NULL;
-PFNGLFRONTFACEPROC glad_glFrontFace = NULL;
-PFNGLGENBUFFERSPROC glad_glGenBuffers = NULL;
-PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = NULL;
-PFNGLGENPROGRAMPIPELINESPROC glad_glGenProgramPipelines = NULL;
-PFNGLGENQUERIESPROC glad_glGenQueries = NULL;
-PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = NULL;
-PFNGLGENSAMPLERSPROC glad_glGenSamplers = NULL;
-PFNGLGENTEXTURESPROC glad_glGenTextures = NULL;
-PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks = NULL;
-PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = NULL;
-PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = NULL;
-PFNGLGENERATETEXTUREMIPMAPPROC glad_glGenerateTextureMipmap = NULL;
-PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_glGetActiveAtomicCounterBufferiv = NULL;
-PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = NULL;
-PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName = NULL;
-PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName = NULL;
-PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv = NULL;
-PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = NULL;
-PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = NULL;
-PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = NULL;
-PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName = NULL;
-PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv = NULL;
-PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders = NULL;
-PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation = NULL;
-PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v = NULL;
-PFNGLGETBOOLEANVPROC glad_glGetBooleanv = NULL;
-PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v = NULL;
-PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = NULL;
-PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = NULL;
-PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = NULL;
-PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = NULL;
-PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_glGetCompressedTextureImage = NULL;
-PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_glGetCompressedTextureSubImage = NULL;
-PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog = NULL;
-PFNGLGETDOUBLEI_VPROC glad_glGetDoublei_v = NULL;
-PFNGLGETDOUBLEVPROC glad_glGetDoublev = NULL;
-PFNGLGETERRORPROC glad_glGetError = NULL;
-PFNGLGETFLOATI_VPROC glad_glGetFloati_v = NULL;
-PFNGLGETFLOATVPROC glad_glGetFloatv = NULL;
-PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = NULL;
-PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = NULL;
-PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = NULL;
-PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_glGetFramebufferParameteriv = NULL;
-PFNGLGETGRAPHICSRESETSTATUSPROC glad_glGetGraphicsResetStatus = NULL;
-PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = NULL;
-PFNGLGETINTEGER64VPROC glad_glGetInteger64v = NULL;
-PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = NULL;
-PFNGLGETINTEGERVPROC glad_glGetIntegerv = NULL;
-PFNGLGETINTERNALFORMATI64VPROC glad_glGetInternalformati64v = NULL;
-PFNGLGETINTERNALFORMATIVPROC glad_glGetInternalformativ = NULL;
-PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = NULL;
-PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_glGetNamedBufferParameteri64v = NULL;
-PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_glGetNamedBufferParameteriv = NULL;
-PFNGLGETNAMEDBUFFERPOINTERVPROC glad_glGetNamedBufferPointerv = NULL;
-PFNGLGETNAMEDBUFFERSUBDATAPROC glad_glGetNamedBufferSubData = NULL;
-PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetNamedFramebufferAttachmentParameteriv = NULL;
-PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_glGetNamedFramebufferParameteriv = NULL;
-PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_glGetNamedRenderbufferParameteriv = NULL;
-PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel = NULL;
-PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel = NULL;
-PFNGLGETPOINTERVPROC glad_glGetPointerv = NULL;
-PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
-PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = NULL;
-PFNGLGETPROGRAMINTERFACEIVPROC glad_glGetProgramInterfaceiv = NULL;
-PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_glGetProgramPipelineInfoLog = NULL;
-PFNGLGETPROGRAMPIPELINEIVPROC glad_glGetProgramPipelineiv = NULL;
-PFNGLGETPROGRAMRESOURCEINDEXPROC glad_glGetProgramResourceIndex = NULL;
-PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_glGetProgramResourceLocation = NULL;
-PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_glGetProgramResourceLocationIndex = NULL;
-PFNGLGETPROGRAMRESOURCENAMEPROC glad_glGetProgramResourceName = NULL;
-PFNGLGETPROGRAMRESOURCEIVPROC glad_glGetProgramResourceiv = NULL;
-PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv = NULL;
-PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = NULL;
-PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_glGetQueryBufferObjecti64v = NULL;
-PFNGLGETQUERYBUFFEROBJECTIVPROC glad_glGetQueryBufferObjectiv = NULL;
-PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_glGetQueryBufferObjectui64v = NULL;
-PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_glGetQueryBufferObjectuiv = NULL;
-PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv = NULL;
-PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = NULL;
-PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = NULL;
-PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = NULL;
-PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = NULL;
-PFNGLGETQUERYIVPROC glad_glGetQueryiv = NULL;
-PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv = NULL;
-PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv = NULL;
-PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = NULL;
-PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = NULL;
-PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = NULL;
-PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = NULL;
-PFNGLGETSHADERPRECISIONFORMATPROC glad_glGetShaderPrecisionFormat = NULL;
-PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = NULL;
-PFNGLGETSHADERIVPROC glad_glGetShaderiv = NULL;
-PFNGLGETSTRINGPROC glad_glGetString = NULL;
-PFNGLGETSTRINGIPROC glad_glGetStringi = NULL;
-PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex = NULL;
-PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation = NULL;
-PFNGLGETSYNCIVPROC glad_glGetSynciv = NULL;
-PFNGLGETTEXIMAGEPROC glad_glGetTexImage = NULL;
-PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = NULL;
-PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv = NULL;
-PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = NULL;
-PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = NULL;
-PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = NULL;
-PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = NULL;
-PFNGLGETTEXTUREIMAGEPROC glad_glGetTextureImage = NULL;
-PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_glGetTextureLevelParameterfv = NULL;
-PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_glGetTextureLevelParameteriv = NULL;
-PFNGLGETTEXTUREPARAMETERIIVPROC glad_glGetTextureParameterIiv = NULL;
-PFNGLGETTEXTUREPARAMETERIUIVPROC glad_glGetTextureParameterIuiv = NULL;
-PFNGLGETTEXTUREPARAMETERFVPROC glad_glGetTextureParameterfv = NULL;
-PFNGLGETTEXTUREPARAMETERIVPROC glad_glGetTextureParameteriv = NULL;
-PFNGLGETTEXTURESUBIMAGEPROC glad_glGetTextureSubImage = NULL;
-PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = NULL;
-PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_glGetTransformFeedbacki64_v = NULL;
-PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_glGetTransformFeedbacki_v = NULL;
-PFNGLGETTRANSFORMFEEDBACKIVPROC glad_glGetTransformFeedbackiv = NULL;
-PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = NULL;
-PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = NULL;
-PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = NULL;
-PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv = NULL;
-PFNGLGETUNIFORMDVPROC glad_glGetUniformdv = NULL;
-PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = NULL;
-PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = NULL;
-PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = NULL;
-PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_glGetVertexArrayIndexed64iv = NULL;
-PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_glGetVertexArrayIndexediv = NULL;
-PFNGLGETVERTEXARRAYIVPROC glad_glGetVertexArrayiv = NULL;
-PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = NULL;
-PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = NULL;
-PFNGLGETVERTEXATTRIBLDVPROC glad_glGetVertexAttribLdv = NULL;
-PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = NULL;
-PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = NULL;
-PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = NULL;
-PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = NULL;
-PFNGLGETNCOLORTABLEPROC glad_glGetnColorTable = NULL;
-PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_glGetnCompressedTexImage = NULL;
-PFNGLGETNCONVOLUTIONFILTERPROC glad_glGetnConvolutionFilter = NULL;
-PFNGLGETNHISTOGRAMPROC glad_glGetnHistogram = NULL;
-PFNGLGETNMAPDVPROC glad_glGetnMapdv = NULL;
-PFNGLGETNMAPFVPROC glad_glGetnMapfv = NULL;
-PFNGLGETNMAPIVPROC glad_glGetnMapiv = NULL;
-PFNGLGETNMINMAXPROC glad_glGetnMinmax = NULL;
-PFNGLGETNPIXELMAPFVPROC glad_glGetnPixelMapfv = NULL;
-PFNGLGETNPIXELMAPUIVPROC glad_glGetnPixelMapuiv = NULL;
-PFNGLGETNPIXELMAPUSVPROC glad_glGetnPixelMapusv = NULL;
-PFNGLGETNPOLYGONSTIPPLEPROC glad_glGetnPolygonStipple = NULL;
-PFNGLGETNSEPARABLEFILTERPROC glad_glGetnSeparableFilter = NULL;
-PFNGLGETNTEXIMAGEPROC glad_glGetnTexImage = NULL;
-PFNGLGETNUNIFORMDVPROC glad_glGetnUniformdv = NULL;
-PFNGLGETNUNIFORMFVPROC glad_glGetnUniformfv = NULL;
-PFNGLGETNUNIFORMIVPROC glad_glGetnUniformiv = NULL;
-PFNGLGETNUNIFORMUIVPROC glad_glGetnUniformuiv = NULL;
-PFNGLHINTPROC glad_glHint = NULL;
-PFNGLINVALIDATEBUFFERDATAPROC glad_glInvalidateBufferData = NULL;
-PFNGLINVALIDATEBUFFERSUBDATAPROC glad_glInvalidateBufferSubData = NULL;
-PFNGLINVALIDATEFRAMEBUFFERPROC glad_glInvalidateFramebuffer = NULL;
-PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_glInvalidateNamedFramebufferData = NULL;
-PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_glInvalidateNamedFramebufferSubData = NULL;
-PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_glInvalidateSubFramebuffer = NULL;
-PFNGLINVALIDATETEXIMAGEPROC glad_glInvalidateTexImage = NULL;
-PFNGLINVALIDATETEXSUBIMAGEPROC glad_glInvalidateTexSubImage = NULL;
-PFNGLISBUFFERPROC glad_glIsBuffer = NULL;
-PFNGLISENABLEDPROC glad_glIsEnabled = NULL;
-PFNGLISENABLEDIPROC glad_glIsEnabledi = NULL;
-PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = NULL;
-PFNGLISPROGRAMPROC glad_glIsProgram = NULL;
-PFNGLISPROGRAMPIPELINEPROC glad_glIsProgramPipeline = NULL;
-PFNGLISQUERYPROC glad_glIsQuery = NULL;
-PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = NULL;
-PFNGLISSAMPLERPROC glad_glIsSampler = NULL;
-PFNGLISSHADERPROC glad_glIsShader = NULL;
-PFNGLISSYNCPROC glad_glIsSync = NULL;
-PFNGLISTEXTUREPROC glad_glIsTexture = NULL;
-PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback = NULL;
-PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = NULL;
-PFNGLLINEWIDTHPROC glad_glLineWidth = NULL;
-PFNGLLINKPROGRAMPROC glad_glLinkProgram = NULL;
-PFNGLLOGICOPPROC glad_glLogicOp = NULL;
-PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
-PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
-PFNGLMAPNAMEDBUFFERPROC glad_glMapNamedBuffer = NULL;
-PFNGLMAPNAMEDBUFFERRANGEPROC glad_glMapNamedBufferRange = NULL;
-PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = NULL;
-PFNGLMEMORYBARRIERBYREGIONPROC glad_glMemoryBarrierByRegion = NULL;
-PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading = NULL;
-PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
-PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = NULL;
-PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_glMultiDrawArraysIndirectCount = NULL;
-PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
-PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
-PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = NULL;
-PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_glMultiDrawElementsIndirectCount = NULL;
-PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = NULL;
-PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = NULL;
-PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = NULL;
-PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv = NULL;
-PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = NULL;
-PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = NULL;
-PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = NULL;
-PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = NULL;
-PFNGLNAMEDBUFFERDATAPROC glad_glNamedBufferData = NULL;
-PFNGLNAMEDBUFFERSTORAGEPROC glad_glNamedBufferStorage = NULL;
-PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData = NULL;
-PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_glNamedFramebufferDrawBuffer = NULL;
-PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_glNamedFramebufferDrawBuffers = NULL;
-PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_glNamedFramebufferParameteri = NULL;
-PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_glNamedFramebufferReadBuffer = NULL;
-PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_glNamedFramebufferRenderbuffer = NULL;
-PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_glNamedFramebufferTexture = NULL;
-PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_glNamedFramebufferTextureLayer = NULL;
-PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_glNamedRenderbufferStorage = NULL;
-PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glNamedRenderbufferStorageMultisample = NULL;
-PFNGLNORMALP3UIPROC glad_glNormalP3ui = NULL;
-PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = NULL;
-PFNGLOBJECTLABELPROC glad_glObjectLabel = NULL;
-PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel = NULL;
-PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv = NULL;
-PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri = NULL;
-PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback = NULL;
-PFNGLPIXELSTOREFPROC glad_glPixelStoref = NULL;
-PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
-PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = NULL;
-PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv = NULL;
-PFNGLPOINTPARAMETERIPROC glad_glPointParameteri = NULL;
-PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = NULL;
-PFNGLPOINTSIZEPROC glad_glPointSize = NULL;
-PFNGLPOLYGONMODEPROC glad_glPolygonMode = NULL;
-PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = NULL;
-PFNGLPOLYGONOFFSETCLAMPPROC glad_glPolygonOffsetClamp = NULL;
-PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup = NULL;
-PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = NULL;
-PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
-PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
-PFNGLPROGRAMUNIFORM1DPROC glad_glProgramUniform1d = NULL;
-PFNGLPROGRAMUNIFORM1DVPROC glad_glProgramUniform1dv = NULL;
-PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f = NULL;
-PFNGLPROGRAMUNIFORM1FVPROC glad_glProgramUniform1fv = NULL;
-PFNGLPROGRAMUNIFORM1IPROC glad_glProgramUniform1i = NULL;
-PFNGLPROGRAMUNIFORM1IVPROC glad_glProgramUniform1iv = NULL;
-PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui = NULL;
-PFNGLPROGRAMUNIFORM1UIVPROC glad_glProgramUniform1uiv = NULL;
-PFNGLPROGRAMUNIFORM2DPROC glad_glProgramUniform2d = NULL;
-PFNGLPROGRAMUNIFORM2DVPROC glad_glProgramUniform2dv = NULL;
-PFNGLPROGRAMUNIFORM2FPROC glad_glProgramUniform2f = NULL;
-PFNGLPROGRAMUNIFORM2FVPROC glad_glProgramUniform2fv = NULL;
-PFNGLPROGRAMUNIFORM2IPROC glad_glProgramUniform2i = NULL;
-PFNGLPROGRAMUNIFORM2IVPROC glad_glProgramUniform2iv = NULL;
-PFNGLPROGRAMUNIFORM2UIPROC glad_glProgramUniform2ui = NULL;
-PFNGLPROGRAMUNIFORM2UIVPROC glad_glProgramUniform2uiv = NULL;
-PFNGLPROGRAMUNIFORM3DPROC glad_glProgramUniform3d = NULL;
-PFNGLPROGRAMUNIFORM3DVPROC glad_glProgramUniform3dv = NULL;
-PFNGLPROGRAMUNIFORM3FPROC glad_glProgramUniform3f = NULL;
-PFNGLPROGRAMUNIFORM3FVPROC glad_glProgramUniform3fv = NULL;
-PFNGLPROGRAMUNIFORM3IPROC glad_glProgramUniform3i = NULL;
-PFNGLPROGRAMUNIFORM3IVPROC glad_glProgramUniform3iv = NULL;
-PFNGLPROGRAMUNIFORM3UIPROC glad_glProgramUniform3ui = NULL;
-PFNGLPROGRAMUNIFORM3UIVPROC glad_glProgramUniform3uiv = NULL;
-PFNGLPROGRAMUNIFORM4DPROC glad_glProgramUniform4d = NULL;
-PFNGLPROGRAMUNIFORM4DVPROC glad_glProgramUniform4dv = NULL;
-PFNGLPROGRAMUNIFORM4FPROC glad_glProgramUniform4f = NULL;
-PFNGLPROGRAMUNIFORM4FVPROC glad_glProgramUniform4fv = NULL;
-PFNGLPROGRAMUNIFORM4IPROC glad_glProgramUniform4i = NULL;
-PFNGLPROGRAMUNIFORM4IVPROC glad_glProgramUniform4iv = NULL;
-PFNGLPROGRAMUNIFORM4UIPROC glad_glProgramUniform4ui = NULL;
-PFNGLPROGRAMUNIFORM4UIVPROC glad_glProgramUniform4uiv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_glProgramUniformMatrix2dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_glProgramUniformMatrix2fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_glProgramUniformMatrix2x3dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_glProgramUniformMatrix2x3fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_glProgramUniformMatrix2x4dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_glProgramUniformMatrix2x4fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_glProgramUniformMatrix3dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_glProgramUniformMatrix3fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_glProgramUniformMatrix3x2dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_glProgramUniformMatrix3x2fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_glProgramUniformMatrix3x4dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_glProgramUniformMatrix3x4fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_glProgramUniformMatrix4dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_glProgramUniformMatrix4fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_glProgramUniformMatrix4x2dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_glProgramUniformMatrix4x2fv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_glProgramUniformMatrix4x3dv = NULL;
-PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_glProgramUniformMatrix4x3fv = NULL;
-PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = NULL;
-PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup = NULL;
-PFNGLQUERYCOUNTERPROC glad_glQueryCounter = NULL;
-PFNGLREADBUFFERPROC glad_glReadBuffer = NULL;
-PFNGLREADPIXELSPROC glad_glReadPixels = NULL;
-PFNGLREADNPIXELSPROC glad_glReadnPixels = NULL;
-PFNGLRELEASESHADERCOMPILERPROC glad_glReleaseShaderCompiler = NULL;
-PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = NULL;
-PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = NULL;
-PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback = NULL;
-PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = NULL;
-PFNGLSAMPLEMASKIPROC glad_glSampleMaski = NULL;
-PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = NULL;
-PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv = NULL;
-PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf = NULL;
-PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = NULL;
-PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = NULL;
-PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = NULL;
-PFNGLSCISSORPROC glad_glScissor = NULL;
-PFNGLSCISSORARRAYVPROC glad_glScissorArrayv = NULL;
-PFNGLSCISSORINDEXEDPROC glad_glScissorIndexed = NULL;
-PFNGLSCISSORINDEXEDVPROC glad_glScissorIndexedv = NULL;
-PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = NULL;
-PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = NULL;
-PFNGLSHADERBINARYPROC glad_glShaderBinary = NULL;
-PFNGLSHADERSOURCEPROC glad_glShaderSource = NULL;
-PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_glShaderStorageBlockBinding = NULL;
-PFNGLSPECIALIZESHADERPROC glad_glSpecializeShader = NULL;
-PFNGLSTENCILFUNCPROC glad_glStencilFunc = NULL;
-PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = NULL;
-PFNGLSTENCILMASKPROC glad_glStencilMask = NULL;
-PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = NULL;
-PFNGLSTENCILOPPROC glad_glStencilOp = NULL;
-PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = NULL;
-PFNGLTEXBUFFERPROC glad_glTexBuffer = NULL;
-PFNGLTEXBUFFERRANGEPROC glad_glTexBufferRange = NULL;
-PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = NULL;
-PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = NULL;
-PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = NULL;
-PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv = NULL;
-PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui = NULL;
-PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv = NULL;
-PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui = NULL;
-PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv = NULL;
-PFNGLTEXIMAGE1DPROC glad_glTexImage1D = NULL;
-PFNGLTEXIMAGE2DPROC glad_glTexImage2D = NULL;
-PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample = NULL;
-PFNGLTEXIMAGE3DPROC glad_glTexImage3D = NULL;
-PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample = NULL;
-PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv = NULL;
-PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv = NULL;
-PFNGLTEXPARAMETERFPROC glad_glTexParameterf = NULL;
-PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = NULL;
-PFNGLTEXPARAMETERIPROC glad_glTexParameteri = NULL;
-PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = NULL;
-PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D = NULL;
-PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D = NULL;
-PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_glTexStorage2DMultisample = NULL;
-PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D = NULL;
-PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_glTexStorage3DMultisample = NULL;
-PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = NULL;
-PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
-PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
-PFNGLTEXTUREBARRIERPROC glad_glTextureBarrier = NULL;
-PFNGLTEXTUREBUFFERPROC glad_glTextureBuffer = NULL;
-PFNGLTEXTUREBUFFERRANGEPROC glad_glTextureBufferRange = NULL;
-PFNGLTEXTUREPARAMETERIIVPROC glad_glTextureParameterIiv = NULL;
-PFNGLTEXTUREPARAMETERIUIVPROC glad_glTextureParameterIuiv = NULL;
-PFNGLTEXTUREPARAMETERFPROC glad_glTextureParameterf = NULL;
-PFNGLTEXTUREPARAMETERFVPROC glad_glTextureParameterfv = NULL;
-PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri = NULL;
-PFNGLTEXTUREPARAMETERIVPROC glad_glTextureParameteriv = NULL;
-PFNGLTEXTURESTORAGE1DPROC glad_glTextureStorage1D = NULL;
-PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D = NULL;
-PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_glTextureStorage2DMultisample = NULL;
-PFNGLTEXTURESTORAGE3DPROC glad_glTextureStorage3D = NULL;
-PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_glTextureStorage3DMultisample = NULL;
-PFNGLTEXTURESUBIMAGE1DPROC glad_glTextureSubImage1D = NULL;
-PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D = NULL;
-PFNGLTEXTURESUBIMAGE3DPROC glad_glTextureSubImage3D = NULL;
-PFNGLTEXTUREVIEWPROC glad_glTextureView = NULL;
-PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_glTransformFeedbackBufferBase = NULL;
-PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_glTransformFeedbackBufferRange = NULL;
-PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = NULL;
-PFNGLUNIFORM1DPROC glad_glUniform1d = NULL;
-PFNGLUNIFORM1DVPROC glad_glUniform1dv = NULL;
-PFNGLUNIFORM1FPROC glad_glUniform1f = NULL;
-PFNGLUNIFORM1FVPROC glad_glUniform1fv = NULL;
-PFNGLUNIFORM1IPROC glad_glUniform1i = NULL;
-PFNGLUNIFORM1IVPROC glad_glUniform1iv = NULL;
-PFNGLUNIFORM1UIPROC glad_glUniform1ui = NULL;
-PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = NULL;
-PFNGLUNIFORM2DPROC glad_glUniform2d = NULL;
-PFNGLUNIFORM2DVPROC glad_glUniform2dv = NULL;
-PFNGLUNIFORM2FPROC glad_glUniform2f = NULL;
-PFNGLUNIFORM2FVPROC glad_glUniform2fv = NULL;
-PFNGLUNIFORM2IPROC glad_glUniform2i = NULL;
-PFNGLUNIFORM2IVPROC glad_glUniform2iv = NULL;
-PFNGLUNIFORM2UIPROC glad_glUniform2ui = NULL;
-PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = NULL;
-PFNGLUNIFORM3DPROC glad_glUniform3d = NULL;
-PFNGLUNIFORM3DVPROC glad_glUniform3dv = NULL;
-PFNGLUNIFORM3FPROC glad_glUniform3f = NULL;
-PFNGLUNIFORM3FVPROC glad_glUniform3fv = NULL;
-PFNGLUNIFORM3IPROC glad_glUniform3i = NULL;
-PFNGLUNIFORM3IVPROC glad_glUniform3iv = NULL;
-PFNGLUNIFORM3UIPROC glad_glUniform3ui = NULL;
-PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = NULL;
-PFNGLUNIFORM4DPROC glad_glUniform4d = NULL;
-PFNGLUNIFORM4DVPROC glad_glUniform4dv = NULL;
-PFNGLUNIFORM4FPROC glad_glUniform4f = NULL;
-PFNGLUNIFORM4FVPROC glad_glUniform4fv = NULL;
-PFNGLUNIFORM4IPROC glad_glUniform4i = NULL;
-PFNGLUNIFORM4IVPROC glad_glUniform4iv = NULL;
-PFNGLUNIFORM4UIPROC glad_glUniform4ui = NULL;
-PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = NULL;
-PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = NULL;
-PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv = NULL;
-PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = NULL;
-PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv = NULL;
-PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = NULL;
-PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv = NULL;
-PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = NULL;
-PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv = NULL;
-PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = NULL;
-PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv = NULL;
-PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = NULL;
-PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv = NULL;
-PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = NULL;
-PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv = NULL;
-PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = NULL;
-PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv = NULL;
-PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = NULL;
-PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv = NULL;
-PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = NULL;
-PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv = NULL;
-PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = NULL;
-PFNGLUNMAPNAMEDBUFFERPROC glad_glUnmapNamedBuffer = NULL;
-PFNGLUSEPROGRAMPROC glad_glUseProgram = NULL;
-PFNGLUSEPROGRAMSTAGESPROC glad_glUseProgramStages = NULL;
-PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = NULL;
-PFNGLVALIDATEPROGRAMPIPELINEPROC glad_glValidateProgramPipeline = NULL;
-PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_glVertexArrayAttribBinding = NULL;
-PFNGLVERTEXARRAYATTRIBFORMATPROC glad_glVertexArrayAttribFormat = NULL;
-PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_glVertexArrayAttribIFormat = NULL;
-PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_glVertexArrayAttribLFormat = NULL;
-PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_glVertexArrayBindingDivisor = NULL;
-PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_glVertexArrayElementBuffer = NULL;
-PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_glVertexArrayVertexBuffer = NULL;
-PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_glVertexArrayVertexBuffers = NULL;
-PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = NULL;
-PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = NULL;
-PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = NULL;
-PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv = NULL;
-PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s = NULL;
-PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv = NULL;
-PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d = NULL;
-PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv = NULL;
-PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f = NULL;
-PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv = NULL;
-PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s = NULL;
-PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv = NULL;
-PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d = NULL;
-PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv = NULL;
-PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f = NULL;
-PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv = NULL;
-PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s = NULL;
-PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv = NULL;
-PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv = NULL;
-PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv = NULL;
-PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv = NULL;
-PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub = NULL;
-PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv = NULL;
-PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv = NULL;
-PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv = NULL;
-PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv = NULL;
-PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d = NULL;
-PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv = NULL;
-PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f = NULL;
-PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv = NULL;
-PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv = NULL;
-PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s = NULL;
-PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = NULL;
-PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = NULL;
-PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = NULL;
-PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = NULL;
-PFNGLVERTEXATTRIBBINDINGPROC glad_glVertexAttribBinding = NULL;
-PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = NULL;
-PFNGLVERTEXATTRIBFORMATPROC glad_glVertexAttribFormat = NULL;
-PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = NULL;
-PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = NULL;
-PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = NULL;
-PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv = NULL;
-PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i = NULL;
-PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv = NULL;
-PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui = NULL;
-PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv = NULL;
-PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i = NULL;
-PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv = NULL;
-PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui = NULL;
-PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv = NULL;
-PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv = NULL;
-PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i = NULL;
-PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv = NULL;
-PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv = NULL;
-PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = NULL;
-PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = NULL;
-PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = NULL;
-PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = NULL;
-PFNGLVERTEXATTRIBIFORMATPROC glad_glVertexAttribIFormat = NULL;
-PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = NULL;
-PFNGLVERTEXATTRIBL1DPROC glad_glVertexAttribL1d = NULL;
-PFNGLVERTEXATTRIBL1DVPROC glad_glVertexAttribL1dv = NULL;
-PFNGLVERTEXATTRIBL2DPROC glad_glVertexAttribL2d = NULL;
-PFNGLVERTEXATTRIBL2DVPROC glad_glVertexAttribL2dv = NULL;
-PFNGLVERTEXATTRIBL3DPROC glad_glVertexAttribL3d = NULL;
-PFNGLVERTEXATTRIBL3DVPROC glad_glVertexAttribL3dv = NULL;
-PFNGLVERTEXATTRIBL4DPROC glad_glVertexAttribL4d = NULL;
-PFNGLVERTEXATTRIBL4DVPROC glad_glVertexAttribL4dv = NULL;
-PFNGLVERTEXATTRIBLFORMATPROC glad_glVertexAttribLFormat = NULL;
-PFNGLVERTEXATTRIBLPOINTERPROC glad_glVertexAttribLPointer = NULL;
-PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = NULL;
-PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = NULL;
-PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = NULL;
-PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv = NULL;
-PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui = NULL;
-PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = NULL;
-PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = NULL;
-PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = NULL;
-PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = NULL;
-PFNGLVERTEXBINDINGDIVISORPROC glad_glVertexBindingDivisor = NULL;
-PFNGLVERTEXP2UIPROC glad_glVertexP2ui = NULL;
-PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = NULL;
-PFNGLVERTEXP3UIPROC glad_glVertexP3ui = NULL;
-PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = NULL;
-PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
-PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
-PFNGLVIEWPORTPROC glad_glViewport = NULL;
-PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv = NULL;
-PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf = NULL;
-PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = NULL;
-PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_1_0 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_1_1 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_1_2 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_1_3 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_1_4 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_1_5 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_2_0 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_2_1 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_3_0 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_3_1 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_3_2 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_3_3 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_0 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_1 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_2 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_3 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_4 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_5 = 0;
+GLAD_THREAD_LOCAL int GLAD_GL_VERSION_4_6 = 0;
+GLAD_THREAD_LOCAL PFNGLACTIVESHADERPROGRAMPROC glad_glActiveShaderProgram = NULL;
+GLAD_THREAD_LOCAL PFNGLACTIVETEXTUREPROC glad_glActiveTexture = NULL;
+GLAD_THREAD_LOCAL PFNGLATTACHSHADERPROC glad_glAttachShader = NULL;
+GLAD_THREAD_LOCAL PFNGLBEGINCONDITIONALRENDERPROC glad_glBeginConditionalRender = NULL;
+GLAD_THREAD_LOCAL PFNGLBEGINQUERYPROC glad_glBeginQuery = NULL;
+GLAD_THREAD_LOCAL PFNGLBEGINQUERYINDEXEDPROC glad_glBeginQueryIndexed = NULL;
+GLAD_THREAD_LOCAL PFNGLBEGINTRANSFORMFEEDBACKPROC glad_glBeginTransformFeedback = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDATTRIBLOCATIONPROC glad_glBindAttribLocation = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDBUFFERPROC glad_glBindBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDBUFFERBASEPROC glad_glBindBufferBase = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDBUFFERRANGEPROC glad_glBindBufferRange = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDBUFFERSBASEPROC glad_glBindBuffersBase = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDBUFFERSRANGEPROC glad_glBindBuffersRange = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDFRAGDATALOCATIONPROC glad_glBindFragDataLocation = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_glBindFragDataLocationIndexed = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDFRAMEBUFFERPROC glad_glBindFramebuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDIMAGETEXTUREPROC glad_glBindImageTexture = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDIMAGETEXTURESPROC glad_glBindImageTextures = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDPROGRAMPIPELINEPROC glad_glBindProgramPipeline = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDRENDERBUFFERPROC glad_glBindRenderbuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDSAMPLERPROC glad_glBindSampler = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDSAMPLERSPROC glad_glBindSamplers = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDTEXTUREPROC glad_glBindTexture = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDTEXTUREUNITPROC glad_glBindTextureUnit = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDTEXTURESPROC glad_glBindTextures = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDTRANSFORMFEEDBACKPROC glad_glBindTransformFeedback = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDVERTEXARRAYPROC glad_glBindVertexArray = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDVERTEXBUFFERPROC glad_glBindVertexBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLBINDVERTEXBUFFERSPROC glad_glBindVertexBuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLBLENDCOLORPROC glad_glBlendColor = NULL;
+GLAD_THREAD_LOCAL PFNGLBLENDEQUATIONPROC glad_glBlendEquation = NULL;
+GLAD_THREAD_LOCAL PFNGLBLENDEQUATIONSEPARATEPROC glad_glBlendEquationSeparate = NULL;
+GLAD_THREAD_LOCAL PFNGLBLENDEQUATIONSEPARATEIPROC glad_glBlendEquationSeparatei = NULL;
+GLAD_THREAD_LOCAL PFNGLBLENDEQUATIONIPROC glad_glBlendEquationi = NULL;
+GLAD_THREAD_LOCAL PFNGLBLENDFUNCPROC glad_glBlendFunc = NULL;
+GLAD_THREAD_LOCAL PFNGLBLENDFUNCSEPARATEPROC glad_glBlendFuncSeparate = NULL;
+GLAD_THREAD_LOCAL PFNGLBLENDFUNCSEPARATEIPROC glad_glBlendFuncSeparatei = NULL;
+GLAD_THREAD_LOCAL PFNGLBLENDFUNCIPROC glad_glBlendFunci = NULL;
+GLAD_THREAD_LOCAL PFNGLBLITFRAMEBUFFERPROC glad_glBlitFramebuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLBLITNAMEDFRAMEBUFFERPROC glad_glBlitNamedFramebuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLBUFFERDATAPROC glad_glBufferData = NULL;
+GLAD_THREAD_LOCAL PFNGLBUFFERSTORAGEPROC glad_glBufferStorage = NULL;
+GLAD_THREAD_LOCAL PFNGLBUFFERSUBDATAPROC glad_glBufferSubData = NULL;
+GLAD_THREAD_LOCAL PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_glCheckFramebufferStatus = NULL;
+GLAD_THREAD_LOCAL PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_glCheckNamedFramebufferStatus = NULL;
+GLAD_THREAD_LOCAL PFNGLCLAMPCOLORPROC glad_glClampColor = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARPROC glad_glClear = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARBUFFERDATAPROC glad_glClearBufferData = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARBUFFERSUBDATAPROC glad_glClearBufferSubData = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARBUFFERFIPROC glad_glClearBufferfi = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARBUFFERFVPROC glad_glClearBufferfv = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARBUFFERIVPROC glad_glClearBufferiv = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARBUFFERUIVPROC glad_glClearBufferuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARCOLORPROC glad_glClearColor = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARDEPTHPROC glad_glClearDepth = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARDEPTHFPROC glad_glClearDepthf = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARNAMEDBUFFERDATAPROC glad_glClearNamedBufferData = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_glClearNamedBufferSubData = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_glClearNamedFramebufferfi = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_glClearNamedFramebufferfv = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_glClearNamedFramebufferiv = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_glClearNamedFramebufferuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARSTENCILPROC glad_glClearStencil = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARTEXIMAGEPROC glad_glClearTexImage = NULL;
+GLAD_THREAD_LOCAL PFNGLCLEARTEXSUBIMAGEPROC glad_glClearTexSubImage = NULL;
+GLAD_THREAD_LOCAL PFNGLCLIENTWAITSYNCPROC glad_glClientWaitSync = NULL;
+GLAD_THREAD_LOCAL PFNGLCLIPCONTROLPROC glad_glClipControl = NULL;
+GLAD_THREAD_LOCAL PFNGLCOLORMASKPROC glad_glColorMask = NULL;
+GLAD_THREAD_LOCAL PFNGLCOLORMASKIPROC glad_glColorMaski = NULL;
+GLAD_THREAD_LOCAL PFNGLCOLORP3UIPROC glad_glColorP3ui = NULL;
+GLAD_THREAD_LOCAL PFNGLCOLORP3UIVPROC glad_glColorP3uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLCOLORP4UIPROC glad_glColorP4ui = NULL;
+GLAD_THREAD_LOCAL PFNGLCOLORP4UIVPROC glad_glColorP4uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLCOMPILESHADERPROC glad_glCompileShader = NULL;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_glCompressedTexImage1D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_glCompressedTexImage2D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_glCompressedTexImage3D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_glCompressedTexSubImage1D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_glCompressedTexSubImage2D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_glCompressedTexSubImage3D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_glCompressedTextureSubImage1D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_glCompressedTextureSubImage2D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_glCompressedTextureSubImage3D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOPYBUFFERSUBDATAPROC glad_glCopyBufferSubData = NULL;
+GLAD_THREAD_LOCAL PFNGLCOPYIMAGESUBDATAPROC glad_glCopyImageSubData = NULL;
+GLAD_THREAD_LOCAL PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_glCopyNamedBufferSubData = NULL;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXIMAGE1DPROC glad_glCopyTexImage1D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXIMAGE2DPROC glad_glCopyTexImage2D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXSUBIMAGE1DPROC glad_glCopyTexSubImage1D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXSUBIMAGE2DPROC glad_glCopyTexSubImage2D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXSUBIMAGE3DPROC glad_glCopyTexSubImage3D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_glCopyTextureSubImage1D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_glCopyTextureSubImage2D = NULL;
+GLAD_THREAD_LOCAL PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_glCopyTextureSubImage3D = NULL;
+GLAD_THREAD_LOCAL PFNGLCREATEBUFFERSPROC glad_glCreateBuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLCREATEFRAMEBUFFERSPROC glad_glCreateFramebuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLCREATEPROGRAMPROC glad_glCreateProgram = NULL;
+GLAD_THREAD_LOCAL PFNGLCREATEPROGRAMPIPELINESPROC glad_glCreateProgramPipelines = NULL;
+GLAD_THREAD_LOCAL PFNGLCREATEQUERIESPROC glad_glCreateQueries = NULL;
+GLAD_THREAD_LOCAL PFNGLCREATERENDERBUFFERSPROC glad_glCreateRenderbuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLCREATESAMPLERSPROC glad_glCreateSamplers = NULL;
+GLAD_THREAD_LOCAL PFNGLCREATESHADERPROC glad_glCreateShader = NULL;
+GLAD_THREAD_LOCAL PFNGLCREATESHADERPROGRAMVPROC glad_glCreateShaderProgramv = NULL;
+GLAD_THREAD_LOCAL PFNGLCREATETEXTURESPROC glad_glCreateTextures = NULL;
+GLAD_THREAD_LOCAL PFNGLCREATETRANSFORMFEEDBACKSPROC glad_glCreateTransformFeedbacks = NULL;
+GLAD_THREAD_LOCAL PFNGLCREATEVERTEXARRAYSPROC glad_glCreateVertexArrays = NULL;
+GLAD_THREAD_LOCAL PFNGLCULLFACEPROC glad_glCullFace = NULL;
+GLAD_THREAD_LOCAL PFNGLDEBUGMESSAGECALLBACKPROC glad_glDebugMessageCallback = NULL;
+GLAD_THREAD_LOCAL PFNGLDEBUGMESSAGECONTROLPROC glad_glDebugMessageControl = NULL;
+GLAD_THREAD_LOCAL PFNGLDEBUGMESSAGEINSERTPROC glad_glDebugMessageInsert = NULL;
+GLAD_THREAD_LOCAL PFNGLDELETEBUFFERSPROC glad_glDeleteBuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLDELETEFRAMEBUFFERSPROC glad_glDeleteFramebuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLDELETEPROGRAMPROC glad_glDeleteProgram = NULL;
+GLAD_THREAD_LOCAL PFNGLDELETEPROGRAMPIPELINESPROC glad_glDeleteProgramPipelines = NULL;
+GLAD_THREAD_LOCAL PFNGLDELETEQUERIESPROC glad_glDeleteQueries = NULL;
+GLAD_THREAD_LOCAL PFNGLDELETERENDERBUFFERSPROC glad_glDeleteRenderbuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLDELETESAMPLERSPROC glad_glDeleteSamplers = NULL;
+GLAD_THREAD_LOCAL PFNGLDELETESHADERPROC glad_glDeleteShader = NULL;
+GLAD_THREAD_LOCAL PFNGLDELETESYNCPROC glad_glDeleteSync = NULL;
+GLAD_THREAD_LOCAL PFNGLDELETETEXTURESPROC glad_glDeleteTextures = NULL;
+GLAD_THREAD_LOCAL PFNGLDELETETRANSFORMFEEDBACKSPROC glad_glDeleteTransformFeedbacks = NULL;
+GLAD_THREAD_LOCAL PFNGLDELETEVERTEXARRAYSPROC glad_glDeleteVertexArrays = NULL;
+GLAD_THREAD_LOCAL PFNGLDEPTHFUNCPROC glad_glDepthFunc = NULL;
+GLAD_THREAD_LOCAL PFNGLDEPTHMASKPROC glad_glDepthMask = NULL;
+GLAD_THREAD_LOCAL PFNGLDEPTHRANGEPROC glad_glDepthRange = NULL;
+GLAD_THREAD_LOCAL PFNGLDEPTHRANGEARRAYVPROC glad_glDepthRangeArrayv = NULL;
+GLAD_THREAD_LOCAL PFNGLDEPTHRANGEINDEXEDPROC glad_glDepthRangeIndexed = NULL;
+GLAD_THREAD_LOCAL PFNGLDEPTHRANGEFPROC glad_glDepthRangef = NULL;
+GLAD_THREAD_LOCAL PFNGLDETACHSHADERPROC glad_glDetachShader = NULL;
+GLAD_THREAD_LOCAL PFNGLDISABLEPROC glad_glDisable = NULL;
+GLAD_THREAD_LOCAL PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_glDisableVertexArrayAttrib = NULL;
+GLAD_THREAD_LOCAL PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_glDisableVertexAttribArray = NULL;
+GLAD_THREAD_LOCAL PFNGLDISABLEIPROC glad_glDisablei = NULL;
+GLAD_THREAD_LOCAL PFNGLDISPATCHCOMPUTEPROC glad_glDispatchCompute = NULL;
+GLAD_THREAD_LOCAL PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_glDispatchComputeIndirect = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWARRAYSPROC glad_glDrawArrays = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWARRAYSINDIRECTPROC glad_glDrawArraysIndirect = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWARRAYSINSTANCEDPROC glad_glDrawArraysInstanced = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_glDrawArraysInstancedBaseInstance = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWBUFFERPROC glad_glDrawBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWBUFFERSPROC glad_glDrawBuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSPROC glad_glDrawElements = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSBASEVERTEXPROC glad_glDrawElementsBaseVertex = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSINDIRECTPROC glad_glDrawElementsIndirect = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSINSTANCEDPROC glad_glDrawElementsInstanced = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_glDrawElementsInstancedBaseInstance = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_glDrawElementsInstancedBaseVertex = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_glDrawElementsInstancedBaseVertexBaseInstance = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWRANGEELEMENTSPROC glad_glDrawRangeElements = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_glDrawRangeElementsBaseVertex = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWTRANSFORMFEEDBACKPROC glad_glDrawTransformFeedback = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_glDrawTransformFeedbackInstanced = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_glDrawTransformFeedbackStream = NULL;
+GLAD_THREAD_LOCAL PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_glDrawTransformFeedbackStreamInstanced = NULL;
+GLAD_THREAD_LOCAL PFNGLENABLEPROC glad_glEnable = NULL;
+GLAD_THREAD_LOCAL PFNGLENABLEVERTEXARRAYATTRIBPROC glad_glEnableVertexArrayAttrib = NULL;
+GLAD_THREAD_LOCAL PFNGLENABLEVERTEXATTRIBARRAYPROC glad_glEnableVertexAttribArray = NULL;
+GLAD_THREAD_LOCAL PFNGLENABLEIPROC glad_glEnablei = NULL;
+GLAD_THREAD_LOCAL PFNGLENDCONDITIONALRENDERPROC glad_glEndConditionalRender = NULL;
+GLAD_THREAD_LOCAL PFNGLENDQUERYPROC glad_glEndQuery = NULL;
+GLAD_THREAD_LOCAL PFNGLENDQUERYINDEXEDPROC glad_glEndQueryIndexed = NULL;
+GLAD_THREAD_LOCAL PFNGLENDTRANSFORMFEEDBACKPROC glad_glEndTransformFeedback = NULL;
+GLAD_THREAD_LOCAL PFNGLFENCESYNCPROC glad_glFenceSync = NULL;
+GLAD_THREAD_LOCAL PFNGLFINISHPROC glad_glFinish = NULL;
+GLAD_THREAD_LOCAL PFNGLFLUSHPROC glad_glFlush = NULL;
+GLAD_THREAD_LOCAL PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_glFlushMappedBufferRange = NULL;
+GLAD_THREAD_LOCAL PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_glFlushMappedNamedBufferRange = NULL;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERPARAMETERIPROC glad_glFramebufferParameteri = NULL;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_glFramebufferRenderbuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERTEXTUREPROC glad_glFramebufferTexture = NULL;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERTEXTURE1DPROC glad_glFramebufferTexture1D = NULL;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERTEXTURE2DPROC glad_glFramebufferTexture2D = NULL;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERTEXTURE3DPROC glad_glFramebufferTexture3D = NULL;
+GLAD_THREAD_LOCAL PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_glFramebufferTextureLayer = NULL;
+GLAD_THREAD_LOCAL PFNGLFRONTFACEPROC glad_glFrontFace = NULL;
+GLAD_THREAD_LOCAL PFNGLGENBUFFERSPROC glad_glGenBuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLGENFRAMEBUFFERSPROC glad_glGenFramebuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLGENPROGRAMPIPELINESPROC glad_glGenProgramPipelines = NULL;
+GLAD_THREAD_LOCAL PFNGLGENQUERIESPROC glad_glGenQueries = NULL;
+GLAD_THREAD_LOCAL PFNGLGENRENDERBUFFERSPROC glad_glGenRenderbuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLGENSAMPLERSPROC glad_glGenSamplers = NULL;
+GLAD_THREAD_LOCAL PFNGLGENTEXTURESPROC glad_glGenTextures = NULL;
+GLAD_THREAD_LOCAL PFNGLGENTRANSFORMFEEDBACKSPROC glad_glGenTransformFeedbacks = NULL;
+GLAD_THREAD_LOCAL PFNGLGENVERTEXARRAYSPROC glad_glGenVertexArrays = NULL;
+GLAD_THREAD_LOCAL PFNGLGENERATEMIPMAPPROC glad_glGenerateMipmap = NULL;
+GLAD_THREAD_LOCAL PFNGLGENERATETEXTUREMIPMAPPROC glad_glGenerateTextureMipmap = NULL;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_glGetActiveAtomicCounterBufferiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEATTRIBPROC glad_glGetActiveAttrib = NULL;
+GLAD_THREAD_LOCAL PFNGLGETACTIVESUBROUTINENAMEPROC glad_glGetActiveSubroutineName = NULL;
+GLAD_THREAD_LOCAL PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_glGetActiveSubroutineUniformName = NULL;
+GLAD_THREAD_LOCAL PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_glGetActiveSubroutineUniformiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEUNIFORMPROC glad_glGetActiveUniform = NULL;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_glGetActiveUniformBlockName = NULL;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_glGetActiveUniformBlockiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEUNIFORMNAMEPROC glad_glGetActiveUniformName = NULL;
+GLAD_THREAD_LOCAL PFNGLGETACTIVEUNIFORMSIVPROC glad_glGetActiveUniformsiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETATTACHEDSHADERSPROC glad_glGetAttachedShaders = NULL;
+GLAD_THREAD_LOCAL PFNGLGETATTRIBLOCATIONPROC glad_glGetAttribLocation = NULL;
+GLAD_THREAD_LOCAL PFNGLGETBOOLEANI_VPROC glad_glGetBooleani_v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETBOOLEANVPROC glad_glGetBooleanv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETBUFFERPARAMETERI64VPROC glad_glGetBufferParameteri64v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETBUFFERPARAMETERIVPROC glad_glGetBufferParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETBUFFERPOINTERVPROC glad_glGetBufferPointerv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETBUFFERSUBDATAPROC glad_glGetBufferSubData = NULL;
+GLAD_THREAD_LOCAL PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_glGetCompressedTexImage = NULL;
+GLAD_THREAD_LOCAL PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_glGetCompressedTextureImage = NULL;
+GLAD_THREAD_LOCAL PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_glGetCompressedTextureSubImage = NULL;
+GLAD_THREAD_LOCAL PFNGLGETDEBUGMESSAGELOGPROC glad_glGetDebugMessageLog = NULL;
+GLAD_THREAD_LOCAL PFNGLGETDOUBLEI_VPROC glad_glGetDoublei_v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETDOUBLEVPROC glad_glGetDoublev = NULL;
+GLAD_THREAD_LOCAL PFNGLGETERRORPROC glad_glGetError = NULL;
+GLAD_THREAD_LOCAL PFNGLGETFLOATI_VPROC glad_glGetFloati_v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETFLOATVPROC glad_glGetFloatv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETFRAGDATAINDEXPROC glad_glGetFragDataIndex = NULL;
+GLAD_THREAD_LOCAL PFNGLGETFRAGDATALOCATIONPROC glad_glGetFragDataLocation = NULL;
+GLAD_THREAD_LOCAL PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetFramebufferAttachmentParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_glGetFramebufferParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETGRAPHICSRESETSTATUSPROC glad_glGetGraphicsResetStatus = NULL;
+GLAD_THREAD_LOCAL PFNGLGETINTEGER64I_VPROC glad_glGetInteger64i_v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETINTEGER64VPROC glad_glGetInteger64v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETINTEGERI_VPROC glad_glGetIntegeri_v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETINTEGERVPROC glad_glGetIntegerv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETINTERNALFORMATI64VPROC glad_glGetInternalformati64v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETINTERNALFORMATIVPROC glad_glGetInternalformativ = NULL;
+GLAD_THREAD_LOCAL PFNGLGETMULTISAMPLEFVPROC glad_glGetMultisamplefv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_glGetNamedBufferParameteri64v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_glGetNamedBufferParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDBUFFERPOINTERVPROC glad_glGetNamedBufferPointerv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDBUFFERSUBDATAPROC glad_glGetNamedBufferSubData = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_glGetNamedFramebufferAttachmentParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_glGetNamedFramebufferParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_glGetNamedRenderbufferParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETOBJECTLABELPROC glad_glGetObjectLabel = NULL;
+GLAD_THREAD_LOCAL PFNGLGETOBJECTPTRLABELPROC glad_glGetObjectPtrLabel = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPOINTERVPROC glad_glGetPointerv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMBINARYPROC glad_glGetProgramBinary = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMINFOLOGPROC glad_glGetProgramInfoLog = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMINTERFACEIVPROC glad_glGetProgramInterfaceiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_glGetProgramPipelineInfoLog = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMPIPELINEIVPROC glad_glGetProgramPipelineiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMRESOURCEINDEXPROC glad_glGetProgramResourceIndex = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_glGetProgramResourceLocation = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_glGetProgramResourceLocationIndex = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMRESOURCENAMEPROC glad_glGetProgramResourceName = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMRESOURCEIVPROC glad_glGetProgramResourceiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMSTAGEIVPROC glad_glGetProgramStageiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETPROGRAMIVPROC glad_glGetProgramiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_glGetQueryBufferObjecti64v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETQUERYBUFFEROBJECTIVPROC glad_glGetQueryBufferObjectiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_glGetQueryBufferObjectui64v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_glGetQueryBufferObjectuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETQUERYINDEXEDIVPROC glad_glGetQueryIndexediv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETQUERYOBJECTI64VPROC glad_glGetQueryObjecti64v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETQUERYOBJECTIVPROC glad_glGetQueryObjectiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETQUERYOBJECTUI64VPROC glad_glGetQueryObjectui64v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETQUERYOBJECTUIVPROC glad_glGetQueryObjectuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETQUERYIVPROC glad_glGetQueryiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_glGetRenderbufferParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSAMPLERPARAMETERIIVPROC glad_glGetSamplerParameterIiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSAMPLERPARAMETERIUIVPROC glad_glGetSamplerParameterIuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSAMPLERPARAMETERFVPROC glad_glGetSamplerParameterfv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSAMPLERPARAMETERIVPROC glad_glGetSamplerParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSHADERINFOLOGPROC glad_glGetShaderInfoLog = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSHADERPRECISIONFORMATPROC glad_glGetShaderPrecisionFormat = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSHADERSOURCEPROC glad_glGetShaderSource = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSHADERIVPROC glad_glGetShaderiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSTRINGPROC glad_glGetString = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSTRINGIPROC glad_glGetStringi = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSUBROUTINEINDEXPROC glad_glGetSubroutineIndex = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_glGetSubroutineUniformLocation = NULL;
+GLAD_THREAD_LOCAL PFNGLGETSYNCIVPROC glad_glGetSynciv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXIMAGEPROC glad_glGetTexImage = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXLEVELPARAMETERFVPROC glad_glGetTexLevelParameterfv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXLEVELPARAMETERIVPROC glad_glGetTexLevelParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXPARAMETERIIVPROC glad_glGetTexParameterIiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXPARAMETERIUIVPROC glad_glGetTexParameterIuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXPARAMETERFVPROC glad_glGetTexParameterfv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXPARAMETERIVPROC glad_glGetTexParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXTUREIMAGEPROC glad_glGetTextureImage = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_glGetTextureLevelParameterfv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_glGetTextureLevelParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXTUREPARAMETERIIVPROC glad_glGetTextureParameterIiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXTUREPARAMETERIUIVPROC glad_glGetTextureParameterIuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXTUREPARAMETERFVPROC glad_glGetTextureParameterfv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXTUREPARAMETERIVPROC glad_glGetTextureParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTEXTURESUBIMAGEPROC glad_glGetTextureSubImage = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_glGetTransformFeedbackVarying = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_glGetTransformFeedbacki64_v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_glGetTransformFeedbacki_v = NULL;
+GLAD_THREAD_LOCAL PFNGLGETTRANSFORMFEEDBACKIVPROC glad_glGetTransformFeedbackiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMBLOCKINDEXPROC glad_glGetUniformBlockIndex = NULL;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMINDICESPROC glad_glGetUniformIndices = NULL;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMLOCATIONPROC glad_glGetUniformLocation = NULL;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_glGetUniformSubroutineuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMDVPROC glad_glGetUniformdv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMFVPROC glad_glGetUniformfv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMIVPROC glad_glGetUniformiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETUNIFORMUIVPROC glad_glGetUniformuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_glGetVertexArrayIndexed64iv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_glGetVertexArrayIndexediv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXARRAYIVPROC glad_glGetVertexArrayiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBIIVPROC glad_glGetVertexAttribIiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBIUIVPROC glad_glGetVertexAttribIuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBLDVPROC glad_glGetVertexAttribLdv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBPOINTERVPROC glad_glGetVertexAttribPointerv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBDVPROC glad_glGetVertexAttribdv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBFVPROC glad_glGetVertexAttribfv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETVERTEXATTRIBIVPROC glad_glGetVertexAttribiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNCOLORTABLEPROC glad_glGetnColorTable = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_glGetnCompressedTexImage = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNCONVOLUTIONFILTERPROC glad_glGetnConvolutionFilter = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNHISTOGRAMPROC glad_glGetnHistogram = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNMAPDVPROC glad_glGetnMapdv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNMAPFVPROC glad_glGetnMapfv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNMAPIVPROC glad_glGetnMapiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNMINMAXPROC glad_glGetnMinmax = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNPIXELMAPFVPROC glad_glGetnPixelMapfv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNPIXELMAPUIVPROC glad_glGetnPixelMapuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNPIXELMAPUSVPROC glad_glGetnPixelMapusv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNPOLYGONSTIPPLEPROC glad_glGetnPolygonStipple = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNSEPARABLEFILTERPROC glad_glGetnSeparableFilter = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNTEXIMAGEPROC glad_glGetnTexImage = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNUNIFORMDVPROC glad_glGetnUniformdv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNUNIFORMFVPROC glad_glGetnUniformfv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNUNIFORMIVPROC glad_glGetnUniformiv = NULL;
+GLAD_THREAD_LOCAL PFNGLGETNUNIFORMUIVPROC glad_glGetnUniformuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLHINTPROC glad_glHint = NULL;
+GLAD_THREAD_LOCAL PFNGLINVALIDATEBUFFERDATAPROC glad_glInvalidateBufferData = NULL;
+GLAD_THREAD_LOCAL PFNGLINVALIDATEBUFFERSUBDATAPROC glad_glInvalidateBufferSubData = NULL;
+GLAD_THREAD_LOCAL PFNGLINVALIDATEFRAMEBUFFERPROC glad_glInvalidateFramebuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_glInvalidateNamedFramebufferData = NULL;
+GLAD_THREAD_LOCAL PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_glInvalidateNamedFramebufferSubData = NULL;
+GLAD_THREAD_LOCAL PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_glInvalidateSubFramebuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLINVALIDATETEXIMAGEPROC glad_glInvalidateTexImage = NULL;
+GLAD_THREAD_LOCAL PFNGLINVALIDATETEXSUBIMAGEPROC glad_glInvalidateTexSubImage = NULL;
+GLAD_THREAD_LOCAL PFNGLISBUFFERPROC glad_glIsBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLISENABLEDPROC glad_glIsEnabled = NULL;
+GLAD_THREAD_LOCAL PFNGLISENABLEDIPROC glad_glIsEnabledi = NULL;
+GLAD_THREAD_LOCAL PFNGLISFRAMEBUFFERPROC glad_glIsFramebuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLISPROGRAMPROC glad_glIsProgram = NULL;
+GLAD_THREAD_LOCAL PFNGLISPROGRAMPIPELINEPROC glad_glIsProgramPipeline = NULL;
+GLAD_THREAD_LOCAL PFNGLISQUERYPROC glad_glIsQuery = NULL;
+GLAD_THREAD_LOCAL PFNGLISRENDERBUFFERPROC glad_glIsRenderbuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLISSAMPLERPROC glad_glIsSampler = NULL;
+GLAD_THREAD_LOCAL PFNGLISSHADERPROC glad_glIsShader = NULL;
+GLAD_THREAD_LOCAL PFNGLISSYNCPROC glad_glIsSync = NULL;
+GLAD_THREAD_LOCAL PFNGLISTEXTUREPROC glad_glIsTexture = NULL;
+GLAD_THREAD_LOCAL PFNGLISTRANSFORMFEEDBACKPROC glad_glIsTransformFeedback = NULL;
+GLAD_THREAD_LOCAL PFNGLISVERTEXARRAYPROC glad_glIsVertexArray = NULL;
+GLAD_THREAD_LOCAL PFNGLLINEWIDTHPROC glad_glLineWidth = NULL;
+GLAD_THREAD_LOCAL PFNGLLINKPROGRAMPROC glad_glLinkProgram = NULL;
+GLAD_THREAD_LOCAL PFNGLLOGICOPPROC glad_glLogicOp = NULL;
+GLAD_THREAD_LOCAL PFNGLMAPBUFFERPROC glad_glMapBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLMAPBUFFERRANGEPROC glad_glMapBufferRange = NULL;
+GLAD_THREAD_LOCAL PFNGLMAPNAMEDBUFFERPROC glad_glMapNamedBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLMAPNAMEDBUFFERRANGEPROC glad_glMapNamedBufferRange = NULL;
+GLAD_THREAD_LOCAL PFNGLMEMORYBARRIERPROC glad_glMemoryBarrier = NULL;
+GLAD_THREAD_LOCAL PFNGLMEMORYBARRIERBYREGIONPROC glad_glMemoryBarrierByRegion = NULL;
+GLAD_THREAD_LOCAL PFNGLMINSAMPLESHADINGPROC glad_glMinSampleShading = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWARRAYSPROC glad_glMultiDrawArrays = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_glMultiDrawArraysIndirect = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_glMultiDrawArraysIndirectCount = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWELEMENTSPROC glad_glMultiDrawElements = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_glMultiDrawElementsBaseVertex = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_glMultiDrawElementsIndirect = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_glMultiDrawElementsIndirectCount = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP1UIPROC glad_glMultiTexCoordP1ui = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP1UIVPROC glad_glMultiTexCoordP1uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP2UIPROC glad_glMultiTexCoordP2ui = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP2UIVPROC glad_glMultiTexCoordP2uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP3UIPROC glad_glMultiTexCoordP3ui = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP3UIVPROC glad_glMultiTexCoordP3uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP4UIPROC glad_glMultiTexCoordP4ui = NULL;
+GLAD_THREAD_LOCAL PFNGLMULTITEXCOORDP4UIVPROC glad_glMultiTexCoordP4uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLNAMEDBUFFERDATAPROC glad_glNamedBufferData = NULL;
+GLAD_THREAD_LOCAL PFNGLNAMEDBUFFERSTORAGEPROC glad_glNamedBufferStorage = NULL;
+GLAD_THREAD_LOCAL PFNGLNAMEDBUFFERSUBDATAPROC glad_glNamedBufferSubData = NULL;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_glNamedFramebufferDrawBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_glNamedFramebufferDrawBuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_glNamedFramebufferParameteri = NULL;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_glNamedFramebufferReadBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_glNamedFramebufferRenderbuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_glNamedFramebufferTexture = NULL;
+GLAD_THREAD_LOCAL PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_glNamedFramebufferTextureLayer = NULL;
+GLAD_THREAD_LOCAL PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_glNamedRenderbufferStorage = NULL;
+GLAD_THREAD_LOCAL PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glNamedRenderbufferStorageMultisample = NULL;
+GLAD_THREAD_LOCAL PFNGLNORMALP3UIPROC glad_glNormalP3ui = NULL;
+GLAD_THREAD_LOCAL PFNGLNORMALP3UIVPROC glad_glNormalP3uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLOBJECTLABELPROC glad_glObjectLabel = NULL;
+GLAD_THREAD_LOCAL PFNGLOBJECTPTRLABELPROC glad_glObjectPtrLabel = NULL;
+GLAD_THREAD_LOCAL PFNGLPATCHPARAMETERFVPROC glad_glPatchParameterfv = NULL;
+GLAD_THREAD_LOCAL PFNGLPATCHPARAMETERIPROC glad_glPatchParameteri = NULL;
+GLAD_THREAD_LOCAL PFNGLPAUSETRANSFORMFEEDBACKPROC glad_glPauseTransformFeedback = NULL;
+GLAD_THREAD_LOCAL PFNGLPIXELSTOREFPROC glad_glPixelStoref = NULL;
+GLAD_THREAD_LOCAL PFNGLPIXELSTOREIPROC glad_glPixelStorei = NULL;
+GLAD_THREAD_LOCAL PFNGLPOINTPARAMETERFPROC glad_glPointParameterf = NULL;
+GLAD_THREAD_LOCAL PFNGLPOINTPARAMETERFVPROC glad_glPointParameterfv = NULL;
+GLAD_THREAD_LOCAL PFNGLPOINTPARAMETERIPROC glad_glPointParameteri = NULL;
+GLAD_THREAD_LOCAL PFNGLPOINTPARAMETERIVPROC glad_glPointParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLPOINTSIZEPROC glad_glPointSize = NULL;
+GLAD_THREAD_LOCAL PFNGLPOLYGONMODEPROC glad_glPolygonMode = NULL;
+GLAD_THREAD_LOCAL PFNGLPOLYGONOFFSETPROC glad_glPolygonOffset = NULL;
+GLAD_THREAD_LOCAL PFNGLPOLYGONOFFSETCLAMPPROC glad_glPolygonOffsetClamp = NULL;
+GLAD_THREAD_LOCAL PFNGLPOPDEBUGGROUPPROC glad_glPopDebugGroup = NULL;
+GLAD_THREAD_LOCAL PFNGLPRIMITIVERESTARTINDEXPROC glad_glPrimitiveRestartIndex = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMBINARYPROC glad_glProgramBinary = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMPARAMETERIPROC glad_glProgramParameteri = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1DPROC glad_glProgramUniform1d = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1DVPROC glad_glProgramUniform1dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1FPROC glad_glProgramUniform1f = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1FVPROC glad_glProgramUniform1fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1IPROC glad_glProgramUniform1i = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1IVPROC glad_glProgramUniform1iv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1UIPROC glad_glProgramUniform1ui = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM1UIVPROC glad_glProgramUniform1uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2DPROC glad_glProgramUniform2d = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2DVPROC glad_glProgramUniform2dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2FPROC glad_glProgramUniform2f = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2FVPROC glad_glProgramUniform2fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2IPROC glad_glProgramUniform2i = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2IVPROC glad_glProgramUniform2iv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2UIPROC glad_glProgramUniform2ui = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM2UIVPROC glad_glProgramUniform2uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3DPROC glad_glProgramUniform3d = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3DVPROC glad_glProgramUniform3dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3FPROC glad_glProgramUniform3f = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3FVPROC glad_glProgramUniform3fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3IPROC glad_glProgramUniform3i = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3IVPROC glad_glProgramUniform3iv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3UIPROC glad_glProgramUniform3ui = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM3UIVPROC glad_glProgramUniform3uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4DPROC glad_glProgramUniform4d = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4DVPROC glad_glProgramUniform4dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4FPROC glad_glProgramUniform4f = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4FVPROC glad_glProgramUniform4fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4IPROC glad_glProgramUniform4i = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4IVPROC glad_glProgramUniform4iv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4UIPROC glad_glProgramUniform4ui = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORM4UIVPROC glad_glProgramUniform4uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_glProgramUniformMatrix2dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_glProgramUniformMatrix2fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_glProgramUniformMatrix2x3dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_glProgramUniformMatrix2x3fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_glProgramUniformMatrix2x4dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_glProgramUniformMatrix2x4fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_glProgramUniformMatrix3dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_glProgramUniformMatrix3fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_glProgramUniformMatrix3x2dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_glProgramUniformMatrix3x2fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_glProgramUniformMatrix3x4dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_glProgramUniformMatrix3x4fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_glProgramUniformMatrix4dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_glProgramUniformMatrix4fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_glProgramUniformMatrix4x2dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_glProgramUniformMatrix4x2fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_glProgramUniformMatrix4x3dv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_glProgramUniformMatrix4x3fv = NULL;
+GLAD_THREAD_LOCAL PFNGLPROVOKINGVERTEXPROC glad_glProvokingVertex = NULL;
+GLAD_THREAD_LOCAL PFNGLPUSHDEBUGGROUPPROC glad_glPushDebugGroup = NULL;
+GLAD_THREAD_LOCAL PFNGLQUERYCOUNTERPROC glad_glQueryCounter = NULL;
+GLAD_THREAD_LOCAL PFNGLREADBUFFERPROC glad_glReadBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLREADPIXELSPROC glad_glReadPixels = NULL;
+GLAD_THREAD_LOCAL PFNGLREADNPIXELSPROC glad_glReadnPixels = NULL;
+GLAD_THREAD_LOCAL PFNGLRELEASESHADERCOMPILERPROC glad_glReleaseShaderCompiler = NULL;
+GLAD_THREAD_LOCAL PFNGLRENDERBUFFERSTORAGEPROC glad_glRenderbufferStorage = NULL;
+GLAD_THREAD_LOCAL PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_glRenderbufferStorageMultisample = NULL;
+GLAD_THREAD_LOCAL PFNGLRESUMETRANSFORMFEEDBACKPROC glad_glResumeTransformFeedback = NULL;
+GLAD_THREAD_LOCAL PFNGLSAMPLECOVERAGEPROC glad_glSampleCoverage = NULL;
+GLAD_THREAD_LOCAL PFNGLSAMPLEMASKIPROC glad_glSampleMaski = NULL;
+GLAD_THREAD_LOCAL PFNGLSAMPLERPARAMETERIIVPROC glad_glSamplerParameterIiv = NULL;
+GLAD_THREAD_LOCAL PFNGLSAMPLERPARAMETERIUIVPROC glad_glSamplerParameterIuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLSAMPLERPARAMETERFPROC glad_glSamplerParameterf = NULL;
+GLAD_THREAD_LOCAL PFNGLSAMPLERPARAMETERFVPROC glad_glSamplerParameterfv = NULL;
+GLAD_THREAD_LOCAL PFNGLSAMPLERPARAMETERIPROC glad_glSamplerParameteri = NULL;
+GLAD_THREAD_LOCAL PFNGLSAMPLERPARAMETERIVPROC glad_glSamplerParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLSCISSORPROC glad_glScissor = NULL;
+GLAD_THREAD_LOCAL PFNGLSCISSORARRAYVPROC glad_glScissorArrayv = NULL;
+GLAD_THREAD_LOCAL PFNGLSCISSORINDEXEDPROC glad_glScissorIndexed = NULL;
+GLAD_THREAD_LOCAL PFNGLSCISSORINDEXEDVPROC glad_glScissorIndexedv = NULL;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLORP3UIPROC glad_glSecondaryColorP3ui = NULL;
+GLAD_THREAD_LOCAL PFNGLSECONDARYCOLORP3UIVPROC glad_glSecondaryColorP3uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLSHADERBINARYPROC glad_glShaderBinary = NULL;
+GLAD_THREAD_LOCAL PFNGLSHADERSOURCEPROC glad_glShaderSource = NULL;
+GLAD_THREAD_LOCAL PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_glShaderStorageBlockBinding = NULL;
+GLAD_THREAD_LOCAL PFNGLSPECIALIZESHADERPROC glad_glSpecializeShader = NULL;
+GLAD_THREAD_LOCAL PFNGLSTENCILFUNCPROC glad_glStencilFunc = NULL;
+GLAD_THREAD_LOCAL PFNGLSTENCILFUNCSEPARATEPROC glad_glStencilFuncSeparate = NULL;
+GLAD_THREAD_LOCAL PFNGLSTENCILMASKPROC glad_glStencilMask = NULL;
+GLAD_THREAD_LOCAL PFNGLSTENCILMASKSEPARATEPROC glad_glStencilMaskSeparate = NULL;
+GLAD_THREAD_LOCAL PFNGLSTENCILOPPROC glad_glStencilOp = NULL;
+GLAD_THREAD_LOCAL PFNGLSTENCILOPSEPARATEPROC glad_glStencilOpSeparate = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXBUFFERPROC glad_glTexBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXBUFFERRANGEPROC glad_glTexBufferRange = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP1UIPROC glad_glTexCoordP1ui = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP1UIVPROC glad_glTexCoordP1uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP2UIPROC glad_glTexCoordP2ui = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP2UIVPROC glad_glTexCoordP2uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP3UIPROC glad_glTexCoordP3ui = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP3UIVPROC glad_glTexCoordP3uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP4UIPROC glad_glTexCoordP4ui = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXCOORDP4UIVPROC glad_glTexCoordP4uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXIMAGE1DPROC glad_glTexImage1D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXIMAGE2DPROC glad_glTexImage2D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_glTexImage2DMultisample = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXIMAGE3DPROC glad_glTexImage3D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_glTexImage3DMultisample = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXPARAMETERIIVPROC glad_glTexParameterIiv = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXPARAMETERIUIVPROC glad_glTexParameterIuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXPARAMETERFPROC glad_glTexParameterf = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXPARAMETERFVPROC glad_glTexParameterfv = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXPARAMETERIPROC glad_glTexParameteri = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXPARAMETERIVPROC glad_glTexParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXSTORAGE1DPROC glad_glTexStorage1D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXSTORAGE2DPROC glad_glTexStorage2D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_glTexStorage2DMultisample = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXSTORAGE3DPROC glad_glTexStorage3D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_glTexStorage3DMultisample = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXSUBIMAGE1DPROC glad_glTexSubImage1D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXSUBIMAGE2DPROC glad_glTexSubImage2D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXSUBIMAGE3DPROC glad_glTexSubImage3D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTUREBARRIERPROC glad_glTextureBarrier = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTUREBUFFERPROC glad_glTextureBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTUREBUFFERRANGEPROC glad_glTextureBufferRange = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTUREPARAMETERIIVPROC glad_glTextureParameterIiv = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTUREPARAMETERIUIVPROC glad_glTextureParameterIuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTUREPARAMETERFPROC glad_glTextureParameterf = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTUREPARAMETERFVPROC glad_glTextureParameterfv = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTUREPARAMETERIPROC glad_glTextureParameteri = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTUREPARAMETERIVPROC glad_glTextureParameteriv = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTURESTORAGE1DPROC glad_glTextureStorage1D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTURESTORAGE2DPROC glad_glTextureStorage2D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_glTextureStorage2DMultisample = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTURESTORAGE3DPROC glad_glTextureStorage3D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_glTextureStorage3DMultisample = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTURESUBIMAGE1DPROC glad_glTextureSubImage1D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTURESUBIMAGE2DPROC glad_glTextureSubImage2D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTURESUBIMAGE3DPROC glad_glTextureSubImage3D = NULL;
+GLAD_THREAD_LOCAL PFNGLTEXTUREVIEWPROC glad_glTextureView = NULL;
+GLAD_THREAD_LOCAL PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_glTransformFeedbackBufferBase = NULL;
+GLAD_THREAD_LOCAL PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_glTransformFeedbackBufferRange = NULL;
+GLAD_THREAD_LOCAL PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_glTransformFeedbackVaryings = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1DPROC glad_glUniform1d = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1DVPROC glad_glUniform1dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1FPROC glad_glUniform1f = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1FVPROC glad_glUniform1fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1IPROC glad_glUniform1i = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1IVPROC glad_glUniform1iv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1UIPROC glad_glUniform1ui = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM1UIVPROC glad_glUniform1uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2DPROC glad_glUniform2d = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2DVPROC glad_glUniform2dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2FPROC glad_glUniform2f = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2FVPROC glad_glUniform2fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2IPROC glad_glUniform2i = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2IVPROC glad_glUniform2iv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2UIPROC glad_glUniform2ui = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM2UIVPROC glad_glUniform2uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3DPROC glad_glUniform3d = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3DVPROC glad_glUniform3dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3FPROC glad_glUniform3f = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3FVPROC glad_glUniform3fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3IPROC glad_glUniform3i = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3IVPROC glad_glUniform3iv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3UIPROC glad_glUniform3ui = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM3UIVPROC glad_glUniform3uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4DPROC glad_glUniform4d = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4DVPROC glad_glUniform4dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4FPROC glad_glUniform4f = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4FVPROC glad_glUniform4fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4IPROC glad_glUniform4i = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4IVPROC glad_glUniform4iv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4UIPROC glad_glUniform4ui = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORM4UIVPROC glad_glUniform4uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMBLOCKBINDINGPROC glad_glUniformBlockBinding = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX2DVPROC glad_glUniformMatrix2dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX2FVPROC glad_glUniformMatrix2fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX2X3DVPROC glad_glUniformMatrix2x3dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX2X3FVPROC glad_glUniformMatrix2x3fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX2X4DVPROC glad_glUniformMatrix2x4dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX2X4FVPROC glad_glUniformMatrix2x4fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX3DVPROC glad_glUniformMatrix3dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX3FVPROC glad_glUniformMatrix3fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX3X2DVPROC glad_glUniformMatrix3x2dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX3X2FVPROC glad_glUniformMatrix3x2fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX3X4DVPROC glad_glUniformMatrix3x4dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX3X4FVPROC glad_glUniformMatrix3x4fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX4DVPROC glad_glUniformMatrix4dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX4FVPROC glad_glUniformMatrix4fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX4X2DVPROC glad_glUniformMatrix4x2dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX4X2FVPROC glad_glUniformMatrix4x2fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX4X3DVPROC glad_glUniformMatrix4x3dv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMMATRIX4X3FVPROC glad_glUniformMatrix4x3fv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNIFORMSUBROUTINESUIVPROC glad_glUniformSubroutinesuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLUNMAPBUFFERPROC glad_glUnmapBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLUNMAPNAMEDBUFFERPROC glad_glUnmapNamedBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLUSEPROGRAMPROC glad_glUseProgram = NULL;
+GLAD_THREAD_LOCAL PFNGLUSEPROGRAMSTAGESPROC glad_glUseProgramStages = NULL;
+GLAD_THREAD_LOCAL PFNGLVALIDATEPROGRAMPROC glad_glValidateProgram = NULL;
+GLAD_THREAD_LOCAL PFNGLVALIDATEPROGRAMPIPELINEPROC glad_glValidateProgramPipeline = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_glVertexArrayAttribBinding = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYATTRIBFORMATPROC glad_glVertexArrayAttribFormat = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_glVertexArrayAttribIFormat = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_glVertexArrayAttribLFormat = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_glVertexArrayBindingDivisor = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_glVertexArrayElementBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_glVertexArrayVertexBuffer = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_glVertexArrayVertexBuffers = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB1DPROC glad_glVertexAttrib1d = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB1DVPROC glad_glVertexAttrib1dv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB1FPROC glad_glVertexAttrib1f = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB1FVPROC glad_glVertexAttrib1fv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB1SPROC glad_glVertexAttrib1s = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB1SVPROC glad_glVertexAttrib1sv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB2DPROC glad_glVertexAttrib2d = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB2DVPROC glad_glVertexAttrib2dv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB2FPROC glad_glVertexAttrib2f = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB2FVPROC glad_glVertexAttrib2fv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB2SPROC glad_glVertexAttrib2s = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB2SVPROC glad_glVertexAttrib2sv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB3DPROC glad_glVertexAttrib3d = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB3DVPROC glad_glVertexAttrib3dv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB3FPROC glad_glVertexAttrib3f = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB3FVPROC glad_glVertexAttrib3fv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB3SPROC glad_glVertexAttrib3s = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB3SVPROC glad_glVertexAttrib3sv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NBVPROC glad_glVertexAttrib4Nbv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NIVPROC glad_glVertexAttrib4Niv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NSVPROC glad_glVertexAttrib4Nsv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NUBPROC glad_glVertexAttrib4Nub = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NUBVPROC glad_glVertexAttrib4Nubv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NUIVPROC glad_glVertexAttrib4Nuiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4NUSVPROC glad_glVertexAttrib4Nusv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4BVPROC glad_glVertexAttrib4bv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4DPROC glad_glVertexAttrib4d = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4DVPROC glad_glVertexAttrib4dv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4FPROC glad_glVertexAttrib4f = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4FVPROC glad_glVertexAttrib4fv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4IVPROC glad_glVertexAttrib4iv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4SPROC glad_glVertexAttrib4s = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4SVPROC glad_glVertexAttrib4sv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4UBVPROC glad_glVertexAttrib4ubv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4UIVPROC glad_glVertexAttrib4uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIB4USVPROC glad_glVertexAttrib4usv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBBINDINGPROC glad_glVertexAttribBinding = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBDIVISORPROC glad_glVertexAttribDivisor = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBFORMATPROC glad_glVertexAttribFormat = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI1IPROC glad_glVertexAttribI1i = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI1IVPROC glad_glVertexAttribI1iv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI1UIPROC glad_glVertexAttribI1ui = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI1UIVPROC glad_glVertexAttribI1uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI2IPROC glad_glVertexAttribI2i = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI2IVPROC glad_glVertexAttribI2iv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI2UIPROC glad_glVertexAttribI2ui = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI2UIVPROC glad_glVertexAttribI2uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI3IPROC glad_glVertexAttribI3i = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI3IVPROC glad_glVertexAttribI3iv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI3UIPROC glad_glVertexAttribI3ui = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI3UIVPROC glad_glVertexAttribI3uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4BVPROC glad_glVertexAttribI4bv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4IPROC glad_glVertexAttribI4i = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4IVPROC glad_glVertexAttribI4iv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4SVPROC glad_glVertexAttribI4sv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4UBVPROC glad_glVertexAttribI4ubv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4UIPROC glad_glVertexAttribI4ui = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4UIVPROC glad_glVertexAttribI4uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBI4USVPROC glad_glVertexAttribI4usv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBIFORMATPROC glad_glVertexAttribIFormat = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBIPOINTERPROC glad_glVertexAttribIPointer = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL1DPROC glad_glVertexAttribL1d = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL1DVPROC glad_glVertexAttribL1dv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL2DPROC glad_glVertexAttribL2d = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL2DVPROC glad_glVertexAttribL2dv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL3DPROC glad_glVertexAttribL3d = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL3DVPROC glad_glVertexAttribL3dv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL4DPROC glad_glVertexAttribL4d = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBL4DVPROC glad_glVertexAttribL4dv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBLFORMATPROC glad_glVertexAttribLFormat = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBLPOINTERPROC glad_glVertexAttribLPointer = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP1UIPROC glad_glVertexAttribP1ui = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP1UIVPROC glad_glVertexAttribP1uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP2UIPROC glad_glVertexAttribP2ui = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP2UIVPROC glad_glVertexAttribP2uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP3UIPROC glad_glVertexAttribP3ui = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP3UIVPROC glad_glVertexAttribP3uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP4UIPROC glad_glVertexAttribP4ui = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBP4UIVPROC glad_glVertexAttribP4uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXATTRIBPOINTERPROC glad_glVertexAttribPointer = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXBINDINGDIVISORPROC glad_glVertexBindingDivisor = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXP2UIPROC glad_glVertexP2ui = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXP2UIVPROC glad_glVertexP2uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXP3UIPROC glad_glVertexP3ui = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXP3UIVPROC glad_glVertexP3uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXP4UIPROC glad_glVertexP4ui = NULL;
+GLAD_THREAD_LOCAL PFNGLVERTEXP4UIVPROC glad_glVertexP4uiv = NULL;
+GLAD_THREAD_LOCAL PFNGLVIEWPORTPROC glad_glViewport = NULL;
+GLAD_THREAD_LOCAL PFNGLVIEWPORTARRAYVPROC glad_glViewportArrayv = NULL;
+GLAD_THREAD_LOCAL PFNGLVIEWPORTINDEXEDFPROC glad_glViewportIndexedf = NULL;
+GLAD_THREAD_LOCAL PFNGLVIEWPORTINDEXEDFVPROC glad_glViewportIndexedfv = NULL;
+GLAD_THREAD_LOCAL PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
 static void load_GL_VERSION_1_0(GLADloadproc load) {
 	if(!GLAD_GL_VERSION_1_0) return;
 	glad_glCullFace = (PFNGLCULLFACEPROC)load("glCullFace");
@@ -1831,3 +1837,83 @@ int gladLoadGLLoader(GLADloadproc load) {
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
+
+/* learn_opengl: capped and lazy loading, see glad.h */
+
+void glad_lazy_install(GLADloadproc load);
+
+static void cap_coreGL(int major, int minor) {
+#define GLAD_CAP(flag, M, m) if ((M) > major || ((M) == major && (m) > minor)) flag = 0
+	GLAD_CAP(GLAD_GL_VERSION_1_0, 1, 0);
+	GLAD_CAP(GLAD_GL_VERSION_1_1, 1, 1);
+	GLAD_CAP(GLAD_GL_VERSION_1_2, 1, 2);
+	GLAD_CAP(GLAD_GL_VERSION_1_3, 1, 3);
+	GLAD_CAP(GLAD_GL_VERSION_1_4, 1, 4);
+	GLAD_CAP(GLAD_GL_VERSION_1_5, 1, 5);
+	GLAD_CAP(GLAD_GL_VERSION_2_0, 2, 0);
+	GLAD_CAP(GLAD_GL_VERSION_2_1, 2, 1);
+	GLAD_CAP(GLAD_GL_VERSION_3_0, 3, 0);
+	GLAD_CAP(GLAD_GL_VERSION_3_1, 3, 1);
+	GLAD_CAP(GLAD_GL_VERSION_3_2, 3, 2);
+	GLAD_CAP(GLAD_GL_VERSION_3_3, 3, 3);
+	GLAD_CAP(GLAD_GL_VERSION_4_0, 4, 0);
+	GLAD_CAP(GLAD_GL_VERSION_4_1, 4, 1);
+	GLAD_CAP(GLAD_GL_VERSION_4_2, 4, 2);
+	GLAD_CAP(GLAD_GL_VERSION_4_3, 4, 3);
+	GLAD_CAP(GLAD_GL_VERSION_4_4, 4, 4);
+	GLAD_CAP(GLAD_GL_VERSION_4_5, 4, 5);
+	GLAD_CAP(GLAD_GL_VERSION_4_6, 4, 6);
+#undef GLAD_CAP
+	if (GLVersion.major > major || (GLVersion.major == major && GLVersion.minor > minor)) {
+		GLVersion.major = major;
+		GLVersion.minor = minor;
+	}
+	/* glGetStringi is only loaded from 3.0 on */
+	if (max_loaded_major > major || (max_loaded_major == major && max_loaded_minor > minor)) {
+		max_loaded_major = major;
+		max_loaded_minor = minor;
+	}
+}
+
+int gladLoadGLLoaderUpTo(GLADloadproc load, int major, int minor) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	cap_coreGL(major, minor);
+	load_GL_VERSION_1_0(load);
+	load_GL_VERSION_1_1(load);
+	load_GL_VERSION_1_2(load);
+	load_GL_VERSION_1_3(load);
+	load_GL_VERSION_1_4(load);
+	load_GL_VERSION_1_5(load);
+	load_GL_VERSION_2_0(load);
+	load_GL_VERSION_2_1(load);
+	load_GL_VERSION_3_0(load);
+	load_GL_VERSION_3_1(load);
+	load_GL_VERSION_3_2(load);
+	load_GL_VERSION_3_3(load);
+	load_GL_VERSION_4_0(load);
+	load_GL_VERSION_4_1(load);
+	load_GL_VERSION_4_2(load);
+	load_GL_VERSION_4_3(load);
+	load_GL_VERSION_4_4(load);
+	load_GL_VERSION_4_5(load);
+	load_GL_VERSION_4_6(load);
+
+	if (!find_extensionsGL()) return 0;
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	find_coreGL();
+	glad_lazy_install(load);
+
+	if (!find_extensionsGL()) return 0;
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
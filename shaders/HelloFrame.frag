@@ -0,0 +1,12 @@
+#version 330 core
+
+#include "common/Frame.glsl"
+
+out vec4 frag_colour;
+
+uniform vec4 u_color;
+
+void main() {
+    // pulses with the frame time, no per draw uniform to set
+    frag_colour = u_color * (sin(time) / 2.0 + 0.5);
+}
\ No newline at end of file
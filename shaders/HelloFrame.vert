@@ -0,0 +1,9 @@
+#version 330 core
+
+#include "common/Frame.glsl"
+
+layout (location = 0) in vec3 aPos;
+
+void main() {
+    gl_Position = projection * view * vec4(aPos, 1.0);
+}
\ No newline at end of file
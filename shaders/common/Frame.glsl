@@ -0,0 +1,11 @@
+#pragma once
+
+// Shared per-frame data, bound to the same buffer range for every program.
+// Matches shaders::FrameUniforms in UniformBuffers.hpp
+layout (std140) uniform Frame {
+    mat4 view;
+    mat4 projection;
+    vec4 camera_position;
+    float time;
+    float delta_time;
+};
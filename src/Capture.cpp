@@ -0,0 +1,1006 @@
+#include "Capture.hpp"
+#include "GladFunctions.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+
+/*
+ * File layout, integers in the byte order of the machine:
+ *
+ *   "GLCAP\0" 0x02 0x00     magic and format version
+ *   u8 major, u8 minor      context version
+ *   u32 count               entry point names, the ids calls refer to
+ *   count x (u16 length, bytes)
+ *
+ * then records until the end of the file:
+ *
+ *   'C' u16 id u32 size     a call, followed by size bytes: the arguments
+ *                           in order, then what the call wrote to
+ *                           generated name arrays and its return value
+ *   'F'                     end of a frame
+ *
+ * Scalar arguments are their bytes. Pointer arguments start with a Kind.
+ */
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr char MAGIC[8] = {'G', 'L', 'C', 'A', 'P', '\0', 2, 0};
+    constexpr unsigned char TAG_CALL = 'C';
+    constexpr unsigned char TAG_FRAME = 'F';
+
+    /**
+     * @brief How a pointer argument is stored
+     *
+     */
+    enum Kind : std::uint8_t {
+        KIND_NULL,
+        // u32 size and the bytes pointed to
+        KIND_BLOB,
+        // u64, an offset into a bound buffer
+        KIND_OFFSET,
+        // u32 size, the function writes up to that many bytes through it
+        KIND_OUTPUT,
+        // u32 size, the names are stored after the call
+        KIND_GENERATED,
+        // u32 count, then u32 length and the bytes of each string
+        KIND_STRINGS,
+        // nothing, the lengths of the previous KIND_STRINGS
+        KIND_LENGTHS,
+        // u32 length and the bytes of a null terminated string
+        KIND_STRING,
+        // u64, the handle returned by glFenceSync
+        KIND_SYNC,
+        // nothing, the size is not known
+        KIND_UNKNOWN,
+    };
+
+    /**
+     * @brief How to store one pointer argument of an entry point
+     *
+     */
+    struct Rule {
+        std::size_t pointer;
+        Kind kind;
+        // bytes for BLOB, GENERATED and OUTPUT, strings for STRINGS, from
+        // the arguments as integers. 0 for an OUTPUT of unknown size
+        std::size_t (*size)(const std::int64_t* args);
+        // the argument holding the lengths of STRINGS, -1 for none
+        int lengths = -1;
+    };
+
+    template <std::size_t Count, std::size_t Bytes>
+    std::size_t counted(const std::int64_t* args) {
+        return args[Count] > 0 ? std::size_t(args[Count]) * Bytes : 0;
+    }
+
+    template <std::size_t Bytes>
+    std::size_t fixed(const std::int64_t*) {
+        return Bytes;
+    }
+
+    // glClearBuffer*v take 4 values for colour and 1 for depth or stencil
+    std::size_t clear_value(const std::int64_t* args) {
+        return args[0] == GL_COLOR ? 16 : 4;
+    }
+
+    /**
+     * @brief Values glGet{Boolean,Integer,Integer64,Float,Double}v write for
+     * a parameter, 0 for the lists whose length is another query
+     *
+     */
+    std::size_t state_values(std::int64_t pname) {
+        switch (pname) {
+            case GL_VIEWPORT:
+            case GL_SCISSOR_BOX:
+            case GL_COLOR_CLEAR_VALUE:
+            case GL_COLOR_WRITEMASK:
+            case GL_BLEND_COLOR:
+                return 4;
+            case GL_DEPTH_RANGE:
+            case GL_MAX_VIEWPORT_DIMS:
+            case GL_ALIASED_LINE_WIDTH_RANGE:
+            case GL_SMOOTH_LINE_WIDTH_RANGE:
+            case GL_POINT_SIZE_RANGE:
+            case GL_VIEWPORT_BOUNDS_RANGE:
+                return 2;
+            case GL_COMPRESSED_TEXTURE_FORMATS:
+            case GL_PROGRAM_BINARY_FORMATS:
+            case GL_SHADER_BINARY_FORMATS:
+                return 0;
+        }
+        return 1;
+    }
+
+    template <std::size_t Bytes>
+    std::size_t state_value(const std::int64_t* args) {
+        return state_values(args[0]) * Bytes;
+    }
+
+    std::size_t pixel_bytes(std::int64_t format, std::int64_t type) {
+        std::size_t components = 0;
+        switch (format) {
+            case GL_RED: case GL_GREEN: case GL_BLUE: case GL_RED_INTEGER:
+            case GL_GREEN_INTEGER: case GL_BLUE_INTEGER:
+            case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+                components = 1;
+                break;
+            case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL:
+                components = 2;
+                break;
+            case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+                components = 3;
+                break;
+            case GL_RGBA: case GL_BGRA: case GL_RGBA_INTEGER: case GL_BGRA_INTEGER:
+                components = 4;
+                break;
+        }
+        switch (type) {
+            case GL_UNSIGNED_BYTE: case GL_BYTE:
+                return components;
+            case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+                return components * 2;
+            case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+                return components * 4;
+            // packed, one value per pixel
+            case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+                return 1;
+            case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+            case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+            case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+                return 2;
+            case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV:
+            case GL_UNSIGNED_INT_10_10_10_2: case GL_UNSIGNED_INT_2_10_10_10_REV:
+            case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV:
+            case GL_UNSIGNED_INT_5_9_9_9_REV:
+                return 4;
+            case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+                return 8;
+        }
+        return 0;
+    }
+
+    /**
+     * @brief glReadPixels, rows padded to 8 bytes, the largest
+     * GL_PACK_ALIGNMENT. A GL_PACK_ROW_LENGTH wider than the image is not
+     * seen and its reads are not sized right
+     *
+     */
+    std::size_t read_pixels(const std::int64_t* args) {
+        if (args[2] <= 0 || args[3] <= 0) {
+            return 0;
+        }
+        std::size_t row = std::size_t(args[2]) * pixel_bytes(args[4], args[5]);
+        return (row + 7) / 8 * 8 * std::size_t(args[3]);
+    }
+
+    // names for which the element size follows from the suffix
+    std::size_t component_bytes(std::string_view type) {
+        if (type == "d") {
+            return 8;
+        }
+        return type == "f" || type == "i" || type == "ui" ? 4 : 0;
+    }
+
+    template <std::size_t Count>
+    std::size_t (*counted_by(std::size_t bytes))(const std::int64_t*) {
+        switch (bytes) {
+            case 4: return counted<Count, 4>;
+            case 8: return counted<Count, 8>;
+            case 12: return counted<Count, 12>;
+            case 16: return counted<Count, 16>;
+            case 24: return counted<Count, 24>;
+            case 32: return counted<Count, 32>;
+            case 36: return counted<Count, 36>;
+            case 48: return counted<Count, 48>;
+            case 64: return counted<Count, 64>;
+            case 72: return counted<Count, 72>;
+            case 96: return counted<Count, 96>;
+            case 128: return counted<Count, 128>;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief glUniform*v, glUniformMatrix*v and their glProgramUniform forms
+     *
+     */
+    bool uniform_rule(std::string_view name, std::vector<Rule>& rules) {
+        std::size_t shift = 0;
+        if (name.substr(0, 16) == "glProgramUniform") {
+            name.remove_prefix(16);
+            shift = 1;
+        } else if (name.substr(0, 9) == "glUniform") {
+            name.remove_prefix(9);
+        } else {
+            return false;
+        }
+        if (name.empty() || name.back() != 'v') {
+            return false;
+        }
+        name.remove_suffix(1);
+
+        std::size_t components = 0;
+        bool matrix = false;
+        if (name.substr(0, 6) == "Matrix") {
+            name.remove_prefix(6);
+            matrix = true;
+            if (name.size() >= 3 && name[1] == 'x') {
+                components = (name[0] - '0') * (name[2] - '0');
+                name.remove_prefix(3);
+            } else if (!name.empty()) {
+                components = (name[0] - '0') * (name[0] - '0');
+                name.remove_prefix(1);
+            }
+        } else if (!name.empty() && name[0] >= '1' && name[0] <= '4') {
+            components = name[0] - '0';
+            name.remove_prefix(1);
+        }
+
+        std::size_t bytes = components * component_bytes(name);
+        auto size = shift == 0 ? counted_by<1>(bytes) : counted_by<2>(bytes);
+        if (size == nullptr) {
+            return false;
+        }
+        // matrices take a transpose flag before the values
+        rules.push_back({2 + shift + (matrix ? 1 : 0), KIND_BLOB, size});
+        return true;
+    }
+
+    /**
+     * @brief The pointer arguments of an entry point that are stored in
+     * some other way than the default for their type
+     *
+     */
+    std::vector<Rule> rules_for(std::string_view name) {
+        std::vector<Rule> rules;
+        if (uniform_rule(name, rules)) {
+            return rules;
+        }
+
+        // n names in, n names out
+        constexpr std::string_view named[] = {
+            "Buffers", "VertexArrays", "Textures", "Framebuffers", "Renderbuffers",
+            "Queries", "Samplers", "TransformFeedbacks", "ProgramPipelines",
+        };
+        for (std::string_view objects : named) {
+            if (name.substr(2) == std::string("Delete") + std::string(objects)) {
+                rules.push_back({1, KIND_BLOB, counted<0, 4>});
+            } else if (name.substr(2) == std::string("Gen") + std::string(objects)) {
+                rules.push_back({1, KIND_GENERATED, counted<0, 4>});
+            } else if (name.substr(2) == std::string("Create") + std::string(objects)) {
+                // the 4.5 forms of these two take a target first
+                if (objects == "Textures" || objects == "Queries") {
+                    rules.push_back({2, KIND_GENERATED, counted<1, 4>});
+                } else {
+                    rules.push_back({1, KIND_GENERATED, counted<0, 4>});
+                }
+            }
+        }
+        if (!rules.empty()) {
+            return rules;
+        }
+
+        struct Entry {
+            std::string_view name;
+            Rule rule;
+        };
+        static const Entry entries[] = {
+            {"glBufferData", {2, KIND_BLOB, counted<1, 1>}},
+            {"glBufferSubData", {3, KIND_BLOB, counted<2, 1>}},
+            {"glBufferStorage", {2, KIND_BLOB, counted<1, 1>}},
+            {"glNamedBufferData", {2, KIND_BLOB, counted<1, 1>}},
+            {"glNamedBufferSubData", {3, KIND_BLOB, counted<2, 1>}},
+            {"glNamedBufferStorage", {2, KIND_BLOB, counted<1, 1>}},
+            {"glProgramBinary", {2, KIND_BLOB, counted<3, 1>}},
+            {"glDrawBuffers", {1, KIND_BLOB, counted<0, 4>}},
+            {"glInvalidateFramebuffer", {2, KIND_BLOB, counted<1, 4>}},
+            {"glVertexAttrib1fv", {1, KIND_BLOB, fixed<4>}},
+            {"glVertexAttrib2fv", {1, KIND_BLOB, fixed<8>}},
+            {"glVertexAttrib3fv", {1, KIND_BLOB, fixed<12>}},
+            {"glVertexAttrib4fv", {1, KIND_BLOB, fixed<16>}},
+            {"glClearBufferfv", {2, KIND_BLOB, clear_value}},
+            {"glClearBufferiv", {2, KIND_BLOB, clear_value}},
+            {"glClearBufferuiv", {2, KIND_BLOB, fixed<16>}},
+            {"glShaderSource", {2, KIND_STRINGS, counted<1, 1>, 3}},
+            {"glShaderSource", {3, KIND_LENGTHS, nullptr}},
+            {"glTransformFeedbackVaryings", {2, KIND_STRINGS, counted<1, 1>}},
+            {"glCreateShaderProgramv", {2, KIND_STRINGS, counted<1, 1>}},
+            {"glVertexAttribPointer", {5, KIND_OFFSET, nullptr}},
+            {"glVertexAttribIPointer", {4, KIND_OFFSET, nullptr}},
+            {"glVertexAttribLPointer", {4, KIND_OFFSET, nullptr}},
+            {"glDrawElements", {3, KIND_OFFSET, nullptr}},
+            {"glDrawElementsInstanced", {3, KIND_OFFSET, nullptr}},
+            {"glDrawElementsBaseVertex", {3, KIND_OFFSET, nullptr}},
+            {"glDrawElementsInstancedBaseVertex", {3, KIND_OFFSET, nullptr}},
+            {"glDrawElementsInstancedBaseInstance", {3, KIND_OFFSET, nullptr}},
+            {"glDrawElementsInstancedBaseVertexBaseInstance", {3, KIND_OFFSET, nullptr}},
+            {"glDrawRangeElements", {5, KIND_OFFSET, nullptr}},
+            {"glDrawRangeElementsBaseVertex", {5, KIND_OFFSET, nullptr}},
+            {"glDrawArraysIndirect", {1, KIND_OFFSET, nullptr}},
+            {"glDrawElementsIndirect", {2, KIND_OFFSET, nullptr}},
+            {"glMultiDrawArraysIndirect", {1, KIND_OFFSET, nullptr}},
+            {"glMultiDrawElementsIndirect", {2, KIND_OFFSET, nullptr}},
+            // outputs, by the size the call writes at most
+            {"glGetBooleanv", {1, KIND_OUTPUT, state_value<1>}},
+            {"glGetIntegerv", {1, KIND_OUTPUT, state_value<4>}},
+            {"glGetFloatv", {1, KIND_OUTPUT, state_value<4>}},
+            {"glGetInteger64v", {1, KIND_OUTPUT, state_value<8>}},
+            {"glGetDoublev", {1, KIND_OUTPUT, state_value<8>}},
+            {"glReadPixels", {6, KIND_OUTPUT, read_pixels}},
+            {"glReadnPixels", {7, KIND_OUTPUT, counted<6, 1>}},
+            {"glGetBufferSubData", {3, KIND_OUTPUT, counted<2, 1>}},
+            {"glGetNamedBufferSubData", {3, KIND_OUTPUT, counted<2, 1>}},
+            {"glGetShaderInfoLog", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetShaderInfoLog", {3, KIND_OUTPUT, counted<1, 1>}},
+            {"glGetProgramInfoLog", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetProgramInfoLog", {3, KIND_OUTPUT, counted<1, 1>}},
+            {"glGetProgramPipelineInfoLog", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetProgramPipelineInfoLog", {3, KIND_OUTPUT, counted<1, 1>}},
+            {"glGetShaderSource", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetShaderSource", {3, KIND_OUTPUT, counted<1, 1>}},
+            {"glGetProgramBinary", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetProgramBinary", {3, KIND_OUTPUT, fixed<4>}},
+            {"glGetProgramBinary", {4, KIND_OUTPUT, counted<1, 1>}},
+            // GL_COMPUTE_WORK_GROUP_SIZE is the only one with 3 values
+            {"glGetProgramiv", {2, KIND_OUTPUT, fixed<12>}},
+            {"glGetShaderiv", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetProgramPipelineiv", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetQueryiv", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetQueryObjectiv", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetQueryObjectuiv", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetQueryObjecti64v", {2, KIND_OUTPUT, fixed<8>}},
+            {"glGetQueryObjectui64v", {2, KIND_OUTPUT, fixed<8>}},
+            {"glGetBufferParameteriv", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetBufferParameteri64v", {2, KIND_OUTPUT, fixed<8>}},
+            {"glGetRenderbufferParameteriv", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetFramebufferAttachmentParameteriv", {3, KIND_OUTPUT, fixed<4>}},
+            {"glGetTexLevelParameteriv", {3, KIND_OUTPUT, fixed<4>}},
+            {"glGetTexLevelParameterfv", {3, KIND_OUTPUT, fixed<4>}},
+            // border colour and swizzle have 4 values
+            {"glGetTexParameteriv", {2, KIND_OUTPUT, fixed<16>}},
+            {"glGetTexParameterfv", {2, KIND_OUTPUT, fixed<16>}},
+            // a dmat4 is the largest uniform
+            {"glGetUniformfv", {2, KIND_OUTPUT, fixed<128>}},
+            {"glGetUniformiv", {2, KIND_OUTPUT, fixed<128>}},
+            {"glGetUniformuiv", {2, KIND_OUTPUT, fixed<128>}},
+            {"glGetUniformdv", {2, KIND_OUTPUT, fixed<128>}},
+            {"glGetActiveUniform", {3, KIND_OUTPUT, fixed<4>}},
+            {"glGetActiveUniform", {4, KIND_OUTPUT, fixed<4>}},
+            {"glGetActiveUniform", {5, KIND_OUTPUT, fixed<4>}},
+            {"glGetActiveUniform", {6, KIND_OUTPUT, counted<2, 1>}},
+            {"glGetActiveAttrib", {3, KIND_OUTPUT, fixed<4>}},
+            {"glGetActiveAttrib", {4, KIND_OUTPUT, fixed<4>}},
+            {"glGetActiveAttrib", {5, KIND_OUTPUT, fixed<4>}},
+            {"glGetActiveAttrib", {6, KIND_OUTPUT, counted<2, 1>}},
+            {"glGetActiveUniformBlockName", {3, KIND_OUTPUT, fixed<4>}},
+            {"glGetActiveUniformBlockName", {4, KIND_OUTPUT, counted<2, 1>}},
+            {"glGetActiveUniformsiv", {4, KIND_OUTPUT, counted<1, 4>}},
+            {"glGetUniformIndices", {3, KIND_OUTPUT, counted<1, 4>}},
+            {"glGetAttachedShaders", {2, KIND_OUTPUT, fixed<4>}},
+            {"glGetAttachedShaders", {3, KIND_OUTPUT, counted<1, 4>}},
+            {"glGetSynciv", {3, KIND_OUTPUT, fixed<4>}},
+            {"glGetSynciv", {4, KIND_OUTPUT, counted<2, 4>}},
+        };
+        for (const Entry& entry : entries) {
+            if (entry.name == name) {
+                rules.push_back(entry.rule);
+            }
+        }
+        return rules;
+    }
+
+    // built once, shared by every thread that captures
+    const std::vector<std::vector<Rule>>& function_rules() {
+        static const std::vector<std::vector<Rule>> rules = [] {
+            std::vector<std::vector<Rule>> out(gl::FUNCTION_COUNT);
+            for (std::size_t i = 0; i < gl::FUNCTION_COUNT; i++) {
+                out[i] = rules_for(gl::function_name(gl::Function(i)));
+            }
+            return out;
+        }();
+        return rules;
+    }
+
+    const Rule* find_rule(std::size_t function, std::size_t pointer) {
+        for (const Rule& rule : function_rules()[function]) {
+            if (rule.pointer == pointer) {
+                return &rule;
+            }
+        }
+        return nullptr;
+    }
+
+    // recording
+
+    // per thread, like the glad table the wrappers are installed in
+    thread_local std::ofstream file;
+    thread_local std::vector<unsigned char> buffer;
+    thread_local gl::CaptureStats stats;
+    thread_local bool installed = false;
+
+    void put(const void* data, std::size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    template <typename T>
+    void put(T value) {
+        put(&value, sizeof(T));
+    }
+
+    void flush() {
+        file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+        stats.bytes += buffer.size();
+        buffer.clear();
+    }
+
+    template <typename T>
+    std::int64_t as_integer(T arg) {
+        if constexpr (std::is_pointer_v<T>) {
+            return std::int64_t(reinterpret_cast<std::uintptr_t>(arg));
+        } else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+            return std::int64_t(arg);
+        } else {
+            return 0;
+        }
+    }
+
+    template <typename T>
+    void put_pointer(std::size_t function, std::size_t index, T arg, const std::int64_t* args) {
+        using Pointee = std::remove_pointer_t<T>;
+        const Rule* rule = find_rule(function, index);
+
+        if constexpr (std::is_function_v<Pointee>) {
+            // callbacks
+            put(arg == nullptr ? KIND_NULL : KIND_UNKNOWN);
+            stats.unknown += arg == nullptr ? 0 : 1;
+        } else if (rule != nullptr && rule->kind == KIND_OFFSET) {
+            put(KIND_OFFSET);
+            put(std::uint64_t(reinterpret_cast<std::uintptr_t>(arg)));
+        } else if (arg == nullptr) {
+            put(KIND_NULL);
+        } else if (rule != nullptr && rule->kind == KIND_BLOB) {
+            std::uint32_t size = rule->size(args);
+            put(KIND_BLOB);
+            put(size);
+            put(reinterpret_cast<const void*>(arg), size);
+        } else if (rule != nullptr && rule->kind == KIND_GENERATED) {
+            put(KIND_GENERATED);
+            put(std::uint32_t(rule->size(args)));
+        } else if (rule != nullptr && rule->kind == KIND_STRINGS) {
+            auto strings = reinterpret_cast<const GLchar* const*>(arg);
+            auto lengths = rule->lengths < 0 ? nullptr
+                : reinterpret_cast<const GLint*>(args[rule->lengths]);
+            std::uint32_t count = rule->size(args);
+            put(KIND_STRINGS);
+            put(count);
+            for (std::uint32_t i = 0; i < count; i++) {
+                std::uint32_t length = lengths != nullptr && lengths[i] >= 0
+                    ? lengths[i]
+                    : std::strlen(strings[i]);
+                put(length);
+                put(strings[i], length);
+            }
+        } else if (rule != nullptr && rule->kind == KIND_LENGTHS) {
+            put(KIND_LENGTHS);
+        } else if constexpr (std::is_same_v<T, const GLchar*>) {
+            std::uint32_t length = std::strlen(arg);
+            put(KIND_STRING);
+            put(length);
+            put(arg, length);
+        } else if (rule != nullptr && rule->kind == KIND_OUTPUT && rule->size(args) > 0) {
+            put(KIND_OUTPUT);
+            put(std::uint32_t(rule->size(args)));
+        } else {
+            put(KIND_UNKNOWN);
+            stats.unknown++;
+        }
+    }
+
+    template <typename T>
+    void put_arg(std::size_t function, std::size_t index, T arg, const std::int64_t* args) {
+        if constexpr (std::is_same_v<T, GLsync>) {
+            put(KIND_SYNC);
+            put(std::uint64_t(reinterpret_cast<std::uintptr_t>(arg)));
+        } else if constexpr (std::is_pointer_v<T>) {
+            put_pointer(function, index, arg, args);
+        } else {
+            put(arg);
+        }
+    }
+
+    template <typename T>
+    void put_generated(std::size_t function, std::size_t index, T arg, const std::int64_t* args) {
+        if constexpr (std::is_pointer_v<T> && !std::is_same_v<T, GLsync>) {
+            const Rule* rule = find_rule(function, index);
+            if (rule != nullptr && rule->kind == KIND_GENERATED && arg != nullptr) {
+                put(reinterpret_cast<const void*>(arg), rule->size(args));
+            }
+        }
+    }
+
+    template <typename R>
+    void put_result(R result) {
+        if constexpr (std::is_pointer_v<R>) {
+            put(std::uint64_t(reinterpret_cast<std::uintptr_t>(result)));
+        } else {
+            put(result);
+        }
+    }
+
+    std::size_t begin_call(std::size_t function) {
+        put(TAG_CALL);
+        put(std::uint16_t(function));
+        std::size_t size_at = buffer.size();
+        put(std::uint32_t(0));
+        return size_at;
+    }
+
+    void end_call(std::size_t size_at) {
+        std::uint32_t size = buffer.size() - size_at - sizeof(std::uint32_t);
+        std::memcpy(buffer.data() + size_at, &size, sizeof(size));
+        stats.calls++;
+    }
+
+    /**
+     * @brief The recording wrapper of one entry point
+     *
+     */
+    template <std::size_t Id, typename Proc>
+    struct Recorded;
+
+    template <std::size_t Id, typename R, typename... Args>
+    struct Recorded<Id, R (APIENTRYP)(Args...)> {
+        static inline thread_local R (APIENTRYP next)(Args...) = nullptr;
+
+        static R APIENTRY call(Args... args) {
+            const std::int64_t integers[sizeof...(Args) + 1] = {as_integer(args)...};
+            std::size_t size_at = begin_call(Id);
+            std::size_t index = 0;
+            (put_arg(Id, index++, args, integers), ...);
+
+            if constexpr (std::is_void_v<R>) {
+                next(args...);
+                index = 0;
+                (put_generated(Id, index++, args, integers), ...);
+                end_call(size_at);
+            } else {
+                R result = next(args...);
+                index = 0;
+                (put_generated(Id, index++, args, integers), ...);
+                put_result(result);
+                end_call(size_at);
+                return result;
+            }
+        }
+    };
+
+    // replaying
+
+    /**
+     * @brief Reads one call's bytes
+     *
+     */
+    struct Reader {
+        const unsigned char* data;
+        std::size_t size;
+        std::size_t pos = 0;
+        bool ok = true;
+
+        const unsigned char* bytes(std::size_t n) {
+            if (!ok || size - pos < n) {
+                ok = false;
+                return nullptr;
+            }
+            const unsigned char* at = data + pos;
+            pos += n;
+            return at;
+        }
+
+        template <typename T>
+        T get() {
+            T value{};
+            if (const unsigned char* at = bytes(sizeof(T))) {
+                std::memcpy(&value, at, sizeof(T));
+            }
+            return value;
+        }
+    };
+
+    /**
+     * @brief What the arguments of the call being replayed point to
+     *
+     */
+    struct Replay {
+        gl::ReplayStats stats;
+        std::unordered_map<std::uint64_t, GLsync> syncs;
+        // 8 byte aligned copies of the data pointed to
+        std::vector<std::vector<std::uint64_t>> storage;
+        std::vector<const GLchar*> strings;
+        std::vector<GLint> lengths;
+        // where the names of KIND_GENERATED arguments were written
+        std::vector<std::pair<void*, std::size_t>> generated;
+        // an output argument of unknown size, the call is not made
+        bool unsafe = false;
+        std::vector<gl::TracedCall> functions;
+
+        void* store(const unsigned char* data, std::size_t size, bool terminate = false) {
+            std::vector<std::uint64_t>& block =
+                storage.emplace_back(size / sizeof(std::uint64_t) + 1, 0);
+            if (data != nullptr && size > 0) {
+                std::memcpy(block.data(), data, size);
+            }
+            if (terminate) {
+                reinterpret_cast<char*>(block.data())[size] = '\0';
+            }
+            return block.data();
+        }
+    };
+
+    template <typename T>
+    T get_pointer(Reader& in, Replay& r) {
+        Kind kind = Kind(in.get<std::uint8_t>());
+        if constexpr (std::is_function_v<std::remove_pointer_t<T>>) {
+            // callbacks are not captured
+            if (kind == KIND_UNKNOWN) {
+                r.stats.approximated++;
+            }
+            return nullptr;
+        } else {
+            switch (kind) {
+                case KIND_BLOB: {
+                    std::uint32_t size = in.get<std::uint32_t>();
+                    const unsigned char* data = in.bytes(size);
+                    return data ? reinterpret_cast<T>(r.store(data, size)) : nullptr;
+                }
+                case KIND_OFFSET:
+                    return reinterpret_cast<T>(std::uintptr_t(in.get<std::uint64_t>()));
+                case KIND_OUTPUT:
+                    return reinterpret_cast<T>(r.store(nullptr, in.get<std::uint32_t>()));
+                case KIND_GENERATED: {
+                    std::uint32_t size = in.get<std::uint32_t>();
+                    void* names = r.store(nullptr, size);
+                    r.generated.emplace_back(names, size);
+                    return reinterpret_cast<T>(names);
+                }
+                case KIND_STRINGS: {
+                    std::uint32_t count = in.get<std::uint32_t>();
+                    r.strings.clear();
+                    r.lengths.clear();
+                    for (std::uint32_t i = 0; i < count && in.ok; i++) {
+                        std::uint32_t length = in.get<std::uint32_t>();
+                        const unsigned char* data = in.bytes(length);
+                        if (data != nullptr) {
+                            r.strings.push_back(
+                                static_cast<const GLchar*>(r.store(data, length, true))
+                            );
+                            r.lengths.push_back(length);
+                        }
+                    }
+                    return reinterpret_cast<T>(static_cast<void*>(r.strings.data()));
+                }
+                case KIND_LENGTHS:
+                    return reinterpret_cast<T>(static_cast<void*>(r.lengths.data()));
+                case KIND_STRING: {
+                    std::uint32_t length = in.get<std::uint32_t>();
+                    const unsigned char* data = in.bytes(length);
+                    return data ? reinterpret_cast<T>(r.store(data, length, true)) : nullptr;
+                }
+                case KIND_UNKNOWN:
+                    // null for what the call reads, but not for what it writes
+                    if constexpr (std::is_const_v<std::remove_pointer_t<T>>) {
+                        r.stats.approximated++;
+                    } else {
+                        r.unsafe = true;
+                    }
+                    return nullptr;
+                case KIND_NULL:
+                    return nullptr;
+                default:
+                    in.ok = false;
+                    return nullptr;
+            }
+        }
+    }
+
+    template <typename T>
+    T get_arg(Reader& in, Replay& r) {
+        if constexpr (std::is_same_v<T, GLsync>) {
+            in.get<std::uint8_t>();
+            auto it = r.syncs.find(in.get<std::uint64_t>());
+            return it != r.syncs.end() ? it->second : nullptr;
+        } else if constexpr (std::is_pointer_v<T>) {
+            return get_pointer<T>(in, r);
+        } else {
+            return in.get<T>();
+        }
+    }
+
+    /**
+     * @brief Replays calls to one entry point through its glad pointer
+     *
+     */
+    template <typename Proc>
+    struct Replayed;
+
+    template <typename R, typename... Args>
+    struct Replayed<R (APIENTRYP)(Args...)> {
+        static void call(void* slot, gl::Function function, Reader& in, Replay& r) {
+            auto proc = *static_cast<R (APIENTRYP*)(Args...)>(slot);
+            if (proc == nullptr) {
+                r.stats.skipped++;
+                return;
+            }
+
+            r.storage.clear();
+            r.generated.clear();
+            r.unsafe = false;
+            // braced initialisation reads the arguments in order
+            std::tuple<Args...> args{get_arg<Args>(in, r)...};
+            if (!in.ok) {
+                return;
+            }
+            if (r.unsafe) {
+                r.stats.skipped++;
+                return;
+            }
+
+            std::chrono::nanoseconds elapsed;
+            if constexpr (std::is_void_v<R>) {
+                auto start = Clock::now();
+                std::apply(proc, args);
+                elapsed = Clock::now() - start;
+            } else {
+                auto start = Clock::now();
+                R result = std::apply(proc, args);
+                elapsed = Clock::now() - start;
+
+                check_generated(in, r);
+                if constexpr (std::is_pointer_v<R>) {
+                    // mapped memory and strings differ anyway, syncs are
+                    // looked up by the handle they had at capture
+                    std::uint64_t captured = in.get<std::uint64_t>();
+                    if constexpr (std::is_same_v<R, GLsync>) {
+                        r.syncs[captured] = result;
+                    }
+                } else {
+                    R captured = in.get<R>();
+                    if (in.ok && !(captured == result)) {
+                        r.stats.diverged++;
+                    }
+                }
+            }
+            if constexpr (std::is_void_v<R>) {
+                check_generated(in, r);
+            }
+
+            gl::TracedCall& stats = r.functions[function];
+            stats.calls++;
+            stats.time += elapsed;
+            stats.longest = std::max(stats.longest, elapsed);
+            r.stats.calls++;
+            r.stats.frames.back() += elapsed;
+        }
+
+        static void check_generated(Reader& in, Replay& r) {
+            for (auto [names, size] : r.generated) {
+                const unsigned char* captured = in.bytes(size);
+                if (captured != nullptr && std::memcmp(captured, names, size) != 0) {
+                    r.stats.diverged++;
+                }
+            }
+        }
+    };
+
+    struct ReplayEntry {
+        void (*call)(void* slot, gl::Function function, Reader& in, Replay& r);
+        void* slot;
+    };
+
+    // slots are in the glad table of the thread, taken on its first replay
+    thread_local const ReplayEntry REPLAY[] = {
+#define GLAD_FUNCTION(name) \
+        {&Replayed<decltype(glad_##name)>::call, reinterpret_cast<void*>(&glad_##name)},
+#include "glad_functions.inc"
+#undef GLAD_FUNCTION
+    };
+
+    /**
+     * @brief Read the header, and map the ids in the file to entry points
+     *
+     */
+    bool read_header(
+        std::istream& in, gl::CaptureInfo& info, std::vector<std::optional<gl::Function>>* ids
+    ) {
+        char magic[sizeof(MAGIC)];
+        std::uint8_t version[2];
+        std::uint32_t count = 0;
+        in.read(magic, sizeof(magic));
+        in.read(reinterpret_cast<char*>(version), sizeof(version));
+        in.read(reinterpret_cast<char*>(&count), sizeof(count));
+        if (!in || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+            return false;
+        }
+        info.major = version[0];
+        info.minor = version[1];
+        info.functions = count;
+
+        std::string name;
+        for (std::uint32_t i = 0; i < count; i++) {
+            std::uint16_t length = 0;
+            in.read(reinterpret_cast<char*>(&length), sizeof(length));
+            name.resize(length);
+            in.read(name.data(), length);
+            if (!in) {
+                return false;
+            }
+            if (ids != nullptr) {
+                ids->push_back(gl::find_function(name));
+            }
+        }
+        return true;
+    }
+} // namespace
+
+bool gl::start_capture(const std::filesystem::path& path) {
+    if (installed) {
+        return true;
+    }
+
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "ERROR::CAPTURE::UNABLE_TO_WRITE " << path << std::endl;
+        return false;
+    }
+
+    stats = {};
+    buffer.clear();
+    put(MAGIC, sizeof(MAGIC));
+    put(std::uint8_t(GLVersion.major));
+    put(std::uint8_t(GLVersion.minor));
+    put(std::uint32_t(FUNCTION_COUNT));
+    for (std::size_t i = 0; i < FUNCTION_COUNT; i++) {
+        std::string_view name = function_name(Function(i));
+        put(std::uint16_t(name.size()));
+        put(name.data(), name.size());
+    }
+    flush();
+
+#define GLAD_FUNCTION(name)                                                   \
+    if (glad_##name != NULL) {                                                \
+        using T = Recorded<FN_##name, decltype(glad_##name)>;                 \
+        T::next = glad_##name;                                                \
+        glad_##name = T::call;                                                \
+    }
+#include "glad_functions.inc"
+#undef GLAD_FUNCTION
+
+    installed = true;
+    return true;
+}
+
+void gl::end_capture_frame() {
+    if (!installed) {
+        return;
+    }
+    put(TAG_FRAME);
+    stats.frames++;
+    flush();
+}
+
+void gl::stop_capture() {
+    if (!installed) {
+        return;
+    }
+
+#define GLAD_FUNCTION(name)                                                   \
+    {                                                                         \
+        using T = Recorded<FN_##name, decltype(glad_##name)>;                 \
+        if (glad_##name == T::call) {                                         \
+            glad_##name = T::next;                                            \
+        }                                                                     \
+    }
+#include "glad_functions.inc"
+#undef GLAD_FUNCTION
+
+    flush();
+    file.close();
+    installed = false;
+}
+
+bool gl::capturing() {
+    return installed;
+}
+
+const gl::CaptureStats& gl::capture_stats() {
+    return stats;
+}
+
+std::optional<gl::CaptureInfo> gl::read_capture_info(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    CaptureInfo info;
+    if (!in.is_open() || !read_header(in, info, nullptr)) {
+        return std::nullopt;
+    }
+    return info;
+}
+
+std::optional<gl::ReplayStats> gl::replay_capture(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        std::cerr << "ERROR::REPLAY::UNABLE_TO_READ " << path << std::endl;
+        return std::nullopt;
+    }
+
+    CaptureInfo info;
+    std::vector<std::optional<Function>> ids;
+    if (!read_header(in, info, &ids)) {
+        std::cerr << "ERROR::REPLAY::NOT_A_CAPTURE " << path << std::endl;
+        return std::nullopt;
+    }
+
+    Replay r;
+    r.functions.resize(FUNCTION_COUNT);
+    r.stats.frames.emplace_back(0);
+
+    std::vector<unsigned char> payload;
+    std::uint64_t frame_start = 0;
+    char tag;
+    while (in.get(tag)) {
+        if (tag == char(TAG_FRAME)) {
+            if (glad_glFinish != NULL) {
+                glFinish();
+            }
+            r.stats.frames.emplace_back(0);
+            frame_start = r.stats.calls;
+            continue;
+        }
+
+        std::uint16_t id = 0;
+        std::uint32_t size = 0;
+        in.read(reinterpret_cast<char*>(&id), sizeof(id));
+        in.read(reinterpret_cast<char*>(&size), sizeof(size));
+        payload.resize(size);
+        in.read(reinterpret_cast<char*>(payload.data()), size);
+        if (tag != char(TAG_CALL) || !in) {
+            std::cerr << "ERROR::REPLAY::TRUNCATED " << path << std::endl;
+            break;
+        }
+
+        if (id >= ids.size() || !ids[id]) {
+            r.stats.skipped++;
+            continue;
+        }
+        const ReplayEntry& entry = REPLAY[*ids[id]];
+        Reader reader{payload.data(), payload.size()};
+        entry.call(entry.slot, *ids[id], reader, r);
+        if (!reader.ok) {
+            std::cerr << "ERROR::REPLAY::BAD_CALL " << function_name(*ids[id]) << std::endl;
+        }
+    }
+
+    // the end of the last frame opened one with nothing in it
+    if (r.stats.frames.size() > 1 && r.stats.calls == frame_start) {
+        r.stats.frames.pop_back();
+    }
+
+    for (std::size_t i = 0; i < FUNCTION_COUNT; i++) {
+        if (r.functions[i].calls > 0) {
+            r.functions[i].name = function_name(Function(i));
+            r.stats.functions.push_back(r.functions[i]);
+        }
+    }
+    std::sort(
+        r.stats.functions.begin(), r.stats.functions.end(),
+        [](const TracedCall& a, const TracedCall& b) { return a.time > b.time; }
+    );
+    return std::move(r.stats);
+}
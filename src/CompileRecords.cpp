@@ -0,0 +1,161 @@
+#include "CompileRecords.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace {
+    // hot reload adds a record per edit, the oldest are dropped past this
+    constexpr std::size_t MAX_RECORDS = 1024;
+
+    std::deque<shaders::ProgramRecord> records;
+    // index of records.front(), indices stay valid as records are dropped
+    std::size_t first_record = 0;
+    // what writes to a dropped record go to
+    shaders::ProgramRecord dropped;
+
+    template <typename GetLength, typename GetLog>
+    std::string read_log(GLuint obj, GetLength get_length, GetLog get_log) {
+        GLint length = 0;
+        get_length(obj, GL_INFO_LOG_LENGTH, &length);
+        if (length <= 1) {
+            return "";
+        }
+
+        // the length counts the terminating null
+        std::string log(length, '\0');
+        GLsizei written = 0;
+        get_log(obj, length, &written, log.data());
+        log.resize(written);
+        return log;
+    }
+
+    std::string_view gl_string(GLenum name) {
+        const GLubyte* str = glGetString != NULL ? glGetString(name) : NULL;
+        return str ? reinterpret_cast<const char*>(str) : "";
+    }
+
+    void write_string(std::ostream& out, std::string_view str) {
+        out << '"';
+        for (char c : str) {
+            switch (c) {
+                case '"':  out << "\\\""; break;
+                case '\\': out << "\\\\"; break;
+                case '\n': out << "\\n"; break;
+                case '\r': out << "\\r"; break;
+                case '\t': out << "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char escaped[8];
+                        std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                        out << escaped;
+                    } else {
+                        out << c;
+                    }
+            }
+        }
+        out << '"';
+    }
+
+    double ms(std::chrono::nanoseconds ns) {
+        return std::chrono::duration<double, std::milli>(ns).count();
+    }
+
+    void write_stage(std::ostream& out, const shaders::StageRecord& stage) {
+        if (stage.type == GL_NONE) {
+            out << "null";
+            return;
+        }
+        out << "{\"compile_ms\": " << ms(stage.compile)
+            << ", \"compiled\": " << (stage.compiled ? "true" : "false")
+            << ", \"log\": ";
+        write_string(out, stage.log);
+        out << "}";
+    }
+} // namespace
+
+std::string shaders::shader_info_log(GLuint shader) {
+    return read_log(shader, glGetShaderiv, glGetShaderInfoLog);
+}
+
+std::string shaders::program_info_log(GLuint prgm) {
+    return read_log(prgm, glGetProgramiv, glGetProgramInfoLog);
+}
+
+std::string shaders::pipeline_info_log(GLuint pipeline) {
+    return read_log(pipeline, glGetProgramPipelineiv, glGetProgramPipelineInfoLog);
+}
+
+std::size_t shaders::add_compile_record(std::string label) {
+    if (records.size() == MAX_RECORDS) {
+        records.pop_front();
+        first_record++;
+    }
+    records.emplace_back().label = std::move(label);
+    return first_record + records.size() - 1;
+}
+
+shaders::ProgramRecord& shaders::compile_record(std::size_t index) {
+    if (index < first_record) {
+        dropped = {};
+        return dropped;
+    }
+    return records.at(index - first_record);
+}
+
+const std::deque<shaders::ProgramRecord>& shaders::compile_records() {
+    return records;
+}
+
+void shaders::write_compile_records(std::ostream& out) {
+    out << "{\n  \"driver\": {\"vendor\": ";
+    write_string(out, gl_string(GL_VENDOR));
+    out << ", \"renderer\": ";
+    write_string(out, gl_string(GL_RENDERER));
+    out << ", \"version\": ";
+    write_string(out, gl_string(GL_VERSION));
+    out << "},\n  \"programs\": [";
+
+    const char* separator = "\n";
+    for (const ProgramRecord& r : records) {
+        out << separator << "    {\"label\": ";
+        write_string(out, r.label);
+        out << ", \"program\": " << r.program
+            << ", \"read_ms\": " << ms(r.read)
+            << ", \"preprocess_ms\": " << ms(r.preprocess)
+            << ",\n     \"vertex\": ";
+        write_stage(out, r.vertex);
+        out << ",\n     \"fragment\": ";
+        write_stage(out, r.fragment);
+        out << ",\n     \"link_ms\": " << ms(r.link)
+            << ", \"linked\": " << (r.linked ? "true" : "false")
+            << ", \"cached\": " << (r.cached ? "true" : "false")
+            << ", \"link_log\": ";
+        write_string(out, r.link_log);
+        out << ",\n     \"first_use_ms\": ";
+        if (r.used) {
+            out << ms(r.first_use);
+        } else {
+            out << "null";
+        }
+        out << ", \"warm_up_ms\": ";
+        if (r.warmed) {
+            out << ms(r.warm_up);
+        } else {
+            out << "null";
+        }
+        out << "}";
+        separator = ",\n";
+    }
+    out << "\n  ]\n}\n";
+}
+
+bool shaders::export_compile_records(const std::filesystem::path& path) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "ERROR::COMPILE_RECORDS::UNABLE_TO_WRITE " << path << std::endl;
+        return false;
+    }
+    write_compile_records(file);
+    return bool(file);
+}
@@ -0,0 +1,32 @@
+#include "DispatchTable.hpp"
+#include "Extensions.hpp"
+
+gl::DispatchTable::DispatchTable() : table(gladCreateGLContext()) {}
+
+gl::DispatchTable::~DispatchTable() {
+    gladDestroyGLContext(table);
+}
+
+bool gl::DispatchTable::load(GLADloadproc load) {
+    bool loaded = gladLoadGLContext(table, load);
+    reload_extensions();
+    return loaded;
+}
+
+void gl::DispatchTable::capture() {
+    gladGetGLContextCurrent(table);
+}
+
+void gl::DispatchTable::make_current() const {
+    gladMakeGLContextCurrent(table);
+    reload_extensions();
+}
+
+void gl::DispatchTable::release() {
+    gladMakeGLContextCurrent(NULL);
+    reload_extensions();
+}
+
+GladGLContext* gl::DispatchTable::get() const {
+    return table;
+}
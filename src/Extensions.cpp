@@ -0,0 +1,119 @@
+#include "Extensions.hpp"
+#include "Hash.hpp"
+
+#include <optional>
+
+namespace {
+    // per thread like the glad table, each thread may have its own context
+    thread_local std::optional<gl::ExtensionSet> current;
+
+    std::vector<std::string_view> query_names() {
+        std::vector<std::string_view> names;
+        if (glGetStringi != NULL) {
+            GLint count = 0;
+            glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+            names.reserve(count);
+            for (GLint i = 0; i < count; i++) {
+                const GLubyte* ext = glGetStringi(GL_EXTENSIONS, i);
+                if (ext != NULL) {
+                    names.emplace_back(reinterpret_cast<const char*>(ext));
+                }
+            }
+            return names;
+        }
+
+        // before 3.0 the extensions are one space separated string
+        const GLubyte* all = glGetString != NULL ? glGetString(GL_EXTENSIONS) : NULL;
+        std::string_view list = all ? reinterpret_cast<const char*>(all) : "";
+        while (!list.empty()) {
+            std::size_t end = list.find(' ');
+            names.push_back(list.substr(0, end));
+            list.remove_prefix(end == std::string_view::npos ? list.size() : end + 1);
+        }
+        return names;
+    }
+} // namespace
+
+gl::ExtensionSet::ExtensionSet(const std::vector<std::string_view>& list) {
+    std::size_t bytes = 0;
+    for (std::string_view name : list) {
+        bytes += name.size() + 1;
+    }
+    names.reserve(bytes);
+
+    std::size_t capacity = 16;
+    while (capacity < 2 * list.size()) {
+        capacity *= 2;
+    }
+    slots.resize(capacity);
+
+    for (std::string_view name : list) {
+        if (name.empty()) {
+            continue;
+        }
+        std::uint32_t h = hash::fnv1a_32(name);
+        std::size_t i = h & (capacity - 1);
+        for (;; i = (i + 1) & (capacity - 1)) {
+            Slot& slot = slots[i];
+            if (slot.length == 0) {
+                slot.hash = h;
+                slot.offset = names.size();
+                slot.length = name.size();
+                names.append(name);
+                names.push_back('\0');
+                count++;
+                break;
+            }
+            if (slot.hash == h
+                && std::string_view(names).substr(slot.offset, slot.length) == name) {
+                break;
+            }
+        }
+    }
+}
+
+bool gl::ExtensionSet::contains(std::string_view name) const {
+    if (slots.empty() || name.empty()) {
+        return false;
+    }
+    std::uint32_t h = hash::fnv1a_32(name);
+    std::size_t mask = slots.size() - 1;
+    for (std::size_t i = h & mask;; i = (i + 1) & mask) {
+        const Slot& slot = slots[i];
+        if (slot.length == 0) {
+            return false;
+        }
+        if (slot.hash == h
+            && std::string_view(names).substr(slot.offset, slot.length) == name) {
+            return true;
+        }
+    }
+}
+
+std::size_t gl::ExtensionSet::size() const {
+    return count;
+}
+
+const gl::ExtensionSet& gl::extensions() {
+    if (!current) {
+        // nothing to cache before glad has loaded
+        if (glGetString == NULL) {
+            static const ExtensionSet none;
+            return none;
+        }
+        current.emplace(query_names());
+    }
+    return *current;
+}
+
+void gl::reload_extensions() {
+    if (glGetString == NULL) {
+        current.reset();
+        return;
+    }
+    current.emplace(query_names());
+}
+
+bool gl::has_extension(std::string_view name) {
+    return extensions().contains(name);
+}
@@ -0,0 +1,31 @@
+#include "GladFunctions.hpp"
+
+#include <unordered_map>
+
+namespace {
+    constexpr const char* NAMES[] = {
+#define GLAD_FUNCTION(name) #name,
+#include "glad_functions.inc"
+#undef GLAD_FUNCTION
+    };
+} // namespace
+
+const char* gl::function_name(Function function) {
+    return function < FUNCTION_COUNT ? NAMES[function] : "";
+}
+
+std::optional<gl::Function> gl::find_function(std::string_view name) {
+    static const std::unordered_map<std::string_view, Function> index = [] {
+        std::unordered_map<std::string_view, Function> map;
+        for (std::size_t i = 0; i < FUNCTION_COUNT; i++) {
+            map.emplace(NAMES[i], Function(i));
+        }
+        return map;
+    }();
+
+    auto it = index.find(name);
+    if (it == index.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
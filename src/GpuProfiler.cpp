@@ -0,0 +1,206 @@
+#include "GpuProfiler.hpp"
+#include "Extensions.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    // queries generated at once when the pool runs out
+    constexpr std::size_t POOL_GROWTH = 32;
+
+    double us(std::chrono::nanoseconds ns) {
+        return std::chrono::duration<double, std::micro>(ns).count();
+    }
+} // namespace
+
+gl::GpuProfiler::GpuProfiler(std::size_t latency, std::size_t window)
+    : latency(latency), window(std::max<std::size_t>(window, 1)) {
+    enabled = (GLAD_GL_VERSION_3_3 || has_extension("GL_ARB_timer_query"))
+        && glad_glQueryCounter != NULL
+        && glad_glGetQueryObjectui64v != NULL;
+}
+
+gl::GpuProfiler::~GpuProfiler() {
+    if (!all_queries.empty() && glad_glDeleteQueries != NULL) {
+        glDeleteQueries(static_cast<GLsizei>(all_queries.size()), all_queries.data());
+    }
+}
+
+bool gl::GpuProfiler::supported() const {
+    return enabled;
+}
+
+GLuint gl::GpuProfiler::query() {
+    if (pool.empty()) {
+        GLuint fresh[POOL_GROWTH];
+        glGenQueries(POOL_GROWTH, fresh);
+        pool.insert(pool.end(), fresh, fresh + POOL_GROWTH);
+        all_queries.insert(all_queries.end(), fresh, fresh + POOL_GROWTH);
+    }
+    GLuint id = pool.back();
+    pool.pop_back();
+    return id;
+}
+
+void gl::GpuProfiler::begin(const char* name) {
+    if (!enabled) {
+        return;
+    }
+    Marker marker{
+        name,
+        static_cast<std::uint32_t>(open.size()),
+        open.empty() ? -1 : open.back(),
+        query(),
+        0,
+    };
+    glQueryCounter(marker.begin, GL_TIMESTAMP);
+    current.last = marker.begin;
+    open.push_back(static_cast<std::int32_t>(current.markers.size()));
+    current.markers.push_back(marker);
+}
+
+void gl::GpuProfiler::end() {
+    if (!enabled) {
+        return;
+    }
+    if (open.empty()) {
+        std::cerr << "ERROR::GPU_PROFILER::UNBALANCED_END" << std::endl;
+        return;
+    }
+    Marker& marker = current.markers[open.back()];
+    open.pop_back();
+    marker.end = query();
+    glQueryCounter(marker.end, GL_TIMESTAMP);
+    current.last = marker.end;
+}
+
+void gl::GpuProfiler::end_frame() {
+    if (!enabled) {
+        return;
+    }
+    if (!open.empty()) {
+        std::cerr << "ERROR::GPU_PROFILER::UNCLOSED_MARKER "
+            << current.markers[open.back()].name << std::endl;
+        while (!open.empty()) {
+            end();
+        }
+    }
+
+    std::uint64_t frame = current.frame;
+    in_flight.push_back(std::move(current));
+    current = InFlight{};
+    current.frame = frame + 1;
+
+    // frames finish in order, one still running holds back the later ones
+    while (in_flight.size() > latency && resolve(in_flight.front())) {
+        in_flight.pop_front();
+    }
+}
+
+bool gl::GpuProfiler::resolve(InFlight& frame) {
+    if (frame.markers.empty()) {
+        return true;
+    }
+
+    GLint available = 0;
+    glGetQueryObjectiv(frame.last, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        return false;
+    }
+
+    last.frame = frame.frame;
+    last.passes.clear();
+    last.time = std::chrono::nanoseconds(0);
+
+    GLuint64 base = 0;
+    glGetQueryObjectui64v(frame.markers.front().begin, GL_QUERY_RESULT, &base);
+
+    for (const Marker& marker : frame.markers) {
+        GLuint64 begin = 0;
+        GLuint64 end = 0;
+        glGetQueryObjectui64v(marker.begin, GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(marker.end, GL_QUERY_RESULT, &end);
+        pool.push_back(marker.begin);
+        pool.push_back(marker.end);
+
+        GpuPass pass;
+        pass.name = marker.name;
+        pass.depth = marker.depth;
+        pass.parent = marker.parent;
+        pass.start = std::chrono::nanoseconds(begin >= base ? begin - base : 0);
+        pass.time = std::chrono::nanoseconds(end >= begin ? end - begin : 0);
+        last.passes.push_back(pass);
+        last.time = std::max(last.time, pass.start + pass.time);
+
+        Samples& named = samples.try_emplace(
+            marker.name, Samples{samples.size(), 0, frame.frame + 1, {}}
+        ).first->second;
+        named.depth = marker.depth;
+        // a name used again in the same frame adds to its sample
+        if (named.frame == frame.frame && !named.times.empty()) {
+            named.times.back() += pass.time;
+            continue;
+        }
+        named.frame = frame.frame;
+        named.times.push_back(pass.time);
+        if (named.times.size() > window) {
+            named.times.pop_front();
+        }
+    }
+    has_last = true;
+    return true;
+}
+
+const gl::GpuFrame* gl::GpuProfiler::last_frame() const {
+    return has_last ? &last : nullptr;
+}
+
+std::vector<gl::GpuPassStats> gl::GpuProfiler::stats() const {
+    std::vector<GpuPassStats> out(samples.size());
+    for (const auto& [name, pass] : samples) {
+        GpuPassStats& s = out[pass.order];
+        s.name = name;
+        s.depth = pass.depth;
+        s.samples = pass.times.size();
+        if (pass.times.empty()) {
+            continue;
+        }
+
+        std::vector<std::chrono::nanoseconds> sorted(pass.times.begin(), pass.times.end());
+        std::sort(sorted.begin(), sorted.end());
+        std::chrono::nanoseconds total(0);
+        for (std::chrono::nanoseconds time : sorted) {
+            total += time;
+        }
+        s.min = sorted.front();
+        s.avg = total / sorted.size();
+        // the smallest time at least 99% of the samples do not exceed
+        s.p99 = sorted[(sorted.size() * 99 + 99) / 100 - 1];
+    }
+    return out;
+}
+
+std::size_t gl::GpuProfiler::pending() const {
+    return in_flight.size();
+}
+
+void gl::GpuProfiler::print(std::ostream& out) const {
+    if (!enabled) {
+        out << "GPU passes: timer queries unsupported\n";
+        return;
+    }
+    out << "GPU passes over the last " << window << " frames\n";
+    for (const GpuPassStats& s : stats()) {
+        out << std::string(2 + 2 * s.depth, ' ') << s.name << "  min " << us(s.min)
+            << " us, avg " << us(s.avg) << " us, p99 " << us(s.p99) << " us ("
+            << s.samples << " frames)\n";
+    }
+}
+
+gl::GpuScope::GpuScope(GpuProfiler& profiler, const char* name) : profiler(profiler) {
+    profiler.begin(name);
+}
+
+gl::GpuScope::~GpuScope() {
+    profiler.end();
+}
@@ -0,0 +1,86 @@
+#include "MappedSource.hpp"
+
+#include <iostream>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+shaders::MappedSource::MappedSource(const char* path)
+    : addr(nullptr), length(0), open(false) {
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        std::cerr << "File not found at " << path << "." << std::endl;
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        std::cerr << "ERROR::MAPPED_SOURCE::UNABLE_TO_STAT " << path << std::endl;
+        return;
+    }
+
+    // mmap rejects zero length, an empty file is just an empty view
+    if (st.st_size > 0) {
+        void* mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            close(fd);
+            std::cerr << "ERROR::MAPPED_SOURCE::UNABLE_TO_MAP " << path << std::endl;
+            return;
+        }
+        madvise(mapped, st.st_size, MADV_SEQUENTIAL);
+        addr = mapped;
+        length = st.st_size;
+    }
+
+    // the mapping keeps the file alive
+    close(fd);
+    open = true;
+}
+
+shaders::MappedSource::~MappedSource() {
+    unmap();
+}
+
+shaders::MappedSource::MappedSource(MappedSource&& other) noexcept
+    : addr(std::exchange(other.addr, nullptr)),
+      length(std::exchange(other.length, 0)),
+      open(std::exchange(other.open, false)) {
+}
+
+shaders::MappedSource& shaders::MappedSource::operator=(MappedSource&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        addr = std::exchange(other.addr, nullptr);
+        length = std::exchange(other.length, 0);
+        open = std::exchange(other.open, false);
+    }
+    return *this;
+}
+
+bool shaders::MappedSource::is_open() const {
+    return open;
+}
+
+const char* shaders::MappedSource::data() const {
+    return addr ? static_cast<const char*>(addr) : "";
+}
+
+std::size_t shaders::MappedSource::size() const {
+    return length;
+}
+
+std::string_view shaders::MappedSource::view() const {
+    return std::string_view(data(), length);
+}
+
+void shaders::MappedSource::unmap() {
+    if (addr != nullptr) {
+        munmap(addr, length);
+        addr = nullptr;
+        length = 0;
+    }
+}
@@ -0,0 +1,1284 @@
+#include "NullBackend.hpp"
+#include "Extensions.hpp"
+#include "GladFunctions.hpp"
+#include "Std140.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+    enum Kind : std::size_t {
+        BUFFER,
+        VERTEX_ARRAY,
+        FRAMEBUFFER,
+        RENDERBUFFER,
+        TEXTURE,
+        SAMPLER,
+        QUERY,
+        PIPELINE,
+        TRANSFORM_FEEDBACK,
+        KIND_COUNT
+    };
+
+    struct Shader {
+        GLenum type = GL_NONE;
+        std::string source;
+    };
+
+    /**
+     * @brief An active uniform or vertex input. Arrays are named "a[0]"
+     * with size the element count, like glGetActiveUniform
+     *
+     */
+    struct Variable {
+        std::string name;
+        GLenum type = GL_NONE;
+        GLint size = 1;
+        GLint location = -1;
+    };
+
+    struct Block {
+        std::string name;
+        GLint data_size = 0;
+        GLint binding = 0;
+    };
+
+    struct Program {
+        std::vector<GLuint> shaders;
+        bool separable = false;
+        bool linked = false;
+        std::vector<Variable> attributes;
+        std::vector<Variable> uniforms;
+        std::vector<Block> blocks;
+    };
+
+    struct State {
+        // shaders, programs and every other kind share one name counter
+        GLuint next_name = 1;
+        std::unordered_set<GLuint> objects[KIND_COUNT];
+        std::unordered_map<GLuint, std::vector<unsigned char>> buffers;
+        std::unordered_map<GLuint, Shader> shaders;
+        std::unordered_map<GLuint, Program> programs;
+
+        // buffer bindings by target. Element array bindings are not per
+        // vertex array
+        std::unordered_map<GLenum, GLuint> bindings;
+        GLuint program = 0;
+        GLuint vertex_array = 0;
+        GLuint draw_framebuffer = 0;
+        GLuint read_framebuffer = 0;
+        GLuint renderbuffer = 0;
+        GLuint pipeline = 0;
+        GLenum active_texture = GL_TEXTURE0;
+        GLint viewport[4] = {};
+        std::uintptr_t syncs = 0;
+
+        gl::NullBackendStats stats;
+    };
+
+    State state;
+    bool loaded = false;
+
+    gladGLversionStruct saved_version;
+    constexpr std::size_t VERSION_COUNT = 19;
+    int saved_flags[VERSION_COUNT];
+
+    // the flags are thread local, so their addresses are taken per call
+    std::array<int*, VERSION_COUNT> version_flags() {
+        return {
+            &GLAD_GL_VERSION_1_0, &GLAD_GL_VERSION_1_1, &GLAD_GL_VERSION_1_2,
+            &GLAD_GL_VERSION_1_3, &GLAD_GL_VERSION_1_4, &GLAD_GL_VERSION_1_5,
+            &GLAD_GL_VERSION_2_0, &GLAD_GL_VERSION_2_1, &GLAD_GL_VERSION_3_0,
+            &GLAD_GL_VERSION_3_1, &GLAD_GL_VERSION_3_2, &GLAD_GL_VERSION_3_3,
+            &GLAD_GL_VERSION_4_0, &GLAD_GL_VERSION_4_1, &GLAD_GL_VERSION_4_2,
+            &GLAD_GL_VERSION_4_3, &GLAD_GL_VERSION_4_4, &GLAD_GL_VERSION_4_5,
+            &GLAD_GL_VERSION_4_6,
+        };
+    }
+
+    /**
+     * @brief The pointer an entry point had before the backend was loaded
+     *
+     */
+    template <std::size_t Id, typename Proc>
+    struct Saved {
+        static inline Proc ptr = nullptr;
+    };
+
+    /**
+     * @brief The default for every entry point: nothing, returning zero
+     *
+     */
+    template <typename Proc>
+    struct Stub;
+
+    template <typename R, typename... Args>
+    struct Stub<R (APIENTRYP)(Args...)> {
+        static R APIENTRY call(Args...) {
+            if constexpr (!std::is_void_v<R>) {
+                return R{};
+            }
+        }
+    };
+
+    template <typename Proc>
+    struct Draw;
+
+    template <typename... Args>
+    struct Draw<void (APIENTRYP)(Args...)> {
+        static void APIENTRY call(Args...) {
+            state.stats.draws++;
+        }
+    };
+
+    // GLSL scanning, only as deep as declarations at file scope
+
+    struct GlslType {
+        std::string_view name;
+        GLenum type;
+        // std140 shape, 0 columns for opaque types
+        int columns;
+        int rows;
+    };
+
+    constexpr GlslType GLSL_TYPES[] = {
+        {"float", GL_FLOAT, 1, 1},
+        {"vec2", GL_FLOAT_VEC2, 1, 2},
+        {"vec3", GL_FLOAT_VEC3, 1, 3},
+        {"vec4", GL_FLOAT_VEC4, 1, 4},
+        {"int", GL_INT, 1, 1},
+        {"ivec2", GL_INT_VEC2, 1, 2},
+        {"ivec3", GL_INT_VEC3, 1, 3},
+        {"ivec4", GL_INT_VEC4, 1, 4},
+        {"uint", GL_UNSIGNED_INT, 1, 1},
+        {"uvec2", GL_UNSIGNED_INT_VEC2, 1, 2},
+        {"uvec3", GL_UNSIGNED_INT_VEC3, 1, 3},
+        {"uvec4", GL_UNSIGNED_INT_VEC4, 1, 4},
+        {"bool", GL_BOOL, 1, 1},
+        {"bvec2", GL_BOOL_VEC2, 1, 2},
+        {"bvec3", GL_BOOL_VEC3, 1, 3},
+        {"bvec4", GL_BOOL_VEC4, 1, 4},
+        {"mat2", GL_FLOAT_MAT2, 2, 2},
+        {"mat3", GL_FLOAT_MAT3, 3, 3},
+        {"mat4", GL_FLOAT_MAT4, 4, 4},
+        {"mat2x2", GL_FLOAT_MAT2, 2, 2},
+        {"mat2x3", GL_FLOAT_MAT2x3, 2, 3},
+        {"mat2x4", GL_FLOAT_MAT2x4, 2, 4},
+        {"mat3x2", GL_FLOAT_MAT3x2, 3, 2},
+        {"mat3x3", GL_FLOAT_MAT3, 3, 3},
+        {"mat3x4", GL_FLOAT_MAT3x4, 3, 4},
+        {"mat4x2", GL_FLOAT_MAT4x2, 4, 2},
+        {"mat4x3", GL_FLOAT_MAT4x3, 4, 3},
+        {"mat4x4", GL_FLOAT_MAT4, 4, 4},
+        {"sampler1D", GL_SAMPLER_1D, 0, 0},
+        {"sampler2D", GL_SAMPLER_2D, 0, 0},
+        {"sampler3D", GL_SAMPLER_3D, 0, 0},
+        {"samplerCube", GL_SAMPLER_CUBE, 0, 0},
+        {"sampler2DArray", GL_SAMPLER_2D_ARRAY, 0, 0},
+        {"sampler2DShadow", GL_SAMPLER_2D_SHADOW, 0, 0},
+        {"samplerCubeShadow", GL_SAMPLER_CUBE_SHADOW, 0, 0},
+        {"sampler2DMS", GL_SAMPLER_2D_MULTISAMPLE, 0, 0},
+        {"samplerBuffer", GL_SAMPLER_BUFFER, 0, 0},
+        {"isampler2D", GL_INT_SAMPLER_2D, 0, 0},
+        {"usampler2D", GL_UNSIGNED_INT_SAMPLER_2D, 0, 0},
+    };
+
+    const GlslType* find_type(std::string_view name) {
+        for (const GlslType& t : GLSL_TYPES) {
+            if (t.name == name) {
+                return &t;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Offset and size of a block member under std140. Matrices are
+     * column major, types the scan does not know count as a vec4
+     *
+     */
+    void std140_member(const GlslType* type, GLint count, std::size_t& offset) {
+        std::size_t align = 16;
+        std::size_t size = 16;
+        if (type != nullptr && type->columns == 1) {
+            align = type->rows == 1 ? 4 : type->rows == 2 ? 8 : 16;
+            size = 4 * type->rows;
+        } else if (type != nullptr && type->columns > 1) {
+            size = 16 * type->columns;
+        }
+        if (count > 1) {
+            align = 16;
+            size = std140::round_up(size, 16) * count;
+        }
+        offset = std140::round_up(offset, align) + size;
+    }
+
+    /**
+     * @brief Identifiers, numbers and single punctuation characters, with
+     * comments and preprocessor lines removed
+     *
+     */
+    std::vector<std::string_view> tokenize(std::string_view src) {
+        std::vector<std::string_view> tokens;
+        bool line_start = true;
+        std::size_t i = 0;
+        while (i < src.size()) {
+            char c = src[i];
+            if (c == '\n') {
+                line_start = true;
+                i++;
+            } else if (std::isspace(static_cast<unsigned char>(c))) {
+                i++;
+            } else if (line_start && c == '#') {
+                // continued lines end with a backslash
+                while (i < src.size() && (src[i] != '\n' || src[i - 1] == '\\')) {
+                    i++;
+                }
+            } else if (src.substr(i, 2) == "//") {
+                i = std::min(src.find('\n', i), src.size());
+            } else if (src.substr(i, 2) == "/*") {
+                std::size_t end = src.find("*/", i + 2);
+                i = end == std::string_view::npos ? src.size() : end + 2;
+            } else if (std::isalnum(static_cast<unsigned char>(c)) || c == '_') {
+                std::size_t start = i;
+                while (i < src.size()
+                    && (std::isalnum(static_cast<unsigned char>(src[i])) || src[i] == '_'
+                        || src[i] == '.')) {
+                    i++;
+                }
+                tokens.push_back(src.substr(start, i - start));
+                line_start = false;
+            } else {
+                tokens.push_back(src.substr(i, 1));
+                line_start = false;
+                i++;
+            }
+        }
+        return tokens;
+    }
+
+    bool qualifier(std::string_view token) {
+        static const std::unordered_set<std::string_view> QUALIFIERS = {
+            "const", "flat", "smooth", "noperspective", "centroid", "sample",
+            "invariant", "precise", "highp", "mediump", "lowp", "row_major",
+            "column_major", "std140", "std430", "shared", "packed", "patch",
+            "readonly", "writeonly", "coherent", "volatile", "restrict",
+        };
+        return QUALIFIERS.contains(token);
+    }
+
+    /**
+     * @brief Reads declarations from a token list
+     *
+     */
+    struct Scanner {
+        const std::vector<std::string_view>& tokens;
+        std::size_t i = 0;
+
+        bool done() const {
+            return i >= tokens.size();
+        }
+
+        std::string_view peek(std::size_t ahead = 0) const {
+            return i + ahead < tokens.size() ? tokens[i + ahead] : std::string_view();
+        }
+
+        // past the next ';' or the '}' closing a body, whichever ends the
+        // declaration or definition
+        void skip_statement() {
+            int depth = 0;
+            while (!done()) {
+                std::string_view t = tokens[i++];
+                if (t == "{") {
+                    depth++;
+                } else if (t == "}" && --depth <= 0) {
+                    if (peek() == ";") {
+                        i++;
+                    }
+                    return;
+                } else if (t == ";" && depth == 0) {
+                    return;
+                }
+            }
+        }
+
+        // layout(...) and storage keywords. Returns the location, -1 if none
+        GLint qualifiers(bool& uniform, bool& in) {
+            GLint location = -1;
+            while (!done()) {
+                std::string_view t = peek();
+                if (t == "layout" && peek(1) == "(") {
+                    i += 2;
+                    while (!done() && peek() != ")") {
+                        if (peek() == "location" && peek(1) == "=") {
+                            location = std::atoi(std::string(peek(2)).c_str());
+                        }
+                        i++;
+                    }
+                    i++;
+                } else if (t == "uniform") {
+                    uniform = true;
+                    i++;
+                } else if (t == "in") {
+                    in = true;
+                    i++;
+                } else if (qualifier(t) || t == "out" || t == "inout" || t == "buffer") {
+                    i++;
+                } else {
+                    return location;
+                }
+            }
+            return location;
+        }
+
+        // "name", "name[N]" pairs up to ';', skipping initialisers
+        std::vector<std::pair<std::string_view, GLint>> declarators() {
+            std::vector<std::pair<std::string_view, GLint>> names;
+            while (!done()) {
+                std::string_view name = tokens[i++];
+                GLint count = 1;
+                if (peek() == "[") {
+                    count = std::max(1, std::atoi(std::string(peek(1)).c_str()));
+                    while (!done() && tokens[i] != "]") {
+                        i++;
+                    }
+                    i++;
+                }
+                names.emplace_back(name, count);
+                int depth = 0;
+                while (!done() && !(depth == 0 && (peek() == "," || peek() == ";"))) {
+                    std::string_view t = tokens[i++];
+                    depth += t == "(" || t == "{" ? 1 : t == ")" || t == "}" ? -1 : 0;
+                }
+                if (done() || tokens[i++] == ";") {
+                    break;
+                }
+            }
+            return names;
+        }
+    };
+
+    void add_variable(
+        std::vector<Variable>& list, std::string_view name, const GlslType* type,
+        GLint count, GLint location
+    ) {
+        for (const Variable& v : list) {
+            std::string_view existing = v.name;
+            if (existing.substr(0, existing.find('[')) == name) {
+                return;
+            }
+        }
+        Variable var;
+        var.name = count > 1 ? std::string(name) + "[0]" : std::string(name);
+        var.type = type->type;
+        var.size = count;
+        var.location = location;
+        list.push_back(std::move(var));
+    }
+
+    void scan_shader(const Shader& shader, Program& prgm) {
+        std::vector<std::string_view> tokens = tokenize(shader.source);
+        Scanner s{tokens};
+        while (!s.done()) {
+            bool uniform = false;
+            bool in = false;
+            GLint location = s.qualifiers(uniform, in);
+            bool attribute = in && shader.type == GL_VERTEX_SHADER;
+            if (!uniform && !attribute) {
+                s.skip_statement();
+                continue;
+            }
+
+            if (s.peek(1) == "{") {
+                std::string_view name = s.peek();
+                s.i += 2;
+                std::size_t size = 0;
+                while (!s.done() && s.peek() != "}") {
+                    bool ignored = false;
+                    s.qualifiers(ignored, ignored);
+                    const GlslType* type = find_type(s.peek());
+                    s.i++;
+                    for (auto [member, count] : s.declarators()) {
+                        std140_member(type, count, size);
+                    }
+                }
+                // past the '}', leaving the instance name and ';'
+                s.i++;
+                if (uniform) {
+                    Block block;
+                    block.name = name;
+                    block.data_size = std140::round_up(size, 16);
+                    prgm.blocks.push_back(std::move(block));
+                }
+                s.skip_statement();
+                continue;
+            }
+
+            const GlslType* type = find_type(s.peek());
+            if (type == nullptr || s.peek() == "struct") {
+                // struct uniforms are not reflected
+                s.skip_statement();
+                continue;
+            }
+            s.i++;
+            for (auto [name, count] : s.declarators()) {
+                add_variable(
+                    uniform ? prgm.uniforms : prgm.attributes, name, type, count,
+                    location
+                );
+                if (location >= 0) {
+                    location += count * std::max(type->columns, 1);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Give variables without a layout location the lowest free ones
+     *
+     */
+    void assign_locations(std::vector<Variable>& vars) {
+        std::vector<bool> used;
+        auto span = [](const Variable& v) {
+            for (const GlslType& t : GLSL_TYPES) {
+                if (t.type == v.type) {
+                    return v.size * std::max(t.columns, 1);
+                }
+            }
+            return v.size;
+        };
+        for (const Variable& v : vars) {
+            if (v.location >= 0) {
+                used.resize(std::max<std::size_t>(used.size(), v.location + span(v)));
+                std::fill_n(used.begin() + v.location, span(v), true);
+            }
+        }
+        for (Variable& v : vars) {
+            if (v.location >= 0) {
+                continue;
+            }
+            GLint n = span(v);
+            GLint loc = 0;
+            while (std::any_of(
+                used.begin() + std::min<std::size_t>(loc, used.size()),
+                used.begin() + std::min<std::size_t>(loc + n, used.size()),
+                [](bool b) { return b; }
+            )) {
+                loc++;
+            }
+            used.resize(std::max<std::size_t>(used.size(), loc + n));
+            std::fill_n(used.begin() + loc, n, true);
+            v.location = loc;
+        }
+    }
+
+    void link(Program& prgm) {
+        prgm.attributes.clear();
+        prgm.uniforms.clear();
+        prgm.blocks.clear();
+        for (GLuint name : prgm.shaders) {
+            auto it = state.shaders.find(name);
+            if (it != state.shaders.end()) {
+                scan_shader(it->second, prgm);
+            }
+        }
+        assign_locations(prgm.attributes);
+        assign_locations(prgm.uniforms);
+        prgm.linked = true;
+    }
+
+    /**
+     * @brief The location of "name" or "name[i]" in a list of variables
+     *
+     */
+    GLint find_location(const std::vector<Variable>& vars, std::string_view name) {
+        GLint element = 0;
+        std::size_t bracket = name.find('[');
+        if (bracket != std::string_view::npos) {
+            element = std::atoi(std::string(name.substr(bracket + 1)).c_str());
+            name = name.substr(0, bracket);
+        }
+        for (const Variable& v : vars) {
+            std::string_view base = v.name;
+            if (base.substr(0, base.find('[')) == name) {
+                return element < v.size ? v.location + element : -1;
+            }
+        }
+        return -1;
+    }
+
+    void write_name(
+        std::string_view name, GLsizei size, GLsizei* length, GLchar* out
+    ) {
+        GLsizei n = size > 0 ? std::min<GLsizei>(name.size(), size - 1) : 0;
+        if (out != nullptr && size > 0) {
+            std::memcpy(out, name.data(), n);
+            out[n] = '\0';
+        }
+        if (length != nullptr) {
+            *length = n;
+        }
+    }
+
+    Program* find_program(GLuint name) {
+        auto it = state.programs.find(name);
+        return it == state.programs.end() ? nullptr : &it->second;
+    }
+
+    // objects
+
+    template <Kind K>
+    void APIENTRY gen_names(GLsizei n, GLuint* names) {
+        for (GLsizei i = 0; i < n; i++) {
+            names[i] = state.next_name++;
+            state.objects[K].insert(names[i]);
+        }
+    }
+
+    template <Kind K>
+    void APIENTRY delete_names(GLsizei n, const GLuint* names) {
+        for (GLsizei i = 0; i < n; i++) {
+            state.objects[K].erase(names[i]);
+            if constexpr (K == BUFFER) {
+                state.buffers.erase(names[i]);
+                for (auto& [target, bound] : state.bindings) {
+                    bound = bound == names[i] ? 0 : bound;
+                }
+            } else if constexpr (K == VERTEX_ARRAY) {
+                state.vertex_array = state.vertex_array == names[i] ? 0 : state.vertex_array;
+            } else if constexpr (K == FRAMEBUFFER) {
+                if (state.draw_framebuffer == names[i]) {
+                    state.draw_framebuffer = 0;
+                }
+                if (state.read_framebuffer == names[i]) {
+                    state.read_framebuffer = 0;
+                }
+            } else if constexpr (K == PIPELINE) {
+                state.pipeline = state.pipeline == names[i] ? 0 : state.pipeline;
+            }
+        }
+    }
+
+    template <Kind K>
+    GLboolean APIENTRY is_name(GLuint name) {
+        return state.objects[K].contains(name) ? GL_TRUE : GL_FALSE;
+    }
+
+    // indexed binds also set the generic binding
+    void APIENTRY bind_buffer(GLenum target, GLuint buffer) {
+        state.bindings[target] = buffer;
+        if (buffer != 0) {
+            state.objects[BUFFER].insert(buffer);
+        }
+    }
+
+    void APIENTRY bind_buffer_base(GLenum target, GLuint, GLuint buffer) {
+        bind_buffer(target, buffer);
+    }
+
+    void APIENTRY bind_buffer_range(GLenum target, GLuint, GLuint buffer, GLintptr, GLsizeiptr) {
+        bind_buffer(target, buffer);
+    }
+
+    void APIENTRY bind_vertex_array(GLuint array) {
+        state.vertex_array = array;
+    }
+
+    void APIENTRY bind_framebuffer(GLenum target, GLuint framebuffer) {
+        if (target != GL_READ_FRAMEBUFFER) {
+            state.draw_framebuffer = framebuffer;
+        }
+        if (target != GL_DRAW_FRAMEBUFFER) {
+            state.read_framebuffer = framebuffer;
+        }
+    }
+
+    void APIENTRY bind_renderbuffer(GLenum, GLuint renderbuffer) {
+        state.renderbuffer = renderbuffer;
+    }
+
+    void APIENTRY bind_program_pipeline(GLuint pipeline) {
+        state.pipeline = pipeline;
+    }
+
+    void APIENTRY active_texture(GLenum texture) {
+        state.active_texture = texture;
+    }
+
+    void APIENTRY viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+        state.viewport[0] = x;
+        state.viewport[1] = y;
+        state.viewport[2] = width;
+        state.viewport[3] = height;
+    }
+
+    // buffers
+
+    std::vector<unsigned char>* bound_buffer(GLenum target) {
+        auto it = state.bindings.find(target);
+        if (it == state.bindings.end() || it->second == 0) {
+            return nullptr;
+        }
+        return &state.buffers[it->second];
+    }
+
+    void store(std::vector<unsigned char>* buffer, GLsizeiptr size, const void* data) {
+        if (buffer == nullptr || size < 0) {
+            return;
+        }
+        buffer->assign(size, 0);
+        if (data != nullptr) {
+            std::memcpy(buffer->data(), data, size);
+            state.stats.bytes += size;
+        }
+    }
+
+    void store_range(
+        std::vector<unsigned char>* buffer, GLintptr offset, GLsizeiptr size,
+        const void* data
+    ) {
+        if (buffer == nullptr || data == nullptr || offset < 0 || size < 0
+            || std::size_t(offset + size) > buffer->size()) {
+            return;
+        }
+        std::memcpy(buffer->data() + offset, data, size);
+        state.stats.bytes += size;
+    }
+
+    void load_range(
+        std::vector<unsigned char>* buffer, GLintptr offset, GLsizeiptr size, void* data
+    ) {
+        if (buffer == nullptr || data == nullptr || offset < 0 || size < 0
+            || std::size_t(offset + size) > buffer->size()) {
+            return;
+        }
+        std::memcpy(data, buffer->data() + offset, size);
+    }
+
+    void* map_range(std::vector<unsigned char>* buffer, GLintptr offset, GLsizeiptr length) {
+        if (buffer == nullptr || offset < 0 || length < 0
+            || std::size_t(offset + length) > buffer->size()) {
+            return nullptr;
+        }
+        return buffer->data() + offset;
+    }
+
+    void APIENTRY buffer_data(GLenum target, GLsizeiptr size, const void* data, GLenum) {
+        store(bound_buffer(target), size, data);
+    }
+
+    void APIENTRY buffer_storage(GLenum target, GLsizeiptr size, const void* data, GLbitfield) {
+        store(bound_buffer(target), size, data);
+    }
+
+    void APIENTRY named_buffer_data(GLuint buffer, GLsizeiptr size, const void* data, GLenum) {
+        store(&state.buffers[buffer], size, data);
+    }
+
+    void APIENTRY named_buffer_storage(
+        GLuint buffer, GLsizeiptr size, const void* data, GLbitfield
+    ) {
+        store(&state.buffers[buffer], size, data);
+    }
+
+    void APIENTRY buffer_sub_data(
+        GLenum target, GLintptr offset, GLsizeiptr size, const void* data
+    ) {
+        store_range(bound_buffer(target), offset, size, data);
+    }
+
+    void APIENTRY named_buffer_sub_data(
+        GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data
+    ) {
+        store_range(&state.buffers[buffer], offset, size, data);
+    }
+
+    void APIENTRY get_buffer_sub_data(
+        GLenum target, GLintptr offset, GLsizeiptr size, void* data
+    ) {
+        load_range(bound_buffer(target), offset, size, data);
+    }
+
+    void APIENTRY get_named_buffer_sub_data(
+        GLuint buffer, GLintptr offset, GLsizeiptr size, void* data
+    ) {
+        load_range(&state.buffers[buffer], offset, size, data);
+    }
+
+    void APIENTRY copy_buffer_sub_data(
+        GLenum read, GLenum write, GLintptr read_offset, GLintptr write_offset,
+        GLsizeiptr size
+    ) {
+        std::vector<unsigned char>* from = bound_buffer(read);
+        if (from != nullptr && read_offset >= 0 && size >= 0
+            && std::size_t(read_offset + size) <= from->size()) {
+            // through a copy, the ranges may be in the same buffer
+            std::vector<unsigned char> bytes(
+                from->begin() + read_offset, from->begin() + read_offset + size
+            );
+            store_range(bound_buffer(write), write_offset, size, bytes.data());
+        }
+    }
+
+    void APIENTRY get_buffer_parameteriv(GLenum target, GLenum pname, GLint* params) {
+        std::vector<unsigned char>* buffer = bound_buffer(target);
+        *params = pname == GL_BUFFER_SIZE && buffer != nullptr ? GLint(buffer->size()) : 0;
+    }
+
+    void* APIENTRY map_buffer(GLenum target, GLenum) {
+        std::vector<unsigned char>* buffer = bound_buffer(target);
+        return buffer != nullptr ? map_range(buffer, 0, buffer->size()) : nullptr;
+    }
+
+    void* APIENTRY map_buffer_range(
+        GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield
+    ) {
+        return map_range(bound_buffer(target), offset, length);
+    }
+
+    void* APIENTRY map_named_buffer_range(
+        GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield
+    ) {
+        return map_range(&state.buffers[buffer], offset, length);
+    }
+
+    GLboolean APIENTRY unmap_buffer(GLenum) {
+        return GL_TRUE;
+    }
+
+    GLboolean APIENTRY unmap_named_buffer(GLuint) {
+        return GL_TRUE;
+    }
+
+    // shaders and programs
+
+    GLuint APIENTRY create_shader(GLenum type) {
+        GLuint name = state.next_name++;
+        state.shaders[name].type = type;
+        return name;
+    }
+
+    void APIENTRY delete_shader(GLuint shader) {
+        state.shaders.erase(shader);
+    }
+
+    GLboolean APIENTRY is_shader(GLuint shader) {
+        return state.shaders.contains(shader) ? GL_TRUE : GL_FALSE;
+    }
+
+    void APIENTRY shader_source(
+        GLuint shader, GLsizei count, const GLchar* const* strings, const GLint* lengths
+    ) {
+        auto it = state.shaders.find(shader);
+        if (it == state.shaders.end()) {
+            return;
+        }
+        std::string& source = it->second.source;
+        source.clear();
+        for (GLsizei i = 0; i < count; i++) {
+            if (lengths != nullptr && lengths[i] >= 0) {
+                source.append(strings[i], lengths[i]);
+            } else {
+                source.append(strings[i]);
+            }
+        }
+    }
+
+    void APIENTRY get_shaderiv(GLuint shader, GLenum pname, GLint* params) {
+        auto it = state.shaders.find(shader);
+        switch (pname) {
+            case GL_COMPILE_STATUS:
+                *params = it != state.shaders.end();
+                break;
+            case GL_SHADER_TYPE:
+                *params = it != state.shaders.end() ? it->second.type : 0;
+                break;
+            case GL_SHADER_SOURCE_LENGTH:
+                *params = it != state.shaders.end() ? it->second.source.size() + 1 : 0;
+                break;
+            default:
+                *params = 0;
+        }
+    }
+
+    void APIENTRY get_info_log(GLuint, GLsizei size, GLsizei* length, GLchar* log) {
+        write_name("", size, length, log);
+    }
+
+    GLuint APIENTRY create_program() {
+        GLuint name = state.next_name++;
+        state.programs[name];
+        return name;
+    }
+
+    void APIENTRY delete_program(GLuint prgm) {
+        state.programs.erase(prgm);
+    }
+
+    GLboolean APIENTRY is_program(GLuint prgm) {
+        return state.programs.contains(prgm) ? GL_TRUE : GL_FALSE;
+    }
+
+    void APIENTRY attach_shader(GLuint prgm, GLuint shader) {
+        if (Program* p = find_program(prgm)) {
+            p->shaders.push_back(shader);
+        }
+    }
+
+    void APIENTRY detach_shader(GLuint prgm, GLuint shader) {
+        if (Program* p = find_program(prgm)) {
+            std::erase(p->shaders, shader);
+        }
+    }
+
+    void APIENTRY program_parameteri(GLuint prgm, GLenum pname, GLint value) {
+        Program* p = find_program(prgm);
+        if (p != nullptr && pname == GL_PROGRAM_SEPARABLE) {
+            p->separable = value != 0;
+        }
+    }
+
+    void APIENTRY link_program(GLuint prgm) {
+        if (Program* p = find_program(prgm)) {
+            link(*p);
+        }
+    }
+
+    void APIENTRY use_program(GLuint prgm) {
+        state.program = prgm;
+    }
+
+    template <typename List>
+    GLint max_name_length(const List& list) {
+        std::size_t length = 0;
+        for (const auto& item : list) {
+            length = std::max(length, item.name.size() + 1);
+        }
+        return length;
+    }
+
+    void APIENTRY get_programiv(GLuint prgm, GLenum pname, GLint* params) {
+        Program* p = find_program(prgm);
+        if (p == nullptr) {
+            *params = 0;
+            return;
+        }
+        switch (pname) {
+            case GL_LINK_STATUS:                          *params = p->linked; break;
+            case GL_VALIDATE_STATUS:                      *params = p->linked; break;
+            case GL_PROGRAM_SEPARABLE:                    *params = p->separable; break;
+            case GL_ATTACHED_SHADERS:                     *params = p->shaders.size(); break;
+            case GL_ACTIVE_ATTRIBUTES:                    *params = p->attributes.size(); break;
+            case GL_ACTIVE_ATTRIBUTE_MAX_LENGTH:          *params = max_name_length(p->attributes); break;
+            case GL_ACTIVE_UNIFORMS:                      *params = p->uniforms.size(); break;
+            case GL_ACTIVE_UNIFORM_MAX_LENGTH:            *params = max_name_length(p->uniforms); break;
+            case GL_ACTIVE_UNIFORM_BLOCKS:                *params = p->blocks.size(); break;
+            case GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH: *params = max_name_length(p->blocks); break;
+            default:                                      *params = 0;
+        }
+    }
+
+    void get_active(
+        const std::vector<Variable>* vars, GLuint index, GLsizei size, GLsizei* length,
+        GLint* count, GLenum* type, GLchar* name
+    ) {
+        if (vars == nullptr || index >= vars->size()) {
+            write_name("", size, length, name);
+            return;
+        }
+        const Variable& v = (*vars)[index];
+        write_name(v.name, size, length, name);
+        *count = v.size;
+        *type = v.type;
+    }
+
+    void APIENTRY get_active_attrib(
+        GLuint prgm, GLuint index, GLsizei size, GLsizei* length, GLint* count,
+        GLenum* type, GLchar* name
+    ) {
+        Program* p = find_program(prgm);
+        get_active(p ? &p->attributes : nullptr, index, size, length, count, type, name);
+    }
+
+    void APIENTRY get_active_uniform(
+        GLuint prgm, GLuint index, GLsizei size, GLsizei* length, GLint* count,
+        GLenum* type, GLchar* name
+    ) {
+        Program* p = find_program(prgm);
+        get_active(p ? &p->uniforms : nullptr, index, size, length, count, type, name);
+    }
+
+    GLint APIENTRY get_attrib_location(GLuint prgm, const GLchar* name) {
+        Program* p = find_program(prgm);
+        return p != nullptr ? find_location(p->attributes, name) : -1;
+    }
+
+    GLint APIENTRY get_uniform_location(GLuint prgm, const GLchar* name) {
+        Program* p = find_program(prgm);
+        return p != nullptr ? find_location(p->uniforms, name) : -1;
+    }
+
+    GLuint APIENTRY get_uniform_block_index(GLuint prgm, const GLchar* name) {
+        if (Program* p = find_program(prgm)) {
+            for (std::size_t i = 0; i < p->blocks.size(); i++) {
+                if (p->blocks[i].name == name) {
+                    return i;
+                }
+            }
+        }
+        return GL_INVALID_INDEX;
+    }
+
+    void APIENTRY get_active_uniform_block_name(
+        GLuint prgm, GLuint index, GLsizei size, GLsizei* length, GLchar* name
+    ) {
+        Program* p = find_program(prgm);
+        bool found = p != nullptr && index < p->blocks.size();
+        write_name(found ? p->blocks[index].name : "", size, length, name);
+    }
+
+    void APIENTRY get_active_uniform_blockiv(
+        GLuint prgm, GLuint index, GLenum pname, GLint* params
+    ) {
+        Program* p = find_program(prgm);
+        if (p == nullptr || index >= p->blocks.size()) {
+            *params = 0;
+            return;
+        }
+        const Block& block = p->blocks[index];
+        switch (pname) {
+            case GL_UNIFORM_BLOCK_BINDING:     *params = block.binding; break;
+            case GL_UNIFORM_BLOCK_DATA_SIZE:   *params = block.data_size; break;
+            case GL_UNIFORM_BLOCK_NAME_LENGTH: *params = block.name.size() + 1; break;
+            default:                           *params = 0;
+        }
+    }
+
+    void APIENTRY uniform_block_binding(GLuint prgm, GLuint index, GLuint binding) {
+        Program* p = find_program(prgm);
+        if (p != nullptr && index < p->blocks.size()) {
+            p->blocks[index].binding = binding;
+        }
+    }
+
+    GLuint APIENTRY create_shader_programv(
+        GLenum type, GLsizei count, const GLchar* const* strings
+    ) {
+        GLuint shader = create_shader(type);
+        shader_source(shader, count, strings, nullptr);
+        GLuint prgm = create_program();
+        Program& p = state.programs[prgm];
+        p.separable = true;
+        p.shaders.push_back(shader);
+        link(p);
+        p.shaders.clear();
+        delete_shader(shader);
+        return prgm;
+    }
+
+    void APIENTRY get_program_pipelineiv(GLuint, GLenum pname, GLint* params) {
+        *params = pname == GL_VALIDATE_STATUS ? GL_TRUE : 0;
+    }
+
+    // queries
+
+    /**
+     * @brief Values of glGet, unknown ones are 0
+     *
+     * @return the number of values written
+     */
+    int get_integers(GLenum pname, GLint* out) {
+        auto binding = [](GLenum target) {
+            auto it = state.bindings.find(target);
+            return it == state.bindings.end() ? 0 : GLint(it->second);
+        };
+        switch (pname) {
+            case GL_VIEWPORT:
+                std::copy(std::begin(state.viewport), std::end(state.viewport), out);
+                return 4;
+            case GL_CURRENT_PROGRAM:                   *out = state.program; break;
+            case GL_VERTEX_ARRAY_BINDING:              *out = state.vertex_array; break;
+            case GL_DRAW_FRAMEBUFFER_BINDING:          *out = state.draw_framebuffer; break;
+            case GL_READ_FRAMEBUFFER_BINDING:          *out = state.read_framebuffer; break;
+            case GL_RENDERBUFFER_BINDING:              *out = state.renderbuffer; break;
+            case GL_PROGRAM_PIPELINE_BINDING:          *out = state.pipeline; break;
+            case GL_ACTIVE_TEXTURE:                    *out = state.active_texture; break;
+            case GL_ARRAY_BUFFER_BINDING:              *out = binding(GL_ARRAY_BUFFER); break;
+            case GL_ELEMENT_ARRAY_BUFFER_BINDING:      *out = binding(GL_ELEMENT_ARRAY_BUFFER); break;
+            case GL_UNIFORM_BUFFER_BINDING:            *out = binding(GL_UNIFORM_BUFFER); break;
+            case GL_MAJOR_VERSION:                     *out = 4; break;
+            case GL_MINOR_VERSION:                     *out = 6; break;
+            case GL_CONTEXT_PROFILE_MASK:              *out = GL_CONTEXT_CORE_PROFILE_BIT; break;
+            case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:   *out = 256; break;
+            case GL_MAX_UNIFORM_BUFFER_BINDINGS:       *out = 84; break;
+            case GL_MAX_UNIFORM_BLOCK_SIZE:            *out = 65536; break;
+            case GL_MAX_VERTEX_ATTRIBS:                *out = 16; break;
+            case GL_MAX_TEXTURE_IMAGE_UNITS:           *out = 32; break;
+            case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:  *out = 192; break;
+            case GL_MAX_TEXTURE_SIZE:                  *out = 16384; break;
+            case GL_MAX_DRAW_BUFFERS:                  *out = 8; break;
+            case GL_MAX_COLOR_ATTACHMENTS:             *out = 8; break;
+            default:                                   *out = 0;
+        }
+        return 1;
+    }
+
+    void APIENTRY get_integerv(GLenum pname, GLint* data) {
+        get_integers(pname, data);
+    }
+
+    void APIENTRY get_integer64v(GLenum pname, GLint64* data) {
+        GLint values[4];
+        int n = get_integers(pname, values);
+        std::copy_n(values, n, data);
+    }
+
+    void APIENTRY get_floatv(GLenum pname, GLfloat* data) {
+        GLint values[4];
+        int n = get_integers(pname, values);
+        std::copy_n(values, n, data);
+    }
+
+    void APIENTRY get_booleanv(GLenum pname, GLboolean* data) {
+        GLint values[4];
+        int n = get_integers(pname, values);
+        std::transform(values, values + n, data, [](GLint v) {
+            return v != 0 ? GL_TRUE : GL_FALSE;
+        });
+    }
+
+    const GLubyte* APIENTRY get_string(GLenum name) {
+        const char* str = nullptr;
+        switch (name) {
+            case GL_VENDOR:                   str = "learn_opengl"; break;
+            case GL_RENDERER:                 str = "null"; break;
+            case GL_VERSION:                  str = "4.6 (Core Profile) null"; break;
+            case GL_SHADING_LANGUAGE_VERSION: str = "4.60"; break;
+            case GL_EXTENSIONS:               str = ""; break;
+        }
+        return reinterpret_cast<const GLubyte*>(str);
+    }
+
+    GLenum APIENTRY check_framebuffer_status(GLenum) {
+        return GL_FRAMEBUFFER_COMPLETE;
+    }
+
+    GLenum APIENTRY check_named_framebuffer_status(GLuint, GLenum) {
+        return GL_FRAMEBUFFER_COMPLETE;
+    }
+
+    GLsync APIENTRY fence_sync(GLenum, GLbitfield) {
+        return reinterpret_cast<GLsync>(++state.syncs);
+    }
+
+    GLboolean APIENTRY is_sync(GLsync sync) {
+        return sync != nullptr ? GL_TRUE : GL_FALSE;
+    }
+
+    GLenum APIENTRY client_wait_sync(GLsync, GLbitfield, GLuint64) {
+        return GL_ALREADY_SIGNALED;
+    }
+
+    void APIENTRY get_synciv(
+        GLsync, GLenum pname, GLsizei count, GLsizei* length, GLint* values
+    ) {
+        if (count > 0) {
+            values[0] = pname == GL_SYNC_STATUS ? GL_SIGNALED : 0;
+        }
+        if (length != nullptr) {
+            *length = count > 0 ? 1 : 0;
+        }
+    }
+
+    // results are always available and always zero
+    template <typename T>
+    void APIENTRY get_query_object(GLuint, GLenum pname, T* params) {
+        *params = pname == GL_QUERY_RESULT_AVAILABLE ? 1 : 0;
+    }
+
+    void APIENTRY get_queryiv(GLenum, GLenum pname, GLint* params) {
+        *params = pname == GL_QUERY_COUNTER_BITS ? 64 : 0;
+    }
+} // namespace
+
+void gl::load_null_backend() {
+    if (loaded) {
+        return;
+    }
+
+#define GLAD_FUNCTION(name)                                                   \
+    Saved<FN_##name, decltype(glad_##name)>::ptr = glad_##name;               \
+    glad_##name = Stub<decltype(glad_##name)>::call;
+#include "glad_functions.inc"
+#undef GLAD_FUNCTION
+
+    glad_glGenBuffers = gen_names<BUFFER>;
+    glad_glCreateBuffers = gen_names<BUFFER>;
+    glad_glDeleteBuffers = delete_names<BUFFER>;
+    glad_glIsBuffer = is_name<BUFFER>;
+    glad_glGenVertexArrays = gen_names<VERTEX_ARRAY>;
+    glad_glCreateVertexArrays = gen_names<VERTEX_ARRAY>;
+    glad_glDeleteVertexArrays = delete_names<VERTEX_ARRAY>;
+    glad_glIsVertexArray = is_name<VERTEX_ARRAY>;
+    glad_glGenFramebuffers = gen_names<FRAMEBUFFER>;
+    glad_glCreateFramebuffers = gen_names<FRAMEBUFFER>;
+    glad_glDeleteFramebuffers = delete_names<FRAMEBUFFER>;
+    glad_glIsFramebuffer = is_name<FRAMEBUFFER>;
+    glad_glGenRenderbuffers = gen_names<RENDERBUFFER>;
+    glad_glCreateRenderbuffers = gen_names<RENDERBUFFER>;
+    glad_glDeleteRenderbuffers = delete_names<RENDERBUFFER>;
+    glad_glIsRenderbuffer = is_name<RENDERBUFFER>;
+    glad_glGenTextures = gen_names<TEXTURE>;
+    glad_glDeleteTextures = delete_names<TEXTURE>;
+    glad_glIsTexture = is_name<TEXTURE>;
+    glad_glGenSamplers = gen_names<SAMPLER>;
+    glad_glCreateSamplers = gen_names<SAMPLER>;
+    glad_glDeleteSamplers = delete_names<SAMPLER>;
+    glad_glIsSampler = is_name<SAMPLER>;
+    glad_glGenQueries = gen_names<QUERY>;
+    glad_glDeleteQueries = delete_names<QUERY>;
+    glad_glIsQuery = is_name<QUERY>;
+    glad_glGenProgramPipelines = gen_names<PIPELINE>;
+    glad_glCreateProgramPipelines = gen_names<PIPELINE>;
+    glad_glDeleteProgramPipelines = delete_names<PIPELINE>;
+    glad_glIsProgramPipeline = is_name<PIPELINE>;
+    glad_glGenTransformFeedbacks = gen_names<TRANSFORM_FEEDBACK>;
+    glad_glCreateTransformFeedbacks = gen_names<TRANSFORM_FEEDBACK>;
+    glad_glDeleteTransformFeedbacks = delete_names<TRANSFORM_FEEDBACK>;
+    glad_glIsTransformFeedback = is_name<TRANSFORM_FEEDBACK>;
+
+    glad_glBindBuffer = bind_buffer;
+    glad_glBindBufferBase = bind_buffer_base;
+    glad_glBindBufferRange = bind_buffer_range;
+    glad_glBindVertexArray = bind_vertex_array;
+    glad_glBindFramebuffer = bind_framebuffer;
+    glad_glBindRenderbuffer = bind_renderbuffer;
+    glad_glBindProgramPipeline = bind_program_pipeline;
+    glad_glActiveTexture = active_texture;
+    glad_glViewport = viewport;
+
+    glad_glBufferData = buffer_data;
+    glad_glBufferStorage = buffer_storage;
+    glad_glNamedBufferData = named_buffer_data;
+    glad_glNamedBufferStorage = named_buffer_storage;
+    glad_glBufferSubData = buffer_sub_data;
+    glad_glNamedBufferSubData = named_buffer_sub_data;
+    glad_glGetBufferSubData = get_buffer_sub_data;
+    glad_glGetNamedBufferSubData = get_named_buffer_sub_data;
+    glad_glCopyBufferSubData = copy_buffer_sub_data;
+    glad_glGetBufferParameteriv = get_buffer_parameteriv;
+    glad_glMapBuffer = map_buffer;
+    glad_glMapBufferRange = map_buffer_range;
+    glad_glMapNamedBufferRange = map_named_buffer_range;
+    glad_glUnmapBuffer = unmap_buffer;
+    glad_glUnmapNamedBuffer = unmap_named_buffer;
+
+    glad_glCreateShader = create_shader;
+    glad_glDeleteShader = delete_shader;
+    glad_glIsShader = is_shader;
+    glad_glShaderSource = shader_source;
+    glad_glGetShaderiv = get_shaderiv;
+    glad_glGetShaderInfoLog = get_info_log;
+    glad_glCreateProgram = create_program;
+    glad_glDeleteProgram = delete_program;
+    glad_glIsProgram = is_program;
+    glad_glAttachShader = attach_shader;
+    glad_glDetachShader = detach_shader;
+    glad_glProgramParameteri = program_parameteri;
+    glad_glLinkProgram = link_program;
+    glad_glUseProgram = use_program;
+    glad_glGetProgramiv = get_programiv;
+    glad_glGetProgramInfoLog = get_info_log;
+    glad_glGetActiveAttrib = get_active_attrib;
+    glad_glGetActiveUniform = get_active_uniform;
+    glad_glGetAttribLocation = get_attrib_location;
+    glad_glGetUniformLocation = get_uniform_location;
+    glad_glGetUniformBlockIndex = get_uniform_block_index;
+    glad_glGetActiveUniformBlockName = get_active_uniform_block_name;
+    glad_glGetActiveUniformBlockiv = get_active_uniform_blockiv;
+    glad_glUniformBlockBinding = uniform_block_binding;
+    glad_glCreateShaderProgramv = create_shader_programv;
+    glad_glGetProgramPipelineiv = get_program_pipelineiv;
+    glad_glGetProgramPipelineInfoLog = get_info_log;
+
+    glad_glGetIntegerv = get_integerv;
+    glad_glGetInteger64v = get_integer64v;
+    glad_glGetFloatv = get_floatv;
+    glad_glGetBooleanv = get_booleanv;
+    glad_glGetString = get_string;
+    glad_glCheckFramebufferStatus = check_framebuffer_status;
+    glad_glCheckNamedFramebufferStatus = check_named_framebuffer_status;
+    glad_glFenceSync = fence_sync;
+    glad_glIsSync = is_sync;
+    glad_glClientWaitSync = client_wait_sync;
+    glad_glGetSynciv = get_synciv;
+    glad_glGetQueryObjectiv = get_query_object<GLint>;
+    glad_glGetQueryObjectuiv = get_query_object<GLuint>;
+    glad_glGetQueryObjecti64v = get_query_object<GLint64>;
+    glad_glGetQueryObjectui64v = get_query_object<GLuint64>;
+    glad_glGetQueryiv = get_queryiv;
+
+    glad_glDrawArrays = Draw<decltype(glad_glDrawArrays)>::call;
+    glad_glDrawArraysInstanced = Draw<decltype(glad_glDrawArraysInstanced)>::call;
+    glad_glDrawArraysIndirect = Draw<decltype(glad_glDrawArraysIndirect)>::call;
+    glad_glDrawElements = Draw<decltype(glad_glDrawElements)>::call;
+    glad_glDrawElementsInstanced = Draw<decltype(glad_glDrawElementsInstanced)>::call;
+    glad_glDrawElementsBaseVertex = Draw<decltype(glad_glDrawElementsBaseVertex)>::call;
+    glad_glDrawElementsIndirect = Draw<decltype(glad_glDrawElementsIndirect)>::call;
+    glad_glDrawRangeElements = Draw<decltype(glad_glDrawRangeElements)>::call;
+    glad_glMultiDrawArrays = Draw<decltype(glad_glMultiDrawArrays)>::call;
+    glad_glMultiDrawElements = Draw<decltype(glad_glMultiDrawElements)>::call;
+    glad_glMultiDrawArraysIndirect = Draw<decltype(glad_glMultiDrawArraysIndirect)>::call;
+    glad_glMultiDrawElementsIndirect = Draw<decltype(glad_glMultiDrawElementsIndirect)>::call;
+
+    saved_version = GLVersion;
+    GLVersion.major = 4;
+    GLVersion.minor = 6;
+    std::array<int*, VERSION_COUNT> flags = version_flags();
+    for (std::size_t i = 0; i < VERSION_COUNT; i++) {
+        saved_flags[i] = *flags[i];
+        *flags[i] = 1;
+    }
+
+    state = State{};
+    loaded = true;
+    reload_extensions();
+}
+
+void gl::unload_null_backend() {
+    if (!loaded) {
+        return;
+    }
+
+#define GLAD_FUNCTION(name)                                                   \
+    glad_##name = Saved<FN_##name, decltype(glad_##name)>::ptr;
+#include "glad_functions.inc"
+#undef GLAD_FUNCTION
+
+    GLVersion = saved_version;
+    std::array<int*, VERSION_COUNT> flags = version_flags();
+    for (std::size_t i = 0; i < VERSION_COUNT; i++) {
+        *flags[i] = saved_flags[i];
+    }
+
+    state = State{};
+    loaded = false;
+    reload_extensions();
+}
+
+bool gl::null_backend_loaded() {
+    return loaded;
+}
+
+const gl::NullBackendStats& gl::null_backend_stats() {
+    return state.stats;
+}
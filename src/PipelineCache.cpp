@@ -0,0 +1,188 @@
+#include "PipelineCache.hpp"
+#include "CompileRecords.hpp"
+#include "Sources.hpp"
+
+#include <iostream>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    const char* stage_name(GLenum type) {
+        return type == GL_VERTEX_SHADER ? "VERTEX" : "FRAGMENT";
+    }
+
+    /**
+     * @brief Compile one stage and link it on its own into a separable
+     * program. glCreateShaderProgramv does the same but needs a null
+     * terminated source
+     *
+     * @return the program object, 0 if the stage failed to build
+     */
+    GLuint link_stage(
+        GLenum type, std::string_view code, const std::string& label,
+        shaders::ProgramRecord& record
+    ) {
+        const GLchar* code_ptr = code.data();
+        const GLint code_len = code.length();
+        shaders::StageRecord& stage =
+            type == GL_VERTEX_SHADER ? record.vertex : record.fragment;
+
+        int success;
+        auto start = Clock::now();
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &code_ptr, &code_len);
+        glCompileShader(shader);
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        stage.type = type;
+        stage.compile = Clock::now() - start;
+        stage.compiled = success;
+        stage.log = shaders::shader_info_log(shader);
+        if (!success) {
+            std::cout << "ERROR::SHADER::" << stage_name(type) << "::COMPILATION_FAILED "
+                << label << "\n" << stage.log << std::endl;
+            glDeleteShader(shader);
+            return 0;
+        }
+
+        start = Clock::now();
+        GLuint prgm = glCreateProgram();
+        glProgramParameteri(prgm, GL_PROGRAM_SEPARABLE, GL_TRUE);
+        glAttachShader(prgm, shader);
+        glLinkProgram(prgm);
+        glDetachShader(prgm, shader);
+        glDeleteShader(shader);
+
+        glGetProgramiv(prgm, GL_LINK_STATUS, &success);
+        record.link = Clock::now() - start;
+        record.linked = success;
+        record.link_log = shaders::program_info_log(prgm);
+        if (!success) {
+            std::cout << "ERROR::SHADER::" << stage_name(type) << "::LINKING_FAILED "
+                << label << "\n" << record.link_log << std::endl;
+            glDeleteProgram(prgm);
+            return 0;
+        }
+        record.program = prgm;
+        return prgm;
+    }
+} // namespace
+
+bool shaders::pipelines_supported() {
+    return GLAD_GL_VERSION_4_1 && glGenProgramPipelines != nullptr;
+}
+
+shaders::PipelineCache::PipelineCache() : separable(pipelines_supported()) {
+    if (!separable) {
+        std::cerr << "ERROR::PIPELINE::UNSUPPORTED program pipelines need GL 4.1"
+            << std::endl;
+    }
+}
+
+shaders::PipelineCache::~PipelineCache() {
+    for (const auto& [key, pipeline] : pipelines) {
+        if (pipeline != 0) {
+            glDeleteProgramPipelines(1, &pipeline);
+        }
+    }
+    for (Stage& stage : stages) {
+        if (stage.shader.id != 0) {
+            glDeleteProgram(stage.shader.id);
+        }
+    }
+}
+
+bool shaders::PipelineCache::supported() const {
+    return separable;
+}
+
+std::size_t shaders::PipelineCache::add_stage(GLenum type, const char* path) {
+    auto start = Clock::now();
+    SourceText source(path);
+    auto read = Clock::now() - start;
+
+    std::size_t index = add_stage_source(type, source.view(), path);
+    compile_record(stages[index].record).read = read;
+    return index;
+}
+
+std::size_t shaders::PipelineCache::add_stage_source(
+    GLenum type, std::string_view code, std::string label
+) {
+    auto start = Clock::now();
+    std::size_t record = add_compile_record(label);
+    GLuint prgm = separable ? link_stage(type, code, label, compile_record(record)) : 0;
+    stages.push_back(Stage{std::move(label), type, record, Shader(prgm, record)});
+    counters.stages++;
+    counters.stage_time += Clock::now() - start;
+    return stages.size() - 1;
+}
+
+shaders::Shader& shaders::PipelineCache::stage(std::size_t index) {
+    return stages.at(index).shader;
+}
+
+GLuint shaders::PipelineCache::pipeline(std::size_t vert, std::size_t frag) {
+    std::uint64_t key = (std::uint64_t(vert) << 32) | std::uint64_t(frag);
+    auto cached = pipelines.find(key);
+    if (cached != pipelines.end()) {
+        counters.hits++;
+        return cached->second;
+    }
+
+    auto start = Clock::now();
+    const Stage& v = stages.at(vert);
+    const Stage& f = stages.at(frag);
+
+    GLuint pipeline = 0;
+    if (v.type != GL_VERTEX_SHADER || f.type != GL_FRAGMENT_SHADER) {
+        std::cerr << "ERROR::PIPELINE::WRONG_STAGE " << v.label << " " << f.label
+            << std::endl;
+    } else if (v.shader.id != 0 && f.shader.id != 0) {
+        glGenProgramPipelines(1, &pipeline);
+        glUseProgramStages(pipeline, GL_VERTEX_SHADER_BIT, v.shader.id);
+        glUseProgramStages(pipeline, GL_FRAGMENT_SHADER_BIT, f.shader.id);
+
+        // interface mismatches between the stages only show up here. The
+        // result also depends on state such as sampler units, so the
+        // pipeline is kept either way
+        int success;
+        glValidateProgramPipeline(pipeline);
+        glGetProgramPipelineiv(pipeline, GL_VALIDATE_STATUS, &success);
+        if (!success) {
+            std::cout << "ERROR::PIPELINE::VALIDATION_FAILED " << v.label << " "
+                << f.label << "\n" << pipeline_info_log(pipeline) << std::endl;
+        }
+    }
+
+    // failures are cached too so they are only reported once
+    pipelines.emplace(key, pipeline);
+    if (pipeline != 0) {
+        counters.pipelines++;
+    }
+    counters.assemble_time += Clock::now() - start;
+    return pipeline;
+}
+
+void shaders::PipelineCache::use(std::size_t vert, std::size_t frag) {
+    GLuint id = pipeline(vert, frag);
+    glUseProgram(0);
+    glBindProgramPipeline(id);
+    if (id == 0) {
+        return;
+    }
+
+    // glUniform* writes to the pipeline's active program
+    for (std::size_t index : {vert, frag}) {
+        Shader& shader = stages[index].shader;
+        glActiveShaderProgram(id, shader.id);
+        shader.flush();
+    }
+}
+
+std::size_t shaders::PipelineCache::size() const {
+    return stages.size();
+}
+
+const shaders::PipelineStats& shaders::PipelineCache::stats() const {
+    return counters;
+}
@@ -0,0 +1,268 @@
+#include "Preprocessor.hpp"
+#include "Hash.hpp"
+#include "Sources.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <iostream>
+
+namespace {
+    std::string_view trim_left(std::string_view line) {
+        while (!line.empty() && (line.front() == ' ' || line.front() == '\t')) {
+            line.remove_prefix(1);
+        }
+        return line;
+    }
+
+    /**
+     * @brief Match a directive such as "#include", allowing whitespace
+     * after the '#'
+     *
+     * @return the rest of the line after the directive name, or nothing
+     */
+    bool directive(std::string_view line, std::string_view name, std::string_view& rest) {
+        line = trim_left(line);
+        if (line.empty() || line.front() != '#') {
+            return false;
+        }
+        line = trim_left(line.substr(1));
+        if (!line.starts_with(name)) {
+            return false;
+        }
+        rest = line.substr(name.size());
+        return rest.empty() || rest.front() == ' ' || rest.front() == '\t';
+    }
+
+    std::string line_directive(int line, std::size_t file) {
+        return "#line " + std::to_string(line) + " " + std::to_string(file) + "\n";
+    }
+} // namespace
+
+std::uint64_t shaders::Variant::key() const {
+    auto sorted = defines;
+    std::sort(sorted.begin(), sorted.end());
+
+    std::uint64_t h = hash::FNV1A_64_OFFSET;
+    for (const auto& [name, value] : sorted) {
+        h = hash::fnv1a_64(name, h);
+        h = hash::fnv1a_64("=", h);
+        h = hash::fnv1a_64(value, h);
+        h = hash::fnv1a_64(";", h);
+    }
+    return h;
+}
+
+std::vector<shaders::Variant> shaders::permutations(
+    const std::vector<std::string>& features
+) {
+    std::vector<Variant> out(std::size_t(1) << features.size());
+    for (std::size_t mask = 0; mask < out.size(); mask++) {
+        for (std::size_t bit = 0; bit < features.size(); bit++) {
+            if (mask & (std::size_t(1) << bit)) {
+                out[mask].defines.emplace_back(features[bit], "1");
+            }
+        }
+    }
+    return out;
+}
+
+std::string shaders::remap_log(
+    std::string_view log, const std::vector<std::string>& files
+) {
+    std::string out;
+    out.reserve(log.size());
+
+    while (!log.empty()) {
+        std::size_t end = log.find('\n');
+        std::string_view line = log.substr(0, end);
+        log.remove_prefix(end == std::string_view::npos ? log.size() : end + 1);
+
+        // "0:12(3): error" from Mesa, "0(12) : error" from NVIDIA
+        std::size_t digits = 0;
+        while (digits < line.size() && std::isdigit((unsigned char)line[digits])) {
+            digits++;
+        }
+        if (digits > 0 && digits < line.size()
+            && (line[digits] == ':' || line[digits] == '(')) {
+            std::size_t index = std::stoul(std::string(line.substr(0, digits)));
+            if (index < files.size()) {
+                out += files[index];
+                line.remove_prefix(digits);
+            }
+        }
+
+        out += line;
+        if (end != std::string_view::npos) {
+            out += '\n';
+        }
+    }
+    return out;
+}
+
+shaders::Preprocessor::Preprocessor(std::filesystem::path root)
+    : include_root(std::move(root)) {
+}
+
+const shaders::PreprocessedSource& shaders::Preprocessor::process(
+    const std::string& path, const Variant& variant
+) {
+    std::uint64_t key = hash::fnv1a_64(path, variant.key());
+    auto cached = variants.find(key);
+    if (cached != variants.end()) {
+        return cached->second;
+    }
+
+    const Expanded& e = expand(path);
+
+    auto defines = variant.defines;
+    std::sort(defines.begin(), defines.end());
+
+    PreprocessedSource out;
+    out.files = e.files;
+    if (!e.version.empty()) {
+        out.code += e.version;
+        out.code += '\n';
+    }
+    for (const auto& [name, value] : defines) {
+        out.code += "#define " + name + " " + value + "\n";
+    }
+    out.code += e.body;
+
+    return variants.emplace(key, std::move(out)).first->second;
+}
+
+std::vector<const shaders::PreprocessedSource*> shaders::Preprocessor::process_all(
+    const std::string& path, const std::vector<Variant>& variants
+) {
+    std::vector<const PreprocessedSource*> out;
+    out.reserve(variants.size());
+    for (const Variant& variant : variants) {
+        out.push_back(&process(path, variant));
+    }
+    return out;
+}
+
+const std::filesystem::path& shaders::Preprocessor::root() const {
+    return include_root;
+}
+
+void shaders::Preprocessor::clear() {
+    expanded.clear();
+    variants.clear();
+}
+
+const shaders::Preprocessor::Expanded& shaders::Preprocessor::expand(
+    const std::string& path
+) {
+    auto cached = expanded.find(path);
+    if (cached != expanded.end()) {
+        return cached->second;
+    }
+
+    Expanded out;
+    std::vector<std::filesystem::path> stack;
+    std::vector<std::filesystem::path> once;
+    expand_file(path, out, stack, once);
+
+    return expanded.emplace(path, std::move(out)).first->second;
+}
+
+bool shaders::Preprocessor::expand_file(
+    const std::filesystem::path& path, Expanded& out,
+    std::vector<std::filesystem::path>& stack,
+    std::vector<std::filesystem::path>& once
+) {
+    std::filesystem::path normal = path.lexically_normal();
+    if (std::find(stack.begin(), stack.end(), normal) != stack.end()) {
+        std::cerr << "ERROR::PREPROCESSOR::RECURSIVE_INCLUDE " << path << std::endl;
+        return false;
+    }
+
+    SourceText source(path.c_str());
+    if (!source.is_open()) {
+        return false;
+    }
+
+    auto file = std::find(out.files.begin(), out.files.end(), path.string());
+    std::size_t index = file - out.files.begin();
+    if (file == out.files.end()) {
+        out.files.push_back(path.string());
+    }
+
+    bool is_root = stack.empty();
+    stack.push_back(normal);
+
+    out.body += line_directive(1, index);
+
+    std::string_view text = source.view();
+    int line_no = 0;
+    while (!text.empty()) {
+        std::size_t end = text.find('\n');
+        std::string_view line = text.substr(0, end);
+        text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+        line_no++;
+
+        std::string_view rest;
+        if (is_root && out.version.empty() && directive(line, "version", rest)) {
+            // has to stay first, the defines go after it
+            out.version = std::string(line);
+            out.body += line_directive(line_no + 1, index);
+            continue;
+        }
+
+        if (directive(line, "pragma", rest)
+            && trim_left(rest).starts_with("once")) {
+            once.push_back(normal);
+            continue;
+        }
+
+        if (directive(line, "include", rest)) {
+            rest = trim_left(rest);
+            std::size_t close = std::string_view::npos;
+            if (!rest.empty() && rest.front() == '"') {
+                close = rest.find('"', 1);
+            } else if (!rest.empty() && rest.front() == '<') {
+                close = rest.find('>', 1);
+            }
+            if (close == std::string_view::npos) {
+                std::cerr << "ERROR::PREPROCESSOR::MALFORMED_INCLUDE "
+                    << path.string() << ":" << line_no << std::endl;
+                continue;
+            }
+
+            std::filesystem::path target =
+                resolve(path, std::string(rest.substr(1, close - 1)));
+            if (std::find(once.begin(), once.end(), target.lexically_normal())
+                == once.end()) {
+                if (!expand_file(target, out, stack, once)) {
+                    std::cerr << "ERROR::PREPROCESSOR::INCLUDE_FAILED "
+                        << path.string() << ":" << line_no << " "
+                        << target.string() << std::endl;
+                }
+            }
+            out.body += line_directive(line_no + 1, index);
+            continue;
+        }
+
+        out.body += line;
+        out.body += '\n';
+    }
+
+    stack.pop_back();
+    return true;
+}
+
+std::filesystem::path shaders::Preprocessor::resolve(
+    const std::filesystem::path& from, const std::string& name
+) const {
+    // looked up the way SourceText reads it, so an embedded include is found
+    // wherever the working directory is
+    std::filesystem::path local = (from.parent_path() / name).lexically_normal();
+    if (!disk_sources() && embedded_source(local.generic_string())) {
+        return local;
+    }
+    if (std::filesystem::exists(local)) {
+        return local;
+    }
+    return (include_root / name).lexically_normal();
+}
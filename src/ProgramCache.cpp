@@ -0,0 +1,193 @@
+#include "ProgramCache.hpp"
+#include "Hash.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace {
+    constexpr std::uint32_t CACHE_MAGIC = 0x4c474f4c; // "LOGL"
+    constexpr std::uint32_t CACHE_VERSION = 1;
+
+    struct EntryHeader {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint64_t key;
+        std::uint32_t format;
+        std::uint32_t length;
+        std::int64_t build_ns;
+    };
+
+    std::string_view gl_string(GLenum name) {
+        const GLubyte* str = glGetString(name);
+        return str ? reinterpret_cast<const char*>(str) : "";
+    }
+} // namespace
+
+shaders::ProgramCache::ProgramCache(std::filesystem::path dir)
+    : dir(std::move(dir)), driver_hash(hash::FNV1A_64_OFFSET),
+      binary_supported(false) {
+    driver_hash = hash::fnv1a_64(gl_string(GL_VENDOR), driver_hash);
+    driver_hash = hash::fnv1a_64(gl_string(GL_RENDERER), driver_hash);
+    driver_hash = hash::fnv1a_64(gl_string(GL_VERSION), driver_hash);
+
+    // glad only loads 4.1 entry points when the context is 4.1 or later
+    if (glGetProgramBinary != NULL && glProgramBinary != NULL
+        && glProgramParameteri != NULL) {
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        binary_supported = formats > 0;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(this->dir, ec);
+    if (ec) {
+        std::cerr << "ERROR::PROGRAM_CACHE::UNABLE_TO_CREATE_DIR "
+            << this->dir << std::endl;
+        binary_supported = false;
+    }
+}
+
+bool shaders::ProgramCache::supported() const {
+    return binary_supported;
+}
+
+std::uint64_t shaders::ProgramCache::key(
+    std::string_view v_code, std::string_view f_code
+) const {
+    std::uint64_t k = hash::fnv1a_64(v_code, driver_hash);
+    // separator so moving text between the stages changes the key
+    k = hash::fnv1a_64(std::string_view("\0", 1), k);
+    return hash::fnv1a_64(f_code, k);
+}
+
+GLuint shaders::ProgramCache::load(std::uint64_t key) {
+    if (!binary_supported) {
+        counters.misses++;
+        return 0;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::filesystem::path path = entry_path(key);
+    std::ifstream file(path, std::ios::binary);
+
+    EntryHeader header{};
+    if (!file.is_open()
+        || !file.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || header.magic != CACHE_MAGIC
+        || header.version != CACHE_VERSION
+        || header.key != key) {
+        counters.misses++;
+        return 0;
+    }
+
+    auto discard = [&]() {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        counters.rejected++;
+        counters.misses++;
+    };
+
+    // entries are written whole, a length that disagrees with the file
+    // means it is corrupt, and must not decide what is allocated
+    std::error_code ec;
+    std::uintmax_t size = std::filesystem::file_size(path, ec);
+    if (ec || size != sizeof(header) + std::uintmax_t(header.length)) {
+        std::cerr << "ERROR::PROGRAM_CACHE::CORRUPT_ENTRY " << path << std::endl;
+        file.close();
+        discard();
+        return 0;
+    }
+
+    std::vector<char> binary(header.length);
+    if (!file.read(binary.data(), binary.size())) {
+        counters.misses++;
+        return 0;
+    }
+    file.close();
+
+    GLuint prgm = glCreateProgram();
+    glProgramBinary(prgm, header.format, binary.data(), header.length);
+
+    GLint success = 0;
+    glGetProgramiv(prgm, GL_LINK_STATUS, &success);
+    if (!success) {
+        // driver changed in a way the version strings did not show
+        glDeleteProgram(prgm);
+        discard();
+        return 0;
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    std::chrono::nanoseconds build_time(header.build_ns);
+
+    counters.hits++;
+    counters.load_time += elapsed;
+    if (build_time > elapsed) {
+        counters.time_saved += build_time - elapsed;
+    }
+    return prgm;
+}
+
+void shaders::ProgramCache::store(
+    std::uint64_t key, GLuint prgm, std::chrono::nanoseconds build_time
+) {
+    if (!binary_supported || prgm == 0) {
+        return;
+    }
+
+    GLint success = 0;
+    glGetProgramiv(prgm, GL_LINK_STATUS, &success);
+    if (!success) {
+        return;
+    }
+
+    GLint length = 0;
+    glGetProgramiv(prgm, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+
+    std::vector<char> binary(length);
+    GLsizei written = 0;
+    GLenum format = 0;
+    glGetProgramBinary(prgm, length, &written, &format, binary.data());
+
+    EntryHeader header{
+        CACHE_MAGIC, CACHE_VERSION, key, format,
+        static_cast<std::uint32_t>(written), build_time.count()
+    };
+
+    // write then rename so a crash never leaves a truncated entry behind
+    std::filesystem::path path = entry_path(key);
+    std::filesystem::path tmp = path;
+    tmp += ".tmp";
+
+    std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(binary.data(), written);
+    file.close();
+
+    std::error_code ec;
+    if (!file) {
+        std::cerr << "ERROR::PROGRAM_CACHE::UNABLE_TO_WRITE " << tmp << std::endl;
+        std::filesystem::remove(tmp, ec);
+        return;
+    }
+
+    std::filesystem::rename(tmp, path, ec);
+    if (!ec) {
+        counters.stored++;
+    }
+}
+
+const shaders::ProgramCacheStats& shaders::ProgramCache::stats() const {
+    return counters;
+}
+
+std::filesystem::path shaders::ProgramCache::entry_path(std::uint64_t key) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+    return dir / name;
+}
@@ -0,0 +1,244 @@
+#include "Reflection.hpp"
+#include "Hash.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    /**
+     * @brief How an attribute type is fed: components per location, the
+     * number of locations (matrix columns) and whether it is an integer
+     *
+     */
+    struct Shape {
+        GLint components;
+        GLint columns;
+        bool integer;
+    };
+
+    bool attribute_shape(GLenum type, Shape& out) {
+        switch (type) {
+            case GL_FLOAT:             out = {1, 1, false}; return true;
+            case GL_FLOAT_VEC2:        out = {2, 1, false}; return true;
+            case GL_FLOAT_VEC3:        out = {3, 1, false}; return true;
+            case GL_FLOAT_VEC4:        out = {4, 1, false}; return true;
+            case GL_INT:               out = {1, 1, true}; return true;
+            case GL_INT_VEC2:          out = {2, 1, true}; return true;
+            case GL_INT_VEC3:          out = {3, 1, true}; return true;
+            case GL_INT_VEC4:          out = {4, 1, true}; return true;
+            case GL_UNSIGNED_INT:      out = {1, 1, true}; return true;
+            case GL_UNSIGNED_INT_VEC2: out = {2, 1, true}; return true;
+            case GL_UNSIGNED_INT_VEC3: out = {3, 1, true}; return true;
+            case GL_UNSIGNED_INT_VEC4: out = {4, 1, true}; return true;
+            // matCxR takes C locations of R components
+            case GL_FLOAT_MAT2:        out = {2, 2, false}; return true;
+            case GL_FLOAT_MAT3:        out = {3, 3, false}; return true;
+            case GL_FLOAT_MAT4:        out = {4, 4, false}; return true;
+            case GL_FLOAT_MAT2x3:      out = {3, 2, false}; return true;
+            case GL_FLOAT_MAT2x4:      out = {4, 2, false}; return true;
+            case GL_FLOAT_MAT3x2:      out = {2, 3, false}; return true;
+            case GL_FLOAT_MAT3x4:      out = {4, 3, false}; return true;
+            case GL_FLOAT_MAT4x2:      out = {2, 4, false}; return true;
+            case GL_FLOAT_MAT4x3:      out = {3, 4, false}; return true;
+            default:                   return false;
+        }
+    }
+
+    std::size_t type_size(GLenum type) {
+        switch (type) {
+            case GL_BYTE:
+            case GL_UNSIGNED_BYTE:
+                return 1;
+            case GL_SHORT:
+            case GL_UNSIGNED_SHORT:
+            case GL_HALF_FLOAT:
+                return 2;
+            case GL_DOUBLE:
+                return 8;
+            default:
+                return 4;
+        }
+    }
+
+    bool integer_type(GLenum type) {
+        switch (type) {
+            case GL_BYTE:
+            case GL_UNSIGNED_BYTE:
+            case GL_SHORT:
+            case GL_UNSIGNED_SHORT:
+            case GL_INT:
+            case GL_UNSIGNED_INT:
+                return true;
+            default:
+                return false;
+        }
+    }
+} // namespace
+
+shaders::Reflection shaders::reflect(GLuint prgm) {
+    Reflection out;
+
+    GLint linked = 0;
+    if (prgm != 0) {
+        glGetProgramiv(prgm, GL_LINK_STATUS, &linked);
+    }
+    if (!linked) {
+        return out;
+    }
+
+    GLint count = 0;
+    GLint max_len = 0;
+    std::vector<GLchar> name;
+
+    glGetProgramiv(prgm, GL_ACTIVE_ATTRIBUTES, &count);
+    glGetProgramiv(prgm, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &max_len);
+    name.resize(std::max(max_len, 1));
+    for (GLint i = 0; i < count; i++) {
+        GLsizei len = 0;
+        ActiveVariable var;
+        glGetActiveAttrib(prgm, i, name.size(), &len, &var.size, &var.type, name.data());
+        var.name.assign(name.data(), len);
+        var.location = glGetAttribLocation(prgm, name.data());
+        out.attributes.push_back(std::move(var));
+    }
+
+    glGetProgramiv(prgm, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(prgm, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_len);
+    name.resize(std::max(max_len, 1));
+    for (GLint i = 0; i < count; i++) {
+        GLsizei len = 0;
+        ActiveVariable var;
+        glGetActiveUniform(prgm, i, name.size(), &len, &var.size, &var.type, name.data());
+        var.name.assign(name.data(), len);
+        var.location = glGetUniformLocation(prgm, name.data());
+        out.uniforms.push_back(std::move(var));
+    }
+
+    glGetProgramiv(prgm, GL_ACTIVE_UNIFORM_BLOCKS, &count);
+    glGetProgramiv(prgm, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &max_len);
+    name.resize(std::max(max_len, 1));
+    for (GLint i = 0; i < count; i++) {
+        GLsizei len = 0;
+        GLint binding = 0;
+        ActiveBlock block;
+        block.index = i;
+        glGetActiveUniformBlockName(prgm, i, name.size(), &len, name.data());
+        block.name.assign(name.data(), len);
+        glGetActiveUniformBlockiv(prgm, i, GL_UNIFORM_BLOCK_BINDING, &binding);
+        glGetActiveUniformBlockiv(prgm, i, GL_UNIFORM_BLOCK_DATA_SIZE, &block.data_size);
+        block.binding = binding;
+        out.blocks.push_back(std::move(block));
+    }
+
+    return out;
+}
+
+std::uint64_t shaders::VertexFormat::key() const {
+    std::uint64_t h = hash::fnv1a_64(std::to_string(stride));
+    for (const VertexAttribute& attr : attributes) {
+        h = hash::fnv1a_64(attr.name, h);
+        h = hash::fnv1a_64(
+            ":" + std::to_string(attr.components) + ":" + std::to_string(attr.type)
+                + ":" + std::to_string(attr.normalized) + ":" + std::to_string(attr.offset)
+                + ";",
+            h
+        );
+    }
+    return h;
+}
+
+void shaders::VertexLayout::apply() const {
+    for (const VertexBinding& b : bindings) {
+        if (b.integer) {
+            glVertexAttribIPointer(
+                b.location, b.components, b.type, b.stride, (void*)b.offset
+            );
+        } else {
+            glVertexAttribPointer(
+                b.location, b.components, b.type, b.normalized ? GL_TRUE : GL_FALSE,
+                b.stride, (void*)b.offset
+            );
+        }
+        glEnableVertexAttribArray(b.location);
+    }
+}
+
+shaders::VertexLayout shaders::match_vertex_format(
+    const Reflection& reflection, const VertexFormat& format
+) {
+    VertexLayout out;
+    out.valid = true;
+
+    for (const ActiveVariable& attr : reflection.attributes) {
+        // built-ins such as gl_VertexID are not fed from buffers
+        if (attr.location < 0 || attr.name.starts_with("gl_")) {
+            continue;
+        }
+
+        auto it = std::find_if(format.attributes.begin(), format.attributes.end(),
+            [&](const VertexAttribute& a) {
+                return a.name == attr.name;
+            }
+        );
+        if (it == format.attributes.end()) {
+            std::cerr << "ERROR::SHADER::VERTEX_FORMAT::MISSING_ATTRIBUTE "
+                << attr.name << std::endl;
+            out.valid = false;
+            continue;
+        }
+
+        Shape shape;
+        if (!attribute_shape(attr.type, shape)) {
+            std::cerr << "ERROR::SHADER::VERTEX_FORMAT::UNSUPPORTED_TYPE "
+                << attr.name << std::endl;
+            out.valid = false;
+            continue;
+        }
+
+        // a vec4 may be fed fewer components, the rest default to (0, 0, 1)
+        GLint expected = shape.components * shape.columns;
+        bool components_ok = it->components == expected
+            || (shape.columns == 1 && shape.components == 4
+                && it->components > 0 && it->components < 4);
+        if (!components_ok) {
+            std::cerr << "ERROR::SHADER::VERTEX_FORMAT::COMPONENT_MISMATCH "
+                << attr.name << " reads " << expected << " components, the format has "
+                << it->components << std::endl;
+            out.valid = false;
+            continue;
+        }
+
+        if (shape.integer && (!integer_type(it->type) || it->normalized)) {
+            std::cerr << "ERROR::SHADER::VERTEX_FORMAT::TYPE_MISMATCH "
+                << attr.name << " is an integer attribute" << std::endl;
+            out.valid = false;
+            continue;
+        }
+
+        std::size_t column_size = shape.columns == 1
+            ? it->components * type_size(it->type)
+            : shape.components * type_size(it->type);
+        if (format.stride > 0
+            && it->offset + column_size * shape.columns > format.stride) {
+            std::cerr << "ERROR::SHADER::VERTEX_FORMAT::OUTSIDE_STRIDE "
+                << attr.name << std::endl;
+            out.valid = false;
+            continue;
+        }
+
+        GLint per_location = shape.columns == 1 ? it->components : shape.components;
+        for (GLint col = 0; col < shape.columns; col++) {
+            out.bindings.push_back({
+                GLuint(attr.location + col), per_location, it->type, it->normalized,
+                shape.integer, GLsizei(format.stride), it->offset + col * column_size
+            });
+        }
+    }
+
+    std::sort(out.bindings.begin(), out.bindings.end(),
+        [](const VertexBinding& a, const VertexBinding& b) {
+            return a.location < b.location;
+        }
+    );
+    return out;
+}
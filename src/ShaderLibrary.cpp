@@ -0,0 +1,197 @@
+#include "ShaderLibrary.hpp"
+#include "CompileRecords.hpp"
+#include "Extensions.hpp"
+#include "Sources.hpp"
+
+#include <iostream>
+
+// GL_KHR_parallel_shader_compile, not in the core-only glad build
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    GLuint start_compile(GLenum type, std::string_view code) {
+        const GLchar* code_ptr = code.data();
+        const GLint code_len = code.length();
+
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &code_ptr, &code_len);
+        glCompileShader(shader);
+        return shader;
+    }
+
+    void check_compile(
+        GLuint shader, const char* stage, const std::string& label,
+        shaders::StageRecord& record
+    ) {
+        int success;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        record.compiled = success;
+        record.log = shaders::shader_info_log(shader);
+        if(!success) {
+            std::cout << "ERROR::SHADER::" << stage << "::COMPILATION_FAILED "
+                << label << "\n" << record.log << std::endl;
+        }
+    }
+} // namespace
+
+shaders::ShaderLibrary::ShaderLibrary()
+    : parallel_compile(gl::has_extension("GL_KHR_parallel_shader_compile")) {
+}
+
+shaders::ShaderLibrary::~ShaderLibrary() {
+    // programs belong to the caller once created, stages are ours, and so
+    // are programs submitted but never fetched
+    for (Entry& entry : entries) {
+        if (!entry.shader) {
+            glDeleteShader(entry.vert);
+            glDeleteShader(entry.frag);
+            if (entry.prgm != 0) {
+                glDeleteProgram(entry.prgm);
+            }
+        }
+    }
+}
+
+std::size_t shaders::ShaderLibrary::add(const char* v_path, const char* f_path) {
+    auto start = Clock::now();
+    SourceText v_src(v_path);
+    SourceText f_src(f_path);
+    auto read = Clock::now() - start;
+    times.submit += read;
+
+    std::size_t index =
+        add_source(v_src.view(), f_src.view(), std::string(v_path) + " " + f_path);
+    compile_record(entries[index].record).read = read;
+    return index;
+}
+
+std::size_t shaders::ShaderLibrary::add_source(
+    std::string_view v_code, std::string_view f_code, std::string label
+) {
+    auto start = Clock::now();
+    if (entries.empty()) {
+        first_add = start;
+    }
+
+    Entry& entry = entries.emplace_back();
+    entry.record = add_compile_record(label);
+    entry.label = std::move(label);
+    ProgramRecord& r = compile_record(entry.record);
+
+    r.vertex.type = GL_VERTEX_SHADER;
+    entry.vert = start_compile(GL_VERTEX_SHADER, v_code);
+    auto vert_done = Clock::now();
+    r.vertex.compile = vert_done - start;
+
+    r.fragment.type = GL_FRAGMENT_SHADER;
+    entry.frag = start_compile(GL_FRAGMENT_SHADER, f_code);
+    auto frag_done = Clock::now();
+    r.fragment.compile = frag_done - vert_done;
+
+    times.programs++;
+    times.submit += frag_done - start;
+    return entries.size() - 1;
+}
+
+void shaders::ShaderLibrary::submit() {
+    auto start = Clock::now();
+    for (Entry& entry : entries) {
+        if (entry.prgm == 0) {
+            link(entry);
+        }
+    }
+    times.submit += Clock::now() - start;
+}
+
+bool shaders::ShaderLibrary::ready(std::size_t index) const {
+    const Entry& entry = entries.at(index);
+    if (entry.shader) {
+        return true;
+    }
+    if (entry.prgm == 0) {
+        return false;
+    }
+    if (!parallel_compile) {
+        return true;
+    }
+
+    GLint done = GL_FALSE;
+    glGetProgramiv(entry.prgm, GL_COMPLETION_STATUS_KHR, &done);
+    return done == GL_TRUE;
+}
+
+shaders::Shader& shaders::ShaderLibrary::get(std::size_t index) {
+    Entry& entry = entries.at(index);
+    if (!entry.shader) {
+        if (entry.prgm == 0) {
+            submit();
+        }
+        check(entry);
+    }
+    return *entry.shader;
+}
+
+void shaders::ShaderLibrary::finish() {
+    submit();
+    for (Entry& entry : entries) {
+        if (!entry.shader) {
+            check(entry);
+        }
+    }
+}
+
+std::size_t shaders::ShaderLibrary::size() const {
+    return entries.size();
+}
+
+bool shaders::ShaderLibrary::parallel() const {
+    return parallel_compile;
+}
+
+const shaders::LibraryTimings& shaders::ShaderLibrary::timings() const {
+    return times;
+}
+
+void shaders::ShaderLibrary::link(Entry& entry) {
+    auto start = Clock::now();
+    entry.prgm = glCreateProgram();
+    glAttachShader(entry.prgm, entry.vert);
+    glAttachShader(entry.prgm, entry.frag);
+    glLinkProgram(entry.prgm);
+    compile_record(entry.record).link += Clock::now() - start;
+}
+
+void shaders::ShaderLibrary::check(Entry& entry) {
+    auto start = Clock::now();
+
+    ProgramRecord& r = compile_record(entry.record);
+    int success;
+    glGetProgramiv(entry.prgm, GL_LINK_STATUS, &success);
+    r.link += Clock::now() - start;
+
+    // the stages are done once the link is
+    check_compile(entry.vert, "VERTEX", entry.label, r.vertex);
+    check_compile(entry.frag, "FRAGMENT", entry.label, r.fragment);
+    r.program = entry.prgm;
+    r.linked = success;
+    r.link_log = program_info_log(entry.prgm);
+    if(!success) {
+        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED "
+            << entry.label << "\n" << r.link_log << std::endl;
+    }
+
+    glDetachShader(entry.prgm, entry.vert);
+    glDetachShader(entry.prgm, entry.frag);
+    glDeleteShader(entry.vert);
+    glDeleteShader(entry.frag);
+
+    entry.shader.emplace(entry.prgm, entry.record);
+
+    auto end = Clock::now();
+    times.wait += end - start;
+    times.wall = end - first_add;
+}
@@ -0,0 +1,218 @@
+#include "ShaderWatcher.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <iostream>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace {
+    // editors save in several steps, wait this long after the last event
+    constexpr int SETTLE_MS = 50;
+
+    std::filesystem::path normalize(const std::string& path) {
+        return std::filesystem::absolute(path).lexically_normal();
+    }
+} // namespace
+
+shaders::ShaderWatcher::ShaderWatcher()
+    : inotify_fd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC)),
+      wake_fd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+      changed(false) {
+    if (inotify_fd < 0 || wake_fd < 0) {
+        std::cerr << "ERROR::SHADER_WATCHER::UNABLE_TO_START" << std::endl;
+        return;
+    }
+    worker = std::thread(&ShaderWatcher::run, this);
+}
+
+shaders::ShaderWatcher::~ShaderWatcher() {
+    if (worker.joinable()) {
+        std::uint64_t one = 1;
+        (void)!write(wake_fd, &one, sizeof(one));
+        worker.join();
+    }
+    if (inotify_fd >= 0) {
+        close(inotify_fd);
+    }
+    if (wake_fd >= 0) {
+        close(wake_fd);
+    }
+}
+
+void shaders::ShaderWatcher::watch(Shader& shader) {
+    if (shader.sources().v_path.empty() || shader.sources().f_path.empty()) {
+        std::cerr << "ERROR::SHADER_WATCHER::SHADER_HAS_NO_SOURCE_FILES "
+            << shader.id << std::endl;
+        return;
+    }
+
+    Watched entry{&shader, shader.sources(), {}};
+
+    std::lock_guard<std::mutex> lock(mutex);
+    watch_files(entry);
+    watched.push_back(std::move(entry));
+}
+
+void shaders::ShaderWatcher::unwatch(Shader& shader) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::erase_if(watched, [&](const Watched& w) { return w.shader == &shader; });
+    std::erase_if(pending, [&](const Pending& p) { return p.shader == &shader; });
+}
+
+std::size_t shaders::ShaderWatcher::poll() {
+    if (!changed.load(std::memory_order_acquire)) {
+        return 0;
+    }
+
+    std::vector<Pending> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ready.swap(pending);
+        changed.store(false, std::memory_order_relaxed);
+    }
+
+    std::size_t swapped = 0;
+    for (Pending& p : ready) {
+        const SourceInfo& info = p.shader->sources();
+        if (!p.shader->reload(p.v, p.f)) {
+            std::cerr << "ERROR::SHADER_WATCHER::RELOAD_FAILED keeping previous program "
+                << info.v_path << " " << info.f_path << std::endl;
+            continue;
+        }
+
+        std::cout << "Reloaded " << info.v_path << " " << info.f_path << std::endl;
+        swapped++;
+
+        // the set of included files may have changed
+        std::lock_guard<std::mutex> lock(mutex);
+        for (Watched& w : watched) {
+            if (w.shader == p.shader) {
+                w.info = info;
+                watch_files(w);
+            }
+        }
+    }
+    return swapped;
+}
+
+void shaders::ShaderWatcher::watch_files(Watched& entry) {
+    entry.files.clear();
+    for (const std::string& file : entry.info.files) {
+        entry.files.push_back(normalize(file));
+        watch_dir(entry.files.back().parent_path());
+    }
+}
+
+void shaders::ShaderWatcher::watch_dir(const std::filesystem::path& dir) {
+    for (const auto& [wd, watched_dir] : dirs) {
+        if (watched_dir == dir) {
+            return;
+        }
+    }
+
+    int wd = inotify_add_watch(
+        inotify_fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE
+    );
+    if (wd < 0) {
+        std::cerr << "ERROR::SHADER_WATCHER::UNABLE_TO_WATCH " << dir << std::endl;
+        return;
+    }
+    dirs[wd] = dir;
+}
+
+void shaders::ShaderWatcher::run() {
+    alignas(inotify_event) char buf[4096];
+    pollfd fds[2] = {{inotify_fd, POLLIN, 0}, {wake_fd, POLLIN, 0}};
+    std::vector<std::filesystem::path> paths;
+    int timeout = -1;
+
+    while (true) {
+        int ready = ::poll(fds, 2, timeout);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        if (fds[1].revents & POLLIN) {
+            break;
+        }
+
+        if (ready == 0) {
+            reload(paths);
+            paths.clear();
+            timeout = -1;
+            continue;
+        }
+
+        ssize_t len = read(inotify_fd, buf, sizeof(buf));
+        if (len <= 0) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (char* p = buf; p < buf + len;) {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(p);
+                auto dir = dirs.find(event->wd);
+                if (event->len > 0 && dir != dirs.end()) {
+                    paths.push_back(dir->second / event->name);
+                }
+                p += sizeof(inotify_event) + event->len;
+            }
+        }
+        timeout = SETTLE_MS;
+    }
+}
+
+void shaders::ShaderWatcher::reload(const std::vector<std::filesystem::path>& paths) {
+    std::vector<Watched> affected;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const Watched& w : watched) {
+            bool hit = std::any_of(paths.begin(), paths.end(),
+                [&](const std::filesystem::path& p) {
+                    return std::find(w.files.begin(), w.files.end(), p) != w.files.end();
+                }
+            );
+            if (hit) {
+                affected.push_back(w);
+            }
+        }
+    }
+
+    for (const Watched& w : affected) {
+        // read off the render thread, the GL work waits for poll()
+        Pending next{w.shader, {}, {}};
+        if (w.info.preprocessed) {
+            Preprocessor preprocessor(w.info.include_root);
+            next.v = preprocessor.process(w.info.v_path, w.info.variant);
+            next.f = preprocessor.process(w.info.f_path, w.info.variant);
+        } else {
+            next.v.code = read_shader_file(w.info.v_path.c_str());
+            next.v.files = {w.info.v_path};
+            next.f.code = read_shader_file(w.info.f_path.c_str());
+            next.f.files = {w.info.f_path};
+        }
+        if (next.v.code.empty() || next.f.code.empty()) {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        bool still_watched = std::any_of(watched.begin(), watched.end(),
+            [&](const Watched& cur) { return cur.shader == w.shader; }
+        );
+        if (!still_watched) {
+            continue;
+        }
+
+        std::erase_if(pending, [&](const Pending& p) { return p.shader == w.shader; });
+        pending.push_back(std::move(next));
+        changed.store(true, std::memory_order_release);
+    }
+}
@@ -1,8 +1,13 @@
 #include "Shaders.hpp"
+#include "ProgramCache.hpp"
+#include "Sources.hpp"
+#include "UniformBuffers.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <chrono>
 #include <fstream>
 #include <iostream>
-#include <sstream>
 
 /**
  * @brief Read a shader file
@@ -11,123 +16,771 @@
  * @return the shader program as a string
  */
 std::string shaders::read_shader_file(const char* path) {
-    std::ifstream f_stream(path);
+    std::ifstream f_stream(path, std::ios::binary);
 
     if (!f_stream.is_open()) {
         std::cerr << "File not found at " << path << "." << std::endl;
         return "";
     }
 
-    std::string str(
-        (std::istreambuf_iterator<char>(f_stream)),
-        (std::istreambuf_iterator<char>())
-    );
-    // buffer << f_stream.rdbuf();
+    // one sized read instead of a character at a time
+    f_stream.seekg(0, std::ios::end);
+    std::streamoff size = f_stream.tellg();
+    f_stream.seekg(0, std::ios::beg);
+
+    std::string str(size > 0 ? size : 0, '\0');
+    f_stream.read(str.data(), str.size());
 
     f_stream.close();
     return str;
 }
 
-void shaders::shader_source(GLuint shader, const std::string& shader_string) {
-    const GLchar *shader_source = shader_string.c_str();
+void shaders::shader_source(GLuint shader, std::string_view shader_string) {
+    const GLchar *shader_source = shader_string.data();
     const GLint shader_length = shader_string.length();
 
     glShaderSource(shader, 1, &shader_source, &shader_length);
 }
 
 void shaders::load_shader(GLuint shader_obj, const char *path) {
-    shader_source(shader_obj, read_shader_file(path));
+    SourceText source(path);
+    shader_source(shader_obj, source.view());
 }
 
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Compile one stage, recording the time and the full info log
+     * 
+     * @param files the files the source was preprocessed from, to remap
+     * the log to
+     * @return the shader object
+     */
+    GLuint compile_stage(
+        GLenum type, std::string_view code, shaders::StageRecord& record,
+        const std::vector<std::string>* files
+    ) {
+        const char* code_ptr = code.data();
+        const GLint code_len = code.length();
+
+        auto start = Clock::now();
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &code_ptr, &code_len);
+        glCompileShader(shader);
+
+        int success;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        record.type = type;
+        record.compile = Clock::now() - start;
+        record.compiled = success;
+        record.log = shaders::shader_info_log(shader);
+        if (files) {
+            record.log = shaders::remap_log(record.log, *files);
+        }
+
+        if(!success) {
+            std::cout << "ERROR::SHADER::"
+                << (type == GL_VERTEX_SHADER ? "VERTEX" : "FRAGMENT")
+                << "::COMPILATION_FAILED\n" << record.log << std::endl;
+        }
+        return shader;
+    }
+
+    /**
+     * @brief Compile both stages and link them into a program
+     * 
+     * @param retrievable request that the driver keeps the program binary
+     * @param record where the timings and logs go
+     * @return the program object
+     */
+    GLuint link_program(
+        std::string_view v_code, std::string_view f_code, bool retrievable,
+        shaders::ProgramRecord& record,
+        const std::vector<std::string>* v_files = nullptr,
+        const std::vector<std::string>* f_files = nullptr
+    ) {
+        GLuint vert = compile_stage(GL_VERTEX_SHADER, v_code, record.vertex, v_files);
+        GLuint frag = compile_stage(GL_FRAGMENT_SHADER, f_code, record.fragment, f_files);
+
+        // prgm
+        auto start = Clock::now();
+        unsigned int prgm = glCreateProgram();
+        if (retrievable) {
+            glProgramParameteri(prgm, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
+        glAttachShader(prgm, vert);
+        glAttachShader(prgm, frag);
+        glLinkProgram(prgm);
+
+        int success;
+        glGetProgramiv(prgm, GL_LINK_STATUS, &success);
+        record.link = Clock::now() - start;
+        record.linked = success;
+        record.link_log = shaders::program_info_log(prgm);
+        record.program = prgm;
+        if(!success) {
+            std::cout << "ERROR::SHADER::VERTEX::LINKING_FAILED\n"
+                << record.link_log << std::endl;
+        }
+
+        // Delete shaders
+        glDetachShader(prgm, vert);
+        glDetachShader(prgm, frag);
+        glDeleteShader(vert);
+        glDeleteShader(frag);
+
+        return prgm;
+    }
+
+    GLuint link_sources(
+        const shaders::ProgramSources& sources, bool retrievable,
+        shaders::ProgramRecord& record
+    ) {
+        const shaders::PreprocessedSource& v = sources.vert;
+        const shaders::PreprocessedSource& f = sources.frag;
+        return link_program(
+            v.code, f.code, retrievable, record,
+            v.files.empty() ? nullptr : &v.files,
+            f.files.empty() ? nullptr : &f.files
+        );
+    }
+
+    /**
+     * @brief Read a uniform's value back from a freshly linked program,
+     * which may not be zero if the shader declares an initializer
+     * 
+     * @return false for types that do not fit a shadow slot, e.g. mat2x3
+     */
+    bool read_uniform(
+        GLuint prgm, GLint loc, GLenum type, std::array<std::uint32_t, 16>& out
+    ) {
+        switch (type) {
+            case GL_FLOAT:
+            case GL_FLOAT_VEC2:
+            case GL_FLOAT_VEC3:
+            case GL_FLOAT_VEC4:
+            case GL_FLOAT_MAT3:
+            case GL_FLOAT_MAT4: {
+                GLfloat v[16] = {};
+                glGetUniformfv(prgm, loc, v);
+                for (int i = 0; i < 16; i++) {
+                    out[i] = std::bit_cast<std::uint32_t>(v[i]);
+                }
+                return true;
+            }
+            case GL_INT:
+            case GL_INT_VEC2:
+            case GL_INT_VEC3:
+            case GL_INT_VEC4:
+            case GL_BOOL:
+            case GL_BOOL_VEC2:
+            case GL_BOOL_VEC3:
+            case GL_BOOL_VEC4: {
+                GLint v[16] = {};
+                glGetUniformiv(prgm, loc, v);
+                for (int i = 0; i < 16; i++) {
+                    out[i] = std::bit_cast<std::uint32_t>(v[i]);
+                }
+                return true;
+            }
+            case GL_UNSIGNED_INT: {
+                GLuint v[16] = {};
+                glGetUniformuiv(prgm, loc, v);
+                std::copy(std::begin(v), std::end(v), out.begin());
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+} // namespace
+
 shaders::Shader::Shader(const char* v_path, const char* f_path) {
-    std::string v_code;
-    std::string f_code;
-    std::ifstream v_file;
-    std::ifstream f_file;
+    info.v_path = v_path;
+    info.f_path = f_path;
+    info.files = {v_path, f_path};
+    ProgramRecord& r = start_record();
 
-    v_file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-    f_file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+    auto start = Clock::now();
+    SourceText v_src(v_path);
+    SourceText f_src(f_path);
+    r.read = Clock::now() - start;
+    if (!v_src.is_open() || !f_src.is_open()) {
+        std::cerr << "ERROR::SHADER::UNABLE_TO_READ_FILE" << std::endl;
+    }
 
-    try {
-        std::stringstream v_stream, f_stream;
+    id = link_program(v_src.view(), f_src.view(), false, r);
+    reflect_program();
+}
 
-        v_file.open(v_path);
-        f_file.open(f_path);
+shaders::Shader::Shader(
+    const char* v_path, const char* f_path, ProgramCache& cache
+) {
+    info.v_path = v_path;
+    info.f_path = f_path;
+    info.files = {v_path, f_path};
+    ProgramRecord& r = start_record();
 
-        v_stream << v_file.rdbuf();
-        f_stream << f_file.rdbuf();
-        
-        v_file.close();
-        f_file.close();
+    auto start = Clock::now();
+    SourceText v_src(v_path);
+    SourceText f_src(f_path);
+    r.read = Clock::now() - start;
+    if (!v_src.is_open() || !f_src.is_open()) {
+        std::cerr << "ERROR::SHADER::UNABLE_TO_READ_FILE" << std::endl;
+    }
+
+    start = Clock::now();
+    std::uint64_t key = cache.key(v_src.view(), f_src.view());
+    id = cache.load(key);
+
+    if (id != 0) {
+        r.link = Clock::now() - start;
+        r.linked = true;
+        r.cached = true;
+        r.program = id;
+    } else {
+        start = Clock::now();
+        id = link_program(v_src.view(), f_src.view(), cache.supported(), r);
+        cache.store(key, id, Clock::now() - start);
+    }
+
+    reflect_program();
+}
+
+shaders::Shader::Shader(
+    const char* v_path, const char* f_path,
+    Preprocessor& preprocessor, const Variant& variant
+) {
+    info.v_path = v_path;
+    info.f_path = f_path;
+    ProgramRecord& r = start_record();
+
+    // reads the files as well
+    auto start = Clock::now();
+    const PreprocessedSource& v = preprocessor.process(v_path, variant);
+    const PreprocessedSource& f = preprocessor.process(f_path, variant);
+    r.preprocess = Clock::now() - start;
+
+    info.preprocessed = true;
+    info.include_root = preprocessor.root();
+    info.variant = variant;
 
-        v_code = v_stream.str();
-        f_code = f_stream.str();
+    id = link_program(v.code, f.code, false, r, &v.files, &f.files);
+    set_files(v, f);
+    reflect_program();
+}
 
-    } catch (std::ifstream::failure e) {
+shaders::Shader::Shader(const ProgramSources& sources) : info(sources.info) {
+    ProgramRecord& r = start_record();
+    r.read = sources.read;
+    r.preprocess = sources.preprocess;
+    if (!sources.ok) {
         std::cerr << "ERROR::SHADER::UNABLE_TO_READ_FILE" << std::endl;
     }
 
-    const char* v_code_ptr = v_code.c_str();
-    const char* f_code_ptr = f_code.c_str();
+    id = link_sources(sources, false, r);
+    reflect_program();
+}
 
-    unsigned int vert, frag;
-    int success;
-    char info_log[512];
+shaders::Shader::Shader(const ProgramSources& sources, ProgramCache& cache)
+    : info(sources.info) {
+    ProgramRecord& r = start_record();
+    r.read = sources.read;
+    r.preprocess = sources.preprocess;
+    if (!sources.ok) {
+        std::cerr << "ERROR::SHADER::UNABLE_TO_READ_FILE" << std::endl;
+    }
 
-    // vert
-    vert = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vert, 1, &v_code_ptr, NULL);
-    glCompileShader(vert);
-    glGetShaderiv(vert, GL_COMPILE_STATUS, &success);
+    auto start = Clock::now();
+    std::uint64_t key = cache.key(sources.vert.code, sources.frag.code);
+    id = cache.load(key);
 
-    if(!success) {
-        glGetShaderInfoLog(vert, 512, NULL, info_log);
-        std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n"
-            << info_log << std::endl;
+    if (id != 0) {
+        r.link = Clock::now() - start;
+        r.linked = true;
+        r.cached = true;
+        r.program = id;
+    } else {
+        start = Clock::now();
+        id = link_sources(sources, cache.supported(), r);
+        cache.store(key, id, Clock::now() - start);
     }
 
-    // frag
-    frag = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(frag, 1, &f_code_ptr, NULL);
-    glCompileShader(frag);
-    glGetShaderiv(frag, GL_COMPILE_STATUS, &success);
+    reflect_program();
+}
+
+shaders::Shader::Shader(GLuint prgm, std::optional<std::size_t> record)
+    : id(prgm), record(record), first_use(record.has_value()) {
+    reflect_program();
+}
+
+bool shaders::Shader::reload(const std::string& v_code, const std::string& f_code) {
+    std::size_t index = add_compile_record(info.v_path + " " + info.f_path);
+    GLuint prgm = link_program(v_code, f_code, false, shaders::compile_record(index));
+    if (!swap_program(prgm)) {
+        return false;
+    }
+    record = index;
+    first_use = true;
+    return true;
+}
 
-    if(!success) {
-        glGetShaderInfoLog(frag, 512, NULL, info_log);
-        std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n"
-            << info_log << std::endl;
+bool shaders::Shader::reload(const PreprocessedSource& v, const PreprocessedSource& f) {
+    std::size_t index = add_compile_record(info.v_path + " " + info.f_path);
+    GLuint prgm = link_program(
+        v.code, f.code, false, shaders::compile_record(index), &v.files, &f.files
+    );
+    if (!swap_program(prgm)) {
+        return false;
     }
+    record = index;
+    first_use = true;
+    set_files(v, f);
+    return true;
+}
 
-    // prgm
-    unsigned int prgm = glCreateProgram();
-    glAttachShader(prgm, vert);
-    glAttachShader(prgm, frag);
-    glLinkProgram(prgm);
+const shaders::SourceInfo& shaders::Shader::sources() const {
+    return info;
+}
+
+const shaders::ProgramRecord* shaders::Shader::build_record() const {
+    return record ? &shaders::compile_record(*record) : nullptr;
+}
 
+shaders::ProgramRecord* shaders::Shader::build_record() {
+    return record ? &shaders::compile_record(*record) : nullptr;
+}
+
+shaders::ProgramRecord& shaders::Shader::start_record() {
+    record = add_compile_record(info.v_path + " " + info.f_path);
+    first_use = true;
+    return shaders::compile_record(*record);
+}
+
+bool shaders::Shader::swap_program(GLuint prgm) {
+    int success;
     glGetProgramiv(prgm, GL_LINK_STATUS, &success);
-    if(!success) {
-        glGetShaderInfoLog(prgm, 512, NULL, info_log);
-        std::cout << "ERROR::SHADER::VERTEX::LINKING_FAILED\n"
-            << info_log << std::endl;
+    if (!success) {
+        glDeleteProgram(prgm);
+        return false;
     }
 
-    // Delete shaders
-    glDeleteShader(vert);
-    glDeleteShader(frag);
+    glDeleteProgram(id);
+    id = prgm;
+    reflect_program();
+    return true;
+}
+
+void shaders::Shader::set_files(const PreprocessedSource& v, const PreprocessedSource& f) {
+    info.files = v.files;
+    for (const std::string& file : f.files) {
+        if (std::find(info.files.begin(), info.files.end(), file) == info.files.end()) {
+            info.files.push_back(file);
+        }
+    }
+}
+
+void shaders::Shader::reflect_program() {
+    reflected = reflect(id);
+    layouts.clear();
+
+    for (ActiveBlock& block : reflected.blocks) {
+        GLuint binding = block_binding(block.name);
+        if (binding == GL_INVALID_INDEX) {
+            std::cerr << "ERROR::SHADER::OUT_OF_UNIFORM_BLOCK_BINDINGS "
+                << block.name << std::endl;
+            continue;
+        }
+        glUniformBlockBinding(id, block.index, binding);
+        block.binding = binding;
+    }
+
+    cache_uniforms();
+}
+
+void shaders::Shader::cache_uniforms() {
+    uniforms.clear();
+    uniform_names.clear();
+    values.clear();
+    location_slots.clear();
+    dirty.clear();
+
+    std::string element;
+
+    auto add_value = [this](GLint loc, GLenum type) {
+        UniformValue value{loc, UniformKind::int1, false, false, {}, {}};
+        value.known = read_uniform(id, loc, type, value.current);
+        values.push_back(value);
+        std::uint32_t slot = values.size() - 1;
+        if (std::size_t(loc) >= location_slots.size()) {
+            location_slots.resize(loc + 1, NO_SLOT);
+        }
+        location_slots[loc] = slot;
+        return slot;
+    };
+
+    auto add_entry = [this](std::string_view name, std::uint32_t slot) {
+        uniform_names.emplace_back(name);
+        std::uint32_t index = uniform_names.size() - 1;
+        uniforms.push_back({hash::fnv1a_32(name), slot, index});
+    };
+
+    for (const ActiveVariable& var : reflected.uniforms) {
+        // members of uniform blocks have no location
+        if (var.location < 0) {
+            continue;
+        }
+
+        std::string_view name = var.name;
+        std::uint32_t slot = add_value(var.location, var.type);
+        add_entry(name, slot);
+
+        // arrays are reported as "name[0]", make "name" and every element
+        // resolvable too
+        if (name.ends_with("[0]")) {
+            name.remove_suffix(3);
+            add_entry(name, slot);
+
+            for (GLint j = 1; j < var.size; j++) {
+                element.assign(name);
+                element += '[' + std::to_string(j) + ']';
+                GLint elem_loc = glGetUniformLocation(id, element.c_str());
+                if (elem_loc >= 0) {
+                    add_entry(element, add_value(elem_loc, var.type));
+                }
+            }
+        }
+    }
+
+    std::sort(uniforms.begin(), uniforms.end(),
+        [](const UniformEntry& a, const UniformEntry& b) {
+            return a.hash < b.hash;
+        }
+    );
+
+    // handles cannot tell these apart, find_slot() drops them
+    auto dup = uniforms.begin();
+    while ((dup = std::adjacent_find(dup, uniforms.end(),
+        [](const UniformEntry& a, const UniformEntry& b) {
+            return a.hash == b.hash;
+        }
+    )) != uniforms.end()) {
+        std::cerr << "ERROR::SHADER::UNIFORM_HASH_COLLISION in program " << id
+            << ": " << uniform_names[dup->name] << ", "
+            << uniform_names[(dup + 1)->name] << std::endl;
+        dup++;
+    }
+}
+
+GLint shaders::Shader::uniform_location(std::string_view name) const {
+    std::uint32_t slot = find_slot(name);
+    return slot != NO_SLOT ? values[slot].location : -1;
+}
+
+GLint shaders::Shader::uniform_location(UniformHandle handle) const {
+    std::uint32_t slot = find_slot(handle);
+    return slot != NO_SLOT ? values[slot].location : -1;
+}
+
+bool shaders::Shader::bind_uniform_block(const char* name, GLuint binding) {
+    auto block = std::find_if(reflected.blocks.begin(), reflected.blocks.end(),
+        [&](const ActiveBlock& b) {
+            return b.name == name;
+        }
+    );
+    if (block == reflected.blocks.end()) {
+        return false;
+    }
+    glUniformBlockBinding(id, block->index, binding);
+    block->binding = binding;
+    return true;
+}
+
+const shaders::Reflection& shaders::Shader::reflection() const {
+    return reflected;
+}
+
+const shaders::VertexLayout& shaders::Shader::vertex_layout(const VertexFormat& format) {
+    std::uint64_t key = format.key();
+    for (const auto& [cached_key, layout] : layouts) {
+        if (cached_key == key) {
+            return layout;
+        }
+    }
+
+    VertexLayout layout = match_vertex_format(reflected, format);
+    if (!layout.valid) {
+        std::cerr << "ERROR::SHADER::VERTEX_FORMAT::MISMATCH program " << id;
+        if (!info.v_path.empty()) {
+            std::cerr << " (" << info.v_path << ")";
+        }
+        std::cerr << std::endl;
+    }
+    return layouts.emplace_back(key, std::move(layout)).second;
 }
 
 void shaders::Shader::use() {
+    if (!first_use) {
+        glUseProgram(id);
+        flush();
+        return;
+    }
+
+    auto start = Clock::now();
     glUseProgram(id);
+    flush();
+    ProgramRecord& r = shaders::compile_record(*record);
+    r.first_use = Clock::now() - start;
+    r.used = true;
+    first_use = false;
+}
+
+void shaders::Shader::flush() {
+    for (std::uint32_t slot : dirty) {
+        UniformValue& v = values[slot];
+        v.queued = false;
+
+        // set back to what the program already had
+        if (v.known && v.pending == v.current) {
+            stats.elided++;
+            continue;
+        }
+
+        const UniformBits& p = v.pending;
+        const std::array<GLint, 16> i = std::bit_cast<std::array<GLint, 16>>(p);
+        const std::array<float, 16> f = std::bit_cast<std::array<float, 16>>(p);
+        switch (v.kind) {
+            case UniformKind::int1:
+                glUniform1i(v.location, i[0]);
+                break;
+            case UniformKind::int2:
+                glUniform2i(v.location, i[0], i[1]);
+                break;
+            case UniformKind::int4:
+                glUniform4i(v.location, i[0], i[1], i[2], i[3]);
+                break;
+            case UniformKind::uint1:
+                glUniform1ui(v.location, p[0]);
+                break;
+            case UniformKind::float1:
+                glUniform1f(v.location, f[0]);
+                break;
+            case UniformKind::float2:
+                glUniform2f(v.location, f[0], f[1]);
+                break;
+            case UniformKind::float3:
+                glUniform3f(v.location, f[0], f[1], f[2]);
+                break;
+            case UniformKind::float4:
+                glUniform4f(v.location, f[0], f[1], f[2], f[3]);
+                break;
+            case UniformKind::mat3:
+                glUniformMatrix3fv(v.location, 1, GL_FALSE, f.data());
+                break;
+            case UniformKind::mat4:
+                glUniformMatrix4fv(v.location, 1, GL_FALSE, f.data());
+                break;
+        }
+        v.current = v.pending;
+        v.known = true;
+        stats.issued++;
+    }
+    dirty.clear();
+}
+
+const shaders::UniformStats& shaders::Shader::uniform_stats() const {
+    return stats;
+}
+
+void shaders::Shader::reset_uniform_stats() {
+    stats = {};
+}
+
+namespace {
+    template <typename Entry>
+    auto hash_range(const std::vector<Entry>& entries, std::uint32_t hash) {
+        return std::equal_range(entries.begin(), entries.end(), Entry{hash, 0, 0},
+            [](const Entry& a, const Entry& b) {
+                return a.hash < b.hash;
+            }
+        );
+    }
+} // namespace
+
+std::uint32_t shaders::Shader::find_slot(UniformHandle handle) const {
+    auto [first, last] = hash_range(uniforms, handle.hash);
+    // none, or a collision only the names can settle
+    if (last - first != 1) {
+        return NO_SLOT;
+    }
+    return first->slot;
+}
+
+std::uint32_t shaders::Shader::find_slot(std::string_view name, std::uint32_t hash) const {
+    auto [first, last] = hash_range(uniforms, hash);
+    for (auto it = first; it != last; ++it) {
+        if (uniform_names[it->name] == name) {
+            return it->slot;
+        }
+    }
+    return NO_SLOT;
+}
+
+std::uint32_t shaders::Shader::find_slot(GLint location) const {
+    if (location < 0 || std::size_t(location) >= location_slots.size()) {
+        return NO_SLOT;
+    }
+    return location_slots[location];
+}
+
+void shaders::Shader::set_value(
+    std::uint32_t slot, UniformKind kind, const UniformBits& bits
+) {
+    stats.requested++;
+
+    if (slot == NO_SLOT) {
+        // glUniform* ignores location -1 anyway
+        stats.elided++;
+        return;
+    }
+
+    UniformValue& v = values[slot];
+    if (v.queued) {
+        // this or the value queued before it never reaches the driver
+        stats.elided++;
+    } else if (v.known && v.current == bits) {
+        stats.elided++;
+        return;
+    } else {
+        v.queued = true;
+        dirty.push_back(slot);
+    }
+    v.kind = kind;
+    v.pending = bits;
+}
+
+void shaders::Shader::set_value(
+    UniformHandle handle, UniformKind kind, const UniformBits& bits
+) {
+    set_value(find_slot(handle), kind, bits);
+}
+
+namespace {
+    template <typename T>
+    std::uint32_t bits(T val) {
+        return std::bit_cast<std::uint32_t>(val);
+    }
+} // namespace
+
+void shaders::Shader::set_bool(std::string_view name, bool val) {
+    set_value(find_slot(name), UniformKind::int1, {bits(GLint(val))});
 }
 
-void shaders::Shader::set_bool(const std::string& name, bool val) const {
-    glUniform1i(glGetUniformLocation(id, name.c_str()), (int)val); 
+void shaders::Shader::set_bool(UniformHandle handle, bool val) {
+    set_value(handle, UniformKind::int1, {bits(GLint(val))});
 }
 
-void shaders::Shader::set_int(const std::string& name, int val) const {
-    glUniform1i(glGetUniformLocation(id, name.c_str()), val); 
+void shaders::Shader::set_int(std::string_view name, int val) {
+    set_value(find_slot(name), UniformKind::int1, {bits(val)});
 }
 
-void shaders::Shader::set_float(const std::string& name, float val) const {
-    glUniform1f(glGetUniformLocation(id, name.c_str()), val); 
-}
\ No newline at end of file
+void shaders::Shader::set_int(UniformHandle handle, int val) {
+    set_value(handle, UniformKind::int1, {bits(val)});
+}
+
+void shaders::Shader::set_float(std::string_view name, float val) {
+    set_value(find_slot(name), UniformKind::float1, {bits(val)});
+}
+
+void shaders::Shader::set_float(UniformHandle handle, float val) {
+    set_value(handle, UniformKind::float1, {bits(val)});
+}
+
+void shaders::Shader::set_vec4(
+    std::string_view name, float x, float y, float z, float w
+) {
+    set_value(find_slot(name), UniformKind::float4, {bits(x), bits(y), bits(z), bits(w)});
+}
+
+void shaders::Shader::set_vec4(
+    UniformHandle handle, float x, float y, float z, float w
+) {
+    set_value(handle, UniformKind::float4, {bits(x), bits(y), bits(z), bits(w)});
+}
+
+void shaders::Shader::set_bool(Uniform<bool> u, bool val) {
+    set(u, val);
+}
+
+void shaders::Shader::set_int(Uniform<int> u, int val) {
+    set(u, val);
+}
+
+void shaders::Shader::set_float(Uniform<float> u, float val) {
+    set(u, val);
+}
+
+void shaders::Shader::set_vec4(
+    Uniform<std140::vec4> u, float x, float y, float z, float w
+) {
+    set(u, std140::vec4{x, y, z, w});
+}
+
+void shaders::Shader::set(Uniform<bool> u, bool val) {
+    set_value(find_slot(u), UniformKind::int1, {bits(GLint(val))});
+}
+
+void shaders::Shader::set(Uniform<int> u, int val) {
+    set_value(find_slot(u), UniformKind::int1, {bits(val)});
+}
+
+void shaders::Shader::set(Uniform<unsigned int> u, unsigned int val) {
+    set_value(find_slot(u), UniformKind::uint1, {val});
+}
+
+void shaders::Shader::set(Uniform<float> u, float val) {
+    set_value(find_slot(u), UniformKind::float1, {bits(val)});
+}
+
+void shaders::Shader::set(Uniform<std140::vec2> u, const std140::vec2& val) {
+    set_value(find_slot(u), UniformKind::float2, {bits(val.x), bits(val.y)});
+}
+
+void shaders::Shader::set(Uniform<std140::vec3> u, const std140::vec3& val) {
+    set_value(find_slot(u), UniformKind::float3, {
+        bits(val.x), bits(val.y), bits(val.z)
+    });
+}
+
+void shaders::Shader::set(Uniform<std140::vec4> u, const std140::vec4& val) {
+    set_value(find_slot(u), UniformKind::float4, {
+        bits(val.x), bits(val.y), bits(val.z), bits(val.w)
+    });
+}
+
+void shaders::Shader::set(Uniform<std140::ivec2> u, const std140::ivec2& val) {
+    set_value(find_slot(u), UniformKind::int2, {bits(val.x), bits(val.y)});
+}
+
+void shaders::Shader::set(Uniform<std140::ivec4> u, const std140::ivec4& val) {
+    set_value(find_slot(u), UniformKind::int4, {
+        bits(val.x), bits(val.y), bits(val.z), bits(val.w)
+    });
+}
+
+void shaders::Shader::set(Uniform<std140::mat3> u, const std140::mat3& val) {
+    // without the padding of each std140 column
+    UniformBits packed{};
+    for (int c = 0; c < 3; c++) {
+        const std140::vec4& col = val.cols[c];
+        packed[c * 3] = bits(col.x);
+        packed[c * 3 + 1] = bits(col.y);
+        packed[c * 3 + 2] = bits(col.z);
+    }
+    set_value(find_slot(u), UniformKind::mat3, packed);
+}
+
+void shaders::Shader::set(Uniform<std140::mat4> u, const std140::mat4& val) {
+    set_value(find_slot(u), UniformKind::mat4, std::bit_cast<UniformBits>(val.cols));
+}
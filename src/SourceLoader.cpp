@@ -0,0 +1,134 @@
+#include "SourceLoader.hpp"
+#include "Sources.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+} // namespace
+
+shaders::ProgramSources shaders::read_sources(
+    const std::string& v_path, const std::string& f_path
+) {
+    ProgramSources out;
+    out.info.v_path = v_path;
+    out.info.f_path = f_path;
+    out.info.files = {v_path, f_path};
+
+    auto start = Clock::now();
+    SourceText v_src(v_path.c_str());
+    SourceText f_src(f_path.c_str());
+    // the text may be mapped, copy it out while the mapping is alive
+    out.vert.code = v_src.view();
+    out.frag.code = f_src.view();
+    out.read = Clock::now() - start;
+
+    out.ok = v_src.is_open() && f_src.is_open();
+    return out;
+}
+
+shaders::ProgramSources shaders::preprocess_sources(
+    const std::string& v_path, const std::string& f_path,
+    const std::filesystem::path& include_root, const Variant& variant
+) {
+    ProgramSources out;
+    out.info.v_path = v_path;
+    out.info.f_path = f_path;
+    out.info.preprocessed = true;
+    out.info.include_root = include_root;
+    out.info.variant = variant;
+
+    // reads the files as well
+    auto start = Clock::now();
+    Preprocessor preprocessor(include_root);
+    out.vert = preprocessor.process(v_path, variant);
+    out.frag = preprocessor.process(f_path, variant);
+    out.preprocess = Clock::now() - start;
+
+    out.info.files = out.vert.files;
+    for (const std::string& file : out.frag.files) {
+        if (std::find(out.info.files.begin(), out.info.files.end(), file)
+            == out.info.files.end()) {
+            out.info.files.push_back(file);
+        }
+    }
+
+    // a file that could not be read never makes it into the file table
+    out.ok = !out.vert.files.empty() && !out.frag.files.empty();
+    return out;
+}
+
+shaders::SourceLoader::SourceLoader(unsigned threads) : stopping(false) {
+    if (threads == 0) {
+        threads = std::clamp(std::thread::hardware_concurrency(), 1u, 4u);
+    }
+    for (unsigned i = 0; i < threads; i++) {
+        workers.emplace_back(&SourceLoader::run, this);
+    }
+}
+
+shaders::SourceLoader::~SourceLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+std::future<shaders::ProgramSources> shaders::SourceLoader::load(
+    std::string v_path, std::string f_path
+) {
+    return submit(std::packaged_task<ProgramSources()>(
+        [v_path = std::move(v_path), f_path = std::move(f_path)] {
+            return read_sources(v_path, f_path);
+        }
+    ));
+}
+
+std::future<shaders::ProgramSources> shaders::SourceLoader::load(
+    std::string v_path, std::string f_path,
+    std::filesystem::path include_root, Variant variant
+) {
+    return submit(std::packaged_task<ProgramSources()>(
+        [v_path = std::move(v_path), f_path = std::move(f_path),
+            include_root = std::move(include_root), variant = std::move(variant)] {
+            return preprocess_sources(v_path, f_path, include_root, variant);
+        }
+    ));
+}
+
+std::size_t shaders::SourceLoader::threads() const {
+    return workers.size();
+}
+
+std::future<shaders::ProgramSources> shaders::SourceLoader::submit(
+    std::packaged_task<ProgramSources()> job
+) {
+    std::future<ProgramSources> result = job.get_future();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+    }
+    wake.notify_one();
+    return result;
+}
+
+void shaders::SourceLoader::run() {
+    while (true) {
+        std::packaged_task<ProgramSources()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this] { return stopping || !jobs.empty(); });
+            if (jobs.empty()) {
+                return;
+            }
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        job();
+    }
+}
@@ -0,0 +1,74 @@
+#include "Sources.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+#ifdef LEARN_OPENGL_EMBED_SHADERS
+#include "EmbeddedShaders.hpp"
+#endif
+
+namespace {
+    bool default_disk_sources() {
+#ifdef LEARN_OPENGL_HOT_RELOAD
+        return true;
+#else
+        const char* env = std::getenv("LEARN_OPENGL_SHADERS_FROM_DISK");
+        return env != nullptr && std::string_view(env) != "0";
+#endif
+    }
+
+    std::atomic<bool> from_disk{default_disk_sources()};
+} // namespace
+
+std::optional<std::string_view> shaders::embedded_source(std::string_view path) {
+#ifdef LEARN_OPENGL_EMBED_SHADERS
+    // "./shaders/a/../X.vert" should find "shaders/X.vert"
+    std::string key = std::filesystem::path(path).lexically_normal().generic_string();
+
+    auto it = std::lower_bound(
+        embedded::files.begin(), embedded::files.end(), std::string_view(key),
+        [](const embedded::File& f, std::string_view p) { return f.path < p; }
+    );
+    if (it != embedded::files.end() && it->path == key) {
+        return it->source;
+    }
+#else
+    (void)path;
+#endif
+    return std::nullopt;
+}
+
+bool shaders::disk_sources() {
+    return from_disk.load(std::memory_order_relaxed);
+}
+
+void shaders::set_disk_sources(bool disk) {
+    from_disk.store(disk, std::memory_order_relaxed);
+}
+
+shaders::SourceText::SourceText(const char* path) {
+    if (!disk_sources()) {
+        if (std::optional<std::string_view> source = embedded_source(path)) {
+            text = *source;
+            return;
+        }
+    }
+
+    mapped.emplace(path);
+    text = mapped->view();
+}
+
+bool shaders::SourceText::is_open() const {
+    return !mapped || mapped->is_open();
+}
+
+bool shaders::SourceText::embedded() const {
+    return !mapped;
+}
+
+std::string_view shaders::SourceText::view() const {
+    return text;
+}
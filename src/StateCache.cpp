@@ -0,0 +1,337 @@
+#include "StateCache.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+    constexpr GLuint UNKNOWN = ~0u;
+    constexpr GLenum NO_UNIT = 0;
+    constexpr std::size_t MAX_UNITS = 32;
+
+    // targets with one non-indexed binding each
+    constexpr GLenum BUFFER_TARGETS[] = {
+        GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_UNIFORM_BUFFER,
+        GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, GL_PIXEL_PACK_BUFFER,
+        GL_PIXEL_UNPACK_BUFFER, GL_TEXTURE_BUFFER, GL_TRANSFORM_FEEDBACK_BUFFER,
+        GL_DRAW_INDIRECT_BUFFER, GL_SHADER_STORAGE_BUFFER,
+        GL_ATOMIC_COUNTER_BUFFER, GL_DISPATCH_INDIRECT_BUFFER, GL_QUERY_BUFFER,
+    };
+
+    constexpr GLenum TEXTURE_TARGETS[] = {
+        GL_TEXTURE_1D, GL_TEXTURE_2D, GL_TEXTURE_3D, GL_TEXTURE_CUBE_MAP,
+        GL_TEXTURE_1D_ARRAY, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_RECTANGLE,
+        GL_TEXTURE_BUFFER, GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_2D_MULTISAMPLE,
+        GL_TEXTURE_2D_MULTISAMPLE_ARRAY,
+    };
+
+    constexpr GLenum CAPS[] = {
+        GL_BLEND, GL_CULL_FACE, GL_DEPTH_TEST, GL_STENCIL_TEST, GL_SCISSOR_TEST,
+        GL_POLYGON_OFFSET_FILL, GL_MULTISAMPLE, GL_FRAMEBUFFER_SRGB,
+        GL_PROGRAM_POINT_SIZE, GL_PRIMITIVE_RESTART, GL_RASTERIZER_DISCARD,
+        GL_SAMPLE_ALPHA_TO_COVERAGE, GL_DEPTH_CLAMP, GL_TEXTURE_CUBE_MAP_SEAMLESS,
+        GL_LINE_SMOOTH, GL_DITHER,
+    };
+
+    constexpr std::size_t BUFFER_COUNT = std::size(BUFFER_TARGETS);
+    constexpr std::size_t TEXTURE_COUNT = std::size(TEXTURE_TARGETS);
+    constexpr std::size_t CAP_COUNT = std::size(CAPS);
+
+    template <std::size_t N>
+    int index_of(const GLenum (&list)[N], GLenum value) {
+        for (std::size_t i = 0; i < N; i++) {
+            if (list[i] == value) {
+                return int(i);
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief What the driver is known to have bound, UNKNOWN where it has
+     * not been seen since the last invalidate
+     *
+     */
+    struct State {
+        GLuint program;
+        GLuint vertex_array;
+        GLuint draw_framebuffer;
+        GLuint read_framebuffer;
+        GLenum active_texture;
+        GLuint buffers[BUFFER_COUNT];
+        GLuint textures[MAX_UNITS][TEXTURE_COUNT];
+        // -1 unknown, 0 disabled, 1 enabled
+        signed char caps[CAP_COUNT];
+    };
+
+    struct Original {
+        PFNGLUSEPROGRAMPROC use_program;
+        PFNGLBINDVERTEXARRAYPROC bind_vertex_array;
+        PFNGLBINDBUFFERPROC bind_buffer;
+        PFNGLBINDBUFFERBASEPROC bind_buffer_base;
+        PFNGLBINDBUFFERRANGEPROC bind_buffer_range;
+        PFNGLBINDTEXTUREPROC bind_texture;
+        PFNGLACTIVETEXTUREPROC active_texture;
+        PFNGLBINDFRAMEBUFFERPROC bind_framebuffer;
+        PFNGLENABLEPROC enable;
+        PFNGLDISABLEPROC disable;
+        PFNGLDELETEBUFFERSPROC delete_buffers;
+        PFNGLDELETEVERTEXARRAYSPROC delete_vertex_arrays;
+        PFNGLDELETETEXTURESPROC delete_textures;
+        PFNGLDELETEFRAMEBUFFERSPROC delete_framebuffers;
+    };
+
+    // per thread, like the glad table the wrappers are installed in
+    thread_local State state;
+    thread_local Original original;
+    thread_local gl::StateCacheStats stats;
+    thread_local bool installed = false;
+
+    void forget() {
+        state.program = UNKNOWN;
+        state.vertex_array = UNKNOWN;
+        state.draw_framebuffer = UNKNOWN;
+        state.read_framebuffer = UNKNOWN;
+        state.active_texture = NO_UNIT;
+        std::fill(std::begin(state.buffers), std::end(state.buffers), UNKNOWN);
+        for (auto& unit : state.textures) {
+            std::fill(std::begin(unit), std::end(unit), UNKNOWN);
+        }
+        std::fill(std::begin(state.caps), std::end(state.caps), -1);
+    }
+
+    /**
+     * @brief Record a new value, or report that the call can be dropped
+     *
+     */
+    template <typename T>
+    bool changes(T& tracked, T value) {
+        if (tracked == value) {
+            stats.elided++;
+            return false;
+        }
+        tracked = value;
+        stats.forwarded++;
+        return true;
+    }
+
+    void APIENTRY use_program(GLuint program) {
+        if (changes(state.program, program)) {
+            original.use_program(program);
+        }
+    }
+
+    void APIENTRY bind_vertex_array(GLuint array) {
+        if (changes(state.vertex_array, array)) {
+            // the element buffer binding belongs to the vertex array
+            state.buffers[index_of(BUFFER_TARGETS, GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN;
+            original.bind_vertex_array(array);
+        }
+    }
+
+    void APIENTRY bind_buffer(GLenum target, GLuint buffer) {
+        int i = index_of(BUFFER_TARGETS, target);
+        if (i < 0) {
+            stats.forwarded++;
+            original.bind_buffer(target, buffer);
+        } else if (changes(state.buffers[i], buffer)) {
+            original.bind_buffer(target, buffer);
+        }
+    }
+
+    // indexed binds also set the generic binding
+    void APIENTRY bind_buffer_base(GLenum target, GLuint index, GLuint buffer) {
+        int i = index_of(BUFFER_TARGETS, target);
+        if (i >= 0) {
+            state.buffers[i] = buffer;
+        }
+        stats.forwarded++;
+        original.bind_buffer_base(target, index, buffer);
+    }
+
+    void APIENTRY bind_buffer_range(
+        GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size
+    ) {
+        int i = index_of(BUFFER_TARGETS, target);
+        if (i >= 0) {
+            state.buffers[i] = buffer;
+        }
+        stats.forwarded++;
+        original.bind_buffer_range(target, index, buffer, offset, size);
+    }
+
+    void APIENTRY active_texture(GLenum texture) {
+        if (changes(state.active_texture, texture)) {
+            original.active_texture(texture);
+        }
+    }
+
+    void APIENTRY bind_texture(GLenum target, GLuint texture) {
+        int i = index_of(TEXTURE_TARGETS, target);
+        std::size_t unit = state.active_texture - GL_TEXTURE0;
+        if (i < 0 || state.active_texture == NO_UNIT || unit >= MAX_UNITS) {
+            stats.forwarded++;
+            original.bind_texture(target, texture);
+        } else if (changes(state.textures[unit][i], texture)) {
+            original.bind_texture(target, texture);
+        }
+    }
+
+    void APIENTRY bind_framebuffer(GLenum target, GLuint framebuffer) {
+        bool draw = target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER;
+        bool read = target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER;
+        if ((draw || read)
+            && (!draw || state.draw_framebuffer == framebuffer)
+            && (!read || state.read_framebuffer == framebuffer)) {
+            stats.elided++;
+            return;
+        }
+        if (draw) {
+            state.draw_framebuffer = framebuffer;
+        }
+        if (read) {
+            state.read_framebuffer = framebuffer;
+        }
+        stats.forwarded++;
+        original.bind_framebuffer(target, framebuffer);
+    }
+
+    void APIENTRY enable(GLenum cap) {
+        int i = index_of(CAPS, cap);
+        if (i < 0) {
+            stats.forwarded++;
+            original.enable(cap);
+        } else if (changes(state.caps[i], (signed char)1)) {
+            original.enable(cap);
+        }
+    }
+
+    void APIENTRY disable(GLenum cap) {
+        int i = index_of(CAPS, cap);
+        if (i < 0) {
+            stats.forwarded++;
+            original.disable(cap);
+        } else if (changes(state.caps[i], (signed char)0)) {
+            original.disable(cap);
+        }
+    }
+
+    // deleting a bound object binds 0 in its place
+
+    void APIENTRY delete_buffers(GLsizei n, const GLuint* buffers) {
+        for (GLsizei i = 0; i < n; i++) {
+            if (buffers[i] != 0) {
+                std::replace(
+                    std::begin(state.buffers), std::end(state.buffers), buffers[i], 0u
+                );
+            }
+        }
+        original.delete_buffers(n, buffers);
+    }
+
+    void APIENTRY delete_vertex_arrays(GLsizei n, const GLuint* arrays) {
+        for (GLsizei i = 0; i < n; i++) {
+            if (arrays[i] != 0 && arrays[i] == state.vertex_array) {
+                state.vertex_array = 0;
+                state.buffers[index_of(BUFFER_TARGETS, GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN;
+            }
+        }
+        original.delete_vertex_arrays(n, arrays);
+    }
+
+    void APIENTRY delete_textures(GLsizei n, const GLuint* textures) {
+        for (GLsizei i = 0; i < n; i++) {
+            if (textures[i] != 0) {
+                for (auto& unit : state.textures) {
+                    std::replace(std::begin(unit), std::end(unit), textures[i], 0u);
+                }
+            }
+        }
+        original.delete_textures(n, textures);
+    }
+
+    void APIENTRY delete_framebuffers(GLsizei n, const GLuint* framebuffers) {
+        for (GLsizei i = 0; i < n; i++) {
+            if (framebuffers[i] == 0) {
+                continue;
+            }
+            if (framebuffers[i] == state.draw_framebuffer) {
+                state.draw_framebuffer = 0;
+            }
+            if (framebuffers[i] == state.read_framebuffer) {
+                state.read_framebuffer = 0;
+            }
+        }
+        original.delete_framebuffers(n, framebuffers);
+    }
+} // namespace
+
+void gl::install_state_cache() {
+    if (installed) {
+        return;
+    }
+
+    original = {
+        glad_glUseProgram, glad_glBindVertexArray, glad_glBindBuffer,
+        glad_glBindBufferBase, glad_glBindBufferRange, glad_glBindTexture,
+        glad_glActiveTexture, glad_glBindFramebuffer, glad_glEnable,
+        glad_glDisable, glad_glDeleteBuffers, glad_glDeleteVertexArrays,
+        glad_glDeleteTextures, glad_glDeleteFramebuffers,
+    };
+
+    glad_glUseProgram = use_program;
+    glad_glBindVertexArray = bind_vertex_array;
+    glad_glBindBuffer = bind_buffer;
+    glad_glBindBufferBase = bind_buffer_base;
+    glad_glBindBufferRange = bind_buffer_range;
+    glad_glBindTexture = bind_texture;
+    glad_glActiveTexture = active_texture;
+    glad_glBindFramebuffer = bind_framebuffer;
+    glad_glEnable = enable;
+    glad_glDisable = disable;
+    glad_glDeleteBuffers = delete_buffers;
+    glad_glDeleteVertexArrays = delete_vertex_arrays;
+    glad_glDeleteTextures = delete_textures;
+    glad_glDeleteFramebuffers = delete_framebuffers;
+
+    forget();
+    installed = true;
+}
+
+void gl::uninstall_state_cache() {
+    if (!installed) {
+        return;
+    }
+
+    glad_glUseProgram = original.use_program;
+    glad_glBindVertexArray = original.bind_vertex_array;
+    glad_glBindBuffer = original.bind_buffer;
+    glad_glBindBufferBase = original.bind_buffer_base;
+    glad_glBindBufferRange = original.bind_buffer_range;
+    glad_glBindTexture = original.bind_texture;
+    glad_glActiveTexture = original.active_texture;
+    glad_glBindFramebuffer = original.bind_framebuffer;
+    glad_glEnable = original.enable;
+    glad_glDisable = original.disable;
+    glad_glDeleteBuffers = original.delete_buffers;
+    glad_glDeleteVertexArrays = original.delete_vertex_arrays;
+    glad_glDeleteTextures = original.delete_textures;
+    glad_glDeleteFramebuffers = original.delete_framebuffers;
+
+    installed = false;
+}
+
+bool gl::state_cache_installed() {
+    return installed;
+}
+
+void gl::invalidate_state_cache() {
+    forget();
+}
+
+const gl::StateCacheStats& gl::state_cache_stats() {
+    return stats;
+}
+
+void gl::reset_state_cache_stats() {
+    stats = {};
+}
@@ -0,0 +1,175 @@
+#include "Trace.hpp"
+#include "GladFunctions.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Counter {
+        std::uint64_t calls;
+        Clock::duration time;
+        Clock::duration longest;
+    };
+
+    // per thread, like the glad table the wrappers are installed in
+    thread_local Counter counters[gl::FUNCTION_COUNT];
+    thread_local std::array<std::uint64_t, gl::TRACE_BUCKETS> durations;
+    thread_local std::uint64_t frame = 0;
+    thread_local std::deque<gl::FrameTrace> history;
+    thread_local std::size_t history_size = 120;
+    thread_local bool installed = false;
+
+    std::size_t bucket(Clock::duration elapsed) {
+        auto limit = std::chrono::nanoseconds(250);
+        std::size_t i = 0;
+        while (i + 1 < gl::TRACE_BUCKETS && elapsed >= limit) {
+            limit *= 4;
+            i++;
+        }
+        return i;
+    }
+
+    void record(std::size_t function, Clock::duration elapsed) {
+        Counter& c = counters[function];
+        c.calls++;
+        c.time += elapsed;
+        c.longest = std::max(c.longest, elapsed);
+        durations[bucket(elapsed)]++;
+    }
+
+    /**
+     * @brief The wrapper of one entry point, and the pointer it forwards to
+     *
+     */
+    template <std::size_t Id, typename Proc>
+    struct Traced;
+
+    template <std::size_t Id, typename R, typename... Args>
+    struct Traced<Id, R (APIENTRYP)(Args...)> {
+        static inline thread_local R (APIENTRYP next)(Args...) = nullptr;
+
+        static R APIENTRY call(Args... args) {
+            auto start = Clock::now();
+            if constexpr (std::is_void_v<R>) {
+                next(args...);
+                record(Id, Clock::now() - start);
+            } else {
+                R result = next(args...);
+                record(Id, Clock::now() - start);
+                return result;
+            }
+        }
+    };
+} // namespace
+
+void gl::install_trace() {
+    if (installed) {
+        return;
+    }
+
+#define GLAD_FUNCTION(name)                                                   \
+    if (glad_##name != NULL) {                                                \
+        using T = Traced<FN_##name, decltype(glad_##name)>;                   \
+        T::next = glad_##name;                                                \
+        glad_##name = T::call;                                                \
+    }
+#include "glad_functions.inc"
+#undef GLAD_FUNCTION
+
+    reset_trace();
+    installed = true;
+}
+
+void gl::uninstall_trace() {
+    if (!installed) {
+        return;
+    }
+
+#define GLAD_FUNCTION(name)                                                   \
+    {                                                                         \
+        using T = Traced<FN_##name, decltype(glad_##name)>;                   \
+        if (glad_##name == T::call) {                                         \
+            glad_##name = T::next;                                            \
+        }                                                                     \
+    }
+#include "glad_functions.inc"
+#undef GLAD_FUNCTION
+
+    installed = false;
+}
+
+bool gl::trace_installed() {
+    return installed;
+}
+
+const gl::FrameTrace& gl::end_trace_frame() {
+    FrameTrace trace;
+    trace.frame = frame++;
+    for (std::size_t i = 0; i < FUNCTION_COUNT; i++) {
+        Counter& c = counters[i];
+        if (c.calls == 0) {
+            continue;
+        }
+        trace.functions.push_back({function_name(Function(i)), c.calls, c.time, c.longest});
+        trace.calls += c.calls;
+        trace.time += c.time;
+        c = Counter{};
+    }
+    std::sort(
+        trace.functions.begin(), trace.functions.end(),
+        [](const TracedCall& a, const TracedCall& b) { return a.time > b.time; }
+    );
+    trace.durations = durations;
+    durations.fill(0);
+
+    history.push_back(std::move(trace));
+    while (history.size() > std::max<std::size_t>(history_size, 1)) {
+        history.pop_front();
+    }
+    return history.back();
+}
+
+const std::deque<gl::FrameTrace>& gl::trace_history() {
+    return history;
+}
+
+void gl::set_trace_history(std::size_t frames) {
+    history_size = frames;
+    while (history.size() > std::max<std::size_t>(history_size, 1)) {
+        history.pop_front();
+    }
+}
+
+void gl::reset_trace() {
+    std::fill(std::begin(counters), std::end(counters), Counter{});
+    durations.fill(0);
+    history.clear();
+}
+
+void gl::print_trace(std::ostream& out, const FrameTrace& trace, std::size_t top) {
+    auto us = [](std::chrono::nanoseconds ns) {
+        return std::chrono::duration<double, std::micro>(ns).count();
+    };
+
+    out << "Frame " << trace.frame << ": " << trace.calls << " GL calls, "
+        << us(trace.time) << " us\n  durations";
+    auto limit = std::chrono::nanoseconds(250);
+    for (std::size_t i = 0; i < TRACE_BUCKETS; i++) {
+        if (i + 1 < TRACE_BUCKETS) {
+            out << "  <" << us(limit) << "us: " << trace.durations[i];
+            limit *= 4;
+        } else {
+            out << "  more: " << trace.durations[i];
+        }
+    }
+    out << "\n";
+
+    std::size_t shown = std::min(top, trace.functions.size());
+    for (std::size_t i = 0; i < shown; i++) {
+        const TracedCall& call = trace.functions[i];
+        out << "  " << call.name << " x" << call.calls << "  " << us(call.time)
+            << " us, longest " << us(call.longest) << " us\n";
+    }
+}
@@ -0,0 +1,160 @@
+#include "UniformBuffers.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+GLuint shaders::block_binding(std::string_view name) {
+    // the index is the binding point
+    static std::vector<std::string> names{FRAME_BLOCK};
+
+    auto it = std::find(names.begin(), names.end(), name);
+    if (it != names.end()) {
+        return it - names.begin();
+    }
+
+    // 36 is the least any GL 3.3 driver has
+    GLint max_bindings = 0;
+    if (glad_glGetIntegerv != nullptr) {
+        glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &max_bindings);
+    }
+    if (max_bindings <= 0) {
+        max_bindings = 36;
+    }
+    if (names.size() >= std::size_t(max_bindings)) {
+        std::cerr << "ERROR::UNIFORM_BUFFERS::OUT_OF_BINDINGS " << name << std::endl;
+        return GL_INVALID_INDEX;
+    }
+
+    names.emplace_back(name);
+    return names.size() - 1;
+}
+
+shaders::UniformRing::UniformRing(std::size_t frame_size, std::size_t frames)
+    : buffer(0), frame_size(0), alignment(256), frame(0), head(0),
+      mapped(nullptr), fences(frames == 0 ? 1 : frames, nullptr), full(false) {
+    GLint align = 0;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &align);
+    if (align > 0) {
+        alignment = align;
+    }
+
+    // every frame's region starts on an aligned offset
+    this->frame_size = std140::round_up(frame_size, alignment);
+    GLsizeiptr total = this->frame_size * fences.size();
+
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+
+    if (glBufferStorage != nullptr && GLAD_GL_VERSION_4_4) {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_UNIFORM_BUFFER, total, nullptr, flags);
+        mapped = static_cast<unsigned char*>(
+            glMapBufferRange(GL_UNIFORM_BUFFER, 0, total, flags)
+        );
+        if (mapped == nullptr) {
+            std::cerr << "ERROR::UNIFORM_RING::MAP_FAILED" << std::endl;
+        }
+    }
+
+    if (mapped == nullptr) {
+        // immutable storage cannot be respecified, start over
+        glDeleteBuffers(1, &buffer);
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+        glBufferData(GL_UNIFORM_BUFFER, total, nullptr, GL_STREAM_DRAW);
+    }
+
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+shaders::UniformRing::~UniformRing() {
+    for (GLsync fence : fences) {
+        if (fence != nullptr) {
+            glDeleteSync(fence);
+        }
+    }
+    if (mapped != nullptr) {
+        glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+        glUnmapBuffer(GL_UNIFORM_BUFFER);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+    glDeleteBuffers(1, &buffer);
+}
+
+void shaders::UniformRing::begin_frame() {
+    frame = (frame + 1) % fences.size();
+    head = 0;
+    full = false;
+
+    GLsync& fence = fences[frame];
+    if (fence == nullptr) {
+        return;
+    }
+
+    // only waits when the CPU is a whole ring of frames ahead of the GPU
+    GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+    while (true) {
+        GLenum status = glClientWaitSync(fence, flags, 1000000);
+        if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED) {
+            break;
+        }
+        if (status == GL_WAIT_FAILED) {
+            std::cerr << "ERROR::UNIFORM_RING::WAIT_FAILED" << std::endl;
+            break;
+        }
+        flags = 0;
+    }
+    glDeleteSync(fence);
+    fence = nullptr;
+}
+
+void shaders::UniformRing::end_frame() {
+    if (fences[frame] != nullptr) {
+        glDeleteSync(fences[frame]);
+    }
+    fences[frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+shaders::UniformRange shaders::UniformRing::write(const void* data, std::size_t size) {
+    if (head + size > frame_size) {
+        if (!full) {
+            std::cerr << "ERROR::UNIFORM_RING::FRAME_FULL " << frame_size
+                << " bytes per frame" << std::endl;
+            full = true;
+        }
+        return {};
+    }
+
+    UniformRange range{buffer, GLintptr(frame * frame_size + head), GLsizeiptr(size)};
+
+    if (mapped != nullptr) {
+        std::memcpy(mapped + range.offset, data, size);
+    } else {
+        glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+        glBufferSubData(GL_UNIFORM_BUFFER, range.offset, size, data);
+    }
+
+    head = std140::round_up(head + size, alignment);
+    return range;
+}
+
+void shaders::UniformRing::bind(GLuint binding, UniformRange range) {
+    if (range.size == 0) {
+        return;
+    }
+    glBindBufferRange(GL_UNIFORM_BUFFER, binding, range.buffer, range.offset, range.size);
+}
+
+void shaders::UniformRing::set_frame(const FrameUniforms& data) {
+    bind(FRAME_BINDING, write(data));
+}
+
+bool shaders::UniformRing::persistent() const {
+    return mapped != nullptr;
+}
+
+std::size_t shaders::UniformRing::used() const {
+    return head;
+}
@@ -1,4 +1,65 @@
 #include "Util.hpp"
+#include "NullBackend.hpp"
+
+#ifdef LEARN_OPENGL_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    void* glfw_proc(const char* name) {
+        return reinterpret_cast<void*>(glfwGetProcAddress(name));
+    }
+
+    void* no_proc(const char*) {
+        return nullptr;
+    }
+
+#ifdef LEARN_OPENGL_EGL
+    void* egl_proc(const char* name) {
+        return reinterpret_cast<void*>(eglGetProcAddress(name));
+    }
+
+    bool has_extension(const char* extensions, std::string_view name) {
+        std::string_view list = extensions != nullptr ? extensions : "";
+        while (!list.empty()) {
+            std::size_t end = list.find(' ');
+            if (list.substr(0, end) == name) {
+                return true;
+            }
+            list.remove_prefix(end == std::string_view::npos ? list.size() : end + 1);
+        }
+        return false;
+    }
+
+    /**
+     * @brief Mesa's surfaceless platform needs no display server or GPU
+     * device, other drivers get their default display
+     *
+     */
+    EGLDisplay open_display() {
+        const char* client = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+        auto get_platform_display = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+            eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (get_platform_display != nullptr
+            && has_extension(client, "EGL_MESA_platform_surfaceless")) {
+            return get_platform_display(
+                EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        }
+        return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    }
+#endif
+} // namespace
 
 void util::framebuffer_size_callback(GLFWwindow *window, int width, int height) {
     glViewport(0, 0, width, height);
@@ -8,4 +69,366 @@ void util::process_input(GLFWwindow *window) {
     if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
         glfwSetWindowShouldClose(window, true);
     }
-}
\ No newline at end of file
+}
+
+util::ContextOptions util::parse_context_options(
+    int& argc, char** argv, ContextOptions options
+) {
+    int kept = 1;
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--headless") {
+            options.backend = Backend::HEADLESS;
+        } else if (arg == "--null") {
+            options.backend = Backend::NONE;
+        } else if (arg == "--size" && has_value) {
+            int width = 0;
+            int height = 0;
+            if (std::sscanf(argv[++i], "%dx%d", &width, &height) == 2
+                && width > 0 && height > 0) {
+                options.width = width;
+                options.height = height;
+            } else {
+                std::cerr << "ERROR::CONTEXT::BAD_SIZE " << argv[i] << std::endl;
+            }
+        } else if (arg == "--frames" && has_value) {
+            options.frames = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--screenshot" && has_value) {
+            options.screenshot = argv[++i];
+        } else {
+            argv[kept++] = argv[i];
+        }
+    }
+    argc = kept;
+    argv[argc] = nullptr;
+    return options;
+}
+
+util::Context::Context(const ContextOptions& options)
+    : options(options), start(Clock::now()) {
+    switch (options.backend) {
+        case Backend::WINDOW:
+            ok = create_window();
+            break;
+        case Backend::HEADLESS:
+            ok = create_headless();
+            break;
+        case Backend::NONE:
+            gl::load_null_backend();
+            ok = true;
+            return;
+    }
+    if (!ok) {
+        return;
+    }
+
+    if (!gladLoadGLLoader(loader())) {
+        std::cerr << "ERROR::CONTEXT::GLAD_LOAD_FAILED" << std::endl;
+        ok = false;
+        return;
+    }
+
+    if (glfw_window != nullptr) {
+        glViewport(0, 0, width(), height());
+        glfwSetFramebufferSizeCallback(glfw_window, framebuffer_size_callback);
+    } else {
+        create_framebuffer();
+    }
+}
+
+util::Context::~Context() {
+    switch (options.backend) {
+        case Backend::WINDOW:
+            if (glfw_window != nullptr) {
+                glfwDestroyWindow(glfw_window);
+            }
+            glfwTerminate();
+            break;
+        case Backend::HEADLESS:
+            if (fbo != 0 && glad_glDeleteFramebuffers != nullptr) {
+                glDeleteFramebuffers(1, &fbo);
+                glDeleteRenderbuffers(2, renderbuffers);
+            }
+#ifdef LEARN_OPENGL_EGL
+            if (egl_display != nullptr) {
+                eglMakeCurrent(egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+                if (egl_surface != nullptr) {
+                    eglDestroySurface(egl_display, egl_surface);
+                }
+                if (egl_context != nullptr) {
+                    eglDestroyContext(egl_display, egl_context);
+                }
+                eglTerminate(egl_display);
+            }
+#endif
+            break;
+        case Backend::NONE:
+            gl::unload_null_backend();
+            break;
+    }
+}
+
+bool util::Context::create_window() {
+    if (!glfwInit()) {
+        std::cerr << "ERROR::CONTEXT::GLFW_INIT_FAILED" << std::endl;
+        return false;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, options.major);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, options.minor);
+    // profiles only exist from 3.2
+    if (options.major * 10 + options.minor >= 32) {
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    }
+    glfwWindowHint(GLFW_VISIBLE, options.visible ? GLFW_TRUE : GLFW_FALSE);
+
+    glfw_window = glfwCreateWindow(options.width, options.height, options.title, NULL, NULL);
+    if (glfw_window == NULL) {
+        std::cerr << "ERROR::CONTEXT::WINDOW_CREATION_FAILED" << std::endl;
+        return false;
+    }
+    glfwMakeContextCurrent(glfw_window);
+    return true;
+}
+
+bool util::Context::create_headless() {
+#ifdef LEARN_OPENGL_EGL
+    EGLDisplay display = open_display();
+    if (display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr)) {
+        std::cerr << "ERROR::CONTEXT::NO_EGL_DISPLAY" << std::endl;
+        return false;
+    }
+    egl_display = display;
+
+    if (!eglBindAPI(EGL_OPENGL_API)) {
+        std::cerr << "ERROR::CONTEXT::NO_DESKTOP_GL" << std::endl;
+        return false;
+    }
+
+    // without these a 1x1 pbuffer is made current, rendering still goes to
+    // the framebuffer object
+    const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+    bool surfaceless = has_extension(extensions, "EGL_KHR_surfaceless_context")
+        && has_extension(extensions, "EGL_KHR_no_config_context");
+
+    EGLConfig config = EGL_NO_CONFIG_KHR;
+    if (!surfaceless) {
+        const EGLint config_attribs[] = {
+            EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_NONE,
+        };
+        EGLint count = 0;
+        if (!eglChooseConfig(display, config_attribs, &config, 1, &count) || count == 0) {
+            std::cerr << "ERROR::CONTEXT::NO_EGL_CONFIG" << std::endl;
+            return false;
+        }
+    }
+
+    const EGLint context_attribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, options.major,
+        EGL_CONTEXT_MINOR_VERSION, options.minor,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK,
+        options.major * 10 + options.minor >= 32
+            ? EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT
+            : EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+        EGL_NONE,
+    };
+    EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, context_attribs);
+    if (context == EGL_NO_CONTEXT) {
+        std::cerr << "ERROR::CONTEXT::EGL_CONTEXT_CREATION_FAILED" << std::endl;
+        return false;
+    }
+    egl_context = context;
+
+    EGLSurface surface = EGL_NO_SURFACE;
+    if (!surfaceless) {
+        const EGLint pbuffer_attribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+        surface = eglCreatePbufferSurface(display, config, pbuffer_attribs);
+        egl_surface = surface;
+    }
+
+    if (!eglMakeCurrent(display, surface, surface, context)) {
+        std::cerr << "ERROR::CONTEXT::EGL_MAKE_CURRENT_FAILED" << std::endl;
+        return false;
+    }
+    return true;
+#else
+    std::cerr << "ERROR::CONTEXT::HEADLESS_UNSUPPORTED built without EGL" << std::endl;
+    return false;
+#endif
+}
+
+void util::Context::create_framebuffer() {
+    glGenRenderbuffers(2, renderbuffers);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[0]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, options.width, options.height);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[1]);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, options.width, options.height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferRenderbuffer(
+        GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers[0]);
+    glFramebufferRenderbuffer(
+        GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, renderbuffers[1]);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "ERROR::CONTEXT::FRAMEBUFFER_INCOMPLETE" << std::endl;
+        ok = false;
+        return;
+    }
+    glViewport(0, 0, options.width, options.height);
+}
+
+std::uint64_t util::Context::frame_limit() const {
+    if (options.frames == 0 && options.backend != Backend::WINDOW) {
+        return 1;
+    }
+    return options.frames;
+}
+
+bool util::Context::valid() const {
+    return ok;
+}
+
+bool util::Context::should_close() const {
+    std::uint64_t limit = frame_limit();
+    if (limit != 0 && frames >= limit) {
+        return true;
+    }
+    return glfw_window != nullptr && glfwWindowShouldClose(glfw_window);
+}
+
+void util::Context::end_frame() {
+    frames++;
+    if (options.screenshot != nullptr && frames == frame_limit()) {
+        save_frame(options.screenshot);
+    }
+    if (glfw_window != nullptr) {
+        glfwSwapBuffers(glfw_window);
+        glfwPollEvents();
+        process_input(glfw_window);
+    }
+}
+
+double util::Context::time() const {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+std::uint64_t util::Context::frame() const {
+    return frames;
+}
+
+int util::Context::width() const {
+    if (glfw_window == nullptr) {
+        return options.width;
+    }
+    int width = 0;
+    int height = 0;
+    glfwGetFramebufferSize(glfw_window, &width, &height);
+    return width;
+}
+
+int util::Context::height() const {
+    if (glfw_window == nullptr) {
+        return options.height;
+    }
+    int width = 0;
+    int height = 0;
+    glfwGetFramebufferSize(glfw_window, &width, &height);
+    return height;
+}
+
+GLuint util::Context::framebuffer() const {
+    return fbo;
+}
+
+GLFWwindow* util::Context::window() const {
+    return glfw_window;
+}
+
+util::Backend util::Context::backend() const {
+    return options.backend;
+}
+
+GLADloadproc util::Context::loader() const {
+    switch (options.backend) {
+        case Backend::WINDOW:
+            return glfw_proc;
+#ifdef LEARN_OPENGL_EGL
+        case Backend::HEADLESS:
+            return egl_proc;
+#endif
+        default:
+            return no_proc;
+    }
+}
+
+bool util::Context::save_frame(const std::filesystem::path& path) const {
+    const int w = width();
+    const int h = height();
+    std::vector<unsigned char> pixels(static_cast<std::size_t>(w) * h * 4);
+
+    GLint previous = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
+    glReadBuffer(fbo == 0 ? GL_BACK : GL_COLOR_ATTACHMENT0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, w, h, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, previous);
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        std::cerr << "ERROR::CONTEXT::SCREENSHOT_FAILED " << path << std::endl;
+        return false;
+    }
+    out << "P6\n" << w << " " << h << "\n255\n";
+    // GL rows start at the bottom
+    for (int y = h - 1; y >= 0; y--) {
+        const unsigned char* row = pixels.data() + static_cast<std::size_t>(y) * w * 4;
+        for (int x = 0; x < w; x++) {
+            out.write(reinterpret_cast<const char*>(row + x * 4), 3);
+        }
+    }
+    return static_cast<bool>(out);
+}
+
+util::LoopStats util::run_loop(
+    Context& context,
+    const std::function<void(double time, double step)>& update,
+    const std::function<void(double alpha)>& render,
+    const LoopOptions& options
+) {
+    LoopStats stats;
+    double simulated = 0;
+    double accumulator = 0;
+    double previous = context.time();
+
+    while (!context.should_close()) {
+        double now = context.time();
+        accumulator += options.frame_time > 0 ? options.frame_time : now - previous;
+        previous = now;
+
+        int steps = 0;
+        while (accumulator >= options.step && steps < options.max_steps) {
+            update(simulated, options.step);
+            simulated += options.step;
+            accumulator -= options.step;
+            steps++;
+        }
+        // behind by more than the cap, keep the fraction so the
+        // interpolation stays continuous
+        if (accumulator >= options.step) {
+            double behind = std::floor(accumulator / options.step) * options.step;
+            stats.dropped += behind;
+            accumulator -= behind;
+        }
+        stats.steps += steps;
+
+        render(accumulator / options.step);
+        context.end_frame();
+        stats.frames++;
+    }
+    return stats;
+}
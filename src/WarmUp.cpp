@@ -0,0 +1,200 @@
+#include "WarmUp.hpp"
+#include "CompileRecords.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief The bindings warm() changes
+     *
+     */
+    struct SavedState {
+        GLint draw_framebuffer = 0;
+        GLint read_framebuffer = 0;
+        GLint viewport[4] = {};
+        GLint program = 0;
+        GLint pipeline = 0;
+        GLint vertex_array = 0;
+        GLint array_buffer = 0;
+    };
+
+    SavedState save_state() {
+        SavedState s;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &s.draw_framebuffer);
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &s.read_framebuffer);
+        glGetIntegerv(GL_VIEWPORT, s.viewport);
+        glGetIntegerv(GL_CURRENT_PROGRAM, &s.program);
+        if (shaders::pipelines_supported()) {
+            glGetIntegerv(GL_PROGRAM_PIPELINE_BINDING, &s.pipeline);
+        }
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &s.vertex_array);
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, &s.array_buffer);
+        return s;
+    }
+
+    void restore_state(const SavedState& s) {
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, s.draw_framebuffer);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, s.read_framebuffer);
+        glViewport(s.viewport[0], s.viewport[1], s.viewport[2], s.viewport[3]);
+        if (shaders::pipelines_supported()) {
+            glBindProgramPipeline(s.pipeline);
+        }
+        glUseProgram(s.program);
+        glBindVertexArray(s.vertex_array);
+        glBindBuffer(GL_ARRAY_BUFFER, s.array_buffer);
+    }
+
+    /**
+     * @brief Bytes three vertices of a format can read, allowing 8 bytes a
+     * component
+     *
+     */
+    std::size_t format_extent(const shaders::VertexFormat& format) {
+        std::size_t extent = 0;
+        for (const shaders::VertexAttribute& attr : format.attributes) {
+            extent = std::max(extent, attr.offset + attr.components * 8);
+        }
+        return 3 * std::max(format.stride, extent);
+    }
+} // namespace
+
+shaders::WarmUp::WarmUp(GLenum color_format, GLenum depth_format)
+    : framebuffer(0), renderbuffers{0, 0}, vertex_buffer(0), buffer_size(0) {
+    SavedState saved = save_state();
+
+    glGenRenderbuffers(2, renderbuffers);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[0]);
+    glRenderbufferStorage(GL_RENDERBUFFER, color_format, 1, 1);
+
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferRenderbuffer(
+        GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffers[0]
+    );
+
+    if (depth_format != GL_NONE) {
+        glBindRenderbuffer(GL_RENDERBUFFER, renderbuffers[1]);
+        glRenderbufferStorage(GL_RENDERBUFFER, depth_format, 1, 1);
+        GLenum attachment = depth_format == GL_DEPTH24_STENCIL8
+                || depth_format == GL_DEPTH32F_STENCIL8
+            ? GL_DEPTH_STENCIL_ATTACHMENT
+            : GL_DEPTH_ATTACHMENT;
+        glFramebufferRenderbuffer(
+            GL_FRAMEBUFFER, attachment, GL_RENDERBUFFER, renderbuffers[1]
+        );
+    }
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "ERROR::WARM_UP::INCOMPLETE_FRAMEBUFFER" << std::endl;
+    }
+
+    glGenBuffers(1, &vertex_buffer);
+    restore_state(saved);
+}
+
+shaders::WarmUp::~WarmUp() {
+    glDeleteBuffers(1, &vertex_buffer);
+    glDeleteFramebuffers(1, &framebuffer);
+    glDeleteRenderbuffers(2, renderbuffers);
+}
+
+std::chrono::nanoseconds shaders::WarmUp::warm(
+    Shader& shader, const std::vector<VertexFormat>& formats
+) {
+    auto start = Clock::now();
+    SavedState saved = save_state();
+
+    shader.use();
+    draw(shader, formats);
+
+    restore_state(saved);
+    auto elapsed = Clock::now() - start;
+
+    if (ProgramRecord* record = shader.build_record()) {
+        record->warm_up = elapsed;
+        record->warmed = true;
+    }
+    counters.programs++;
+    counters.time += elapsed;
+    return elapsed;
+}
+
+std::chrono::nanoseconds shaders::WarmUp::warm(
+    PipelineCache& cache, std::size_t vert, std::size_t frag,
+    const std::vector<VertexFormat>& formats
+) {
+    auto start = Clock::now();
+    SavedState saved = save_state();
+
+    cache.use(vert, frag);
+    draw(cache.stage(vert), formats);
+
+    restore_state(saved);
+    auto elapsed = Clock::now() - start;
+
+    // the stages have a record each and no pipeline has one, so both are
+    // charged. A stage in several pipelines adds up the time of each
+    for (std::size_t index : {vert, frag}) {
+        if (ProgramRecord* record = cache.stage(index).build_record()) {
+            record->warm_up += elapsed;
+            record->warmed = true;
+        }
+    }
+    counters.programs++;
+    counters.time += elapsed;
+    return elapsed;
+}
+
+const shaders::WarmUpStats& shaders::WarmUp::stats() const {
+    return counters;
+}
+
+void shaders::WarmUp::draw(Shader& vertex_stage, const std::vector<VertexFormat>& formats) {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, 1, 1);
+
+    // a fresh vertex array per draw so no attribute is left enabled from
+    // the previous format
+    GLuint vao;
+    if (formats.empty()) {
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        // disabled attributes read their current value
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        counters.draws++;
+        glBindVertexArray(0);
+        glDeleteVertexArrays(1, &vao);
+    }
+
+    for (const VertexFormat& format : formats) {
+        // mismatches are reported by vertex_layout()
+        const VertexLayout& layout = vertex_stage.vertex_layout(format);
+        if (!layout.valid) {
+            continue;
+        }
+
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
+        std::size_t extent = format_extent(format);
+        if (extent > buffer_size) {
+            std::vector<unsigned char> zeros(extent);
+            glBufferData(GL_ARRAY_BUFFER, extent, zeros.data(), GL_STATIC_DRAW);
+            buffer_size = extent;
+        }
+
+        layout.apply();
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        counters.draws++;
+        glBindVertexArray(0);
+        glDeleteVertexArrays(1, &vao);
+    }
+
+    // code generation may happen on a driver thread, wait for it here
+    // rather than in the first frame
+    glFinish();
+}
@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include "Capture.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+    GLuint next_name = 1;
+    std::vector<unsigned char> buffer_data;
+    std::vector<GLfloat> uniform_values;
+    std::string shader_source;
+    std::string uniform_name;
+    const void* indices = nullptr;
+
+    void APIENTRY fake_gen_buffers(GLsizei n, GLuint* buffers) {
+        for (GLsizei i = 0; i < n; i++) {
+            buffers[i] = next_name++;
+        }
+    }
+
+    void APIENTRY fake_buffer_data(GLenum, GLsizeiptr size, const void* data, GLenum) {
+        auto bytes = static_cast<const unsigned char*>(data);
+        buffer_data.assign(bytes, bytes + size);
+    }
+
+    void APIENTRY fake_uniform_4fv(GLint, GLsizei count, const GLfloat* value) {
+        uniform_values.assign(value, value + 4 * count);
+    }
+
+    void APIENTRY fake_shader_source(
+        GLuint, GLsizei count, const GLchar* const* string, const GLint* length
+    ) {
+        shader_source.clear();
+        for (GLsizei i = 0; i < count; i++) {
+            if (length != nullptr && length[i] >= 0) {
+                shader_source.append(string[i], length[i]);
+            } else {
+                shader_source.append(string[i]);
+            }
+        }
+    }
+
+    GLint APIENTRY fake_get_uniform_location(GLuint, const GLchar* name) {
+        uniform_name = name;
+        return 3;
+    }
+
+    void APIENTRY fake_draw_elements(GLenum, GLsizei, GLenum, const void* offset) {
+        indices = offset;
+    }
+
+    std::size_t pixels_written = 0;
+    std::vector<GLenum> queried;
+
+    void APIENTRY fake_read_pixels(
+        GLint, GLint, GLsizei width, GLsizei height, GLenum, GLenum, void* pixels
+    ) {
+        pixels_written = std::size_t(width) * height * 4;
+        std::memset(pixels, 0xff, pixels_written);
+    }
+
+    void APIENTRY fake_get_integerv(GLenum pname, GLint* data) {
+        queried.push_back(pname);
+        data[0] = 1;
+        if (pname == GL_VIEWPORT) {
+            data[1] = 2;
+            data[2] = 1280;
+            data[3] = 720;
+        }
+    }
+
+    void install_fakes() {
+        glad_glGenBuffers = fake_gen_buffers;
+        glad_glBufferData = fake_buffer_data;
+        glad_glUniform4fv = fake_uniform_4fv;
+        glad_glShaderSource = fake_shader_source;
+        glad_glGetUniformLocation = fake_get_uniform_location;
+        glad_glDrawElements = fake_draw_elements;
+    }
+
+    void clear_fakes() {
+        glad_glGenBuffers = NULL;
+        glad_glBufferData = NULL;
+        glad_glUniform4fv = NULL;
+        glad_glShaderSource = NULL;
+        glad_glGetUniformLocation = NULL;
+        glad_glDrawElements = NULL;
+        buffer_data.clear();
+        uniform_values.clear();
+        shader_source.clear();
+        uniform_name.clear();
+        indices = nullptr;
+    }
+} // namespace
+
+TEST(CaptureTests, round_trip_test) {
+    std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "learn_opengl_capture_test.glcap";
+
+    // no context, so only the fakes are wrapped
+    install_fakes();
+    ASSERT_TRUE(gl::start_capture(path));
+    ASSERT_TRUE(gl::capturing());
+
+    GLuint buffers[2];
+    glGenBuffers(2, buffers);
+    const unsigned char data[] = {1, 2, 3, 4, 5};
+    glBufferData(GL_ARRAY_BUFFER, sizeof(data), data, GL_STATIC_DRAW);
+    const GLchar* sources[] = {"#version 330 core\n", "void main() {}"};
+    const GLint lengths[] = {-1, 9};
+    glShaderSource(1, 2, sources, lengths);
+    gl::end_capture_frame();
+
+    const GLfloat colour[] = {0.1f, 0.2f, 0.3f, 1.0f};
+    glUniform4fv(glGetUniformLocation(1, "u_color"), 1, colour);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, reinterpret_cast<const void*>(24));
+    gl::end_capture_frame();
+
+    gl::stop_capture();
+    ASSERT_FALSE(gl::capturing());
+    ASSERT_EQ(glad_glGenBuffers, fake_gen_buffers);
+    ASSERT_EQ(gl::capture_stats().calls, 6);
+    ASSERT_EQ(gl::capture_stats().frames, 2);
+    ASSERT_EQ(gl::capture_stats().unknown, 0);
+
+    std::optional<gl::CaptureInfo> info = gl::read_capture_info(path);
+    ASSERT_TRUE(info.has_value());
+    ASSERT_GT(info->functions, 600);
+
+    clear_fakes();
+    install_fakes();
+    next_name = 1;
+    std::optional<gl::ReplayStats> stats = gl::replay_capture(path);
+    ASSERT_TRUE(stats.has_value());
+    ASSERT_EQ(stats->calls, 6);
+    ASSERT_EQ(stats->skipped, 0);
+    ASSERT_EQ(stats->approximated, 0);
+    ASSERT_EQ(stats->diverged, 0);
+    // the loading frame, then the frame with the draw
+    ASSERT_EQ(stats->frames.size(), 2);
+    ASSERT_EQ(stats->functions.size(), 6);
+
+    ASSERT_EQ(buffer_data, std::vector<unsigned char>(data, data + sizeof(data)));
+    ASSERT_EQ(shader_source, "#version 330 core\nvoid main");
+    ASSERT_EQ(uniform_name, "u_color");
+    ASSERT_EQ(uniform_values, std::vector<GLfloat>(colour, colour + 4));
+    ASSERT_EQ(indices, reinterpret_cast<const void*>(24));
+
+    // other names than at capture
+    next_name = 10;
+    stats = gl::replay_capture(path);
+    ASSERT_TRUE(stats.has_value());
+    ASSERT_EQ(stats->diverged, 1);
+
+    // missing entry points are skipped
+    glad_glDrawElements = NULL;
+    stats = gl::replay_capture(path);
+    ASSERT_TRUE(stats.has_value());
+    ASSERT_EQ(stats->skipped, 1);
+
+    clear_fakes();
+    std::filesystem::remove(path);
+}
+
+TEST(CaptureTests, output_test) {
+    std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "learn_opengl_capture_output_test.glcap";
+
+    glad_glReadPixels = fake_read_pixels;
+    glad_glGetIntegerv = fake_get_integerv;
+    ASSERT_TRUE(gl::start_capture(path));
+
+    // several megabytes, written in full on replay
+    std::vector<unsigned char> pixels(1280 * 720 * 4);
+    glReadPixels(0, 0, 1280, 720, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    // as many values as GL_NUM_COMPRESSED_TEXTURE_FORMATS, not known here
+    GLint formats[16];
+    glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats);
+    gl::end_capture_frame();
+
+    gl::stop_capture();
+    ASSERT_EQ(gl::capture_stats().calls, 3);
+    ASSERT_EQ(gl::capture_stats().unknown, 1);
+
+    pixels_written = 0;
+    queried.clear();
+    std::optional<gl::ReplayStats> stats = gl::replay_capture(path);
+    ASSERT_TRUE(stats.has_value());
+    ASSERT_EQ(stats->calls, 2);
+    // not given a buffer that may be too small
+    ASSERT_EQ(stats->skipped, 1);
+    ASSERT_EQ(stats->approximated, 0);
+    ASSERT_EQ(pixels_written, pixels.size());
+    ASSERT_EQ(queried, std::vector<GLenum>{GL_VIEWPORT});
+
+    glad_glReadPixels = NULL;
+    glad_glGetIntegerv = NULL;
+    std::filesystem::remove(path);
+}
+
+TEST(CaptureTests, not_a_capture_test) {
+    ASSERT_FALSE(gl::read_capture_info("shaders/HelloUniforms.vert").has_value());
+    ASSERT_FALSE(gl::replay_capture("shaders/HelloUniforms.vert").has_value());
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include "CompileRecords.hpp"
+
+#include <sstream>
+#include <string>
+
+TEST(CompileRecordsTests, json_test) {
+    std::size_t index = shaders::add_compile_record("a.vert \"b\".frag");
+    shaders::ProgramRecord& r = shaders::compile_record(index);
+    r.program = 7;
+    r.read = std::chrono::microseconds(1500);
+    r.fragment.type = GL_FRAGMENT_SHADER;
+    r.fragment.log = "0:1(1): error: one\n0:2(1): error: two\t\x01";
+    r.link_log = "back\\slash";
+
+    std::ostringstream out;
+    shaders::write_compile_records(out);
+    std::string json = out.str();
+
+    ASSERT_NE(json.find("\"label\": \"a.vert \\\"b\\\".frag\", \"program\": 7, \"read_ms\": 1.5"),
+        std::string::npos);
+    // only the fragment stage was built
+    ASSERT_NE(json.find("\"vertex\": null"), std::string::npos);
+    ASSERT_NE(json.find("\"log\": \"0:1(1): error: one\\n0:2(1): error: two\\t\\u0001\""),
+        std::string::npos);
+    ASSERT_NE(json.find("\"link_log\": \"back\\\\slash\""), std::string::npos);
+    ASSERT_NE(json.find("\"first_use_ms\": null"), std::string::npos);
+    // no context, so no driver strings
+    ASSERT_NE(json.find("\"vendor\": \"\""), std::string::npos);
+}
+
+TEST(CompileRecordsTests, cap_test) {
+    std::size_t first = shaders::add_compile_record("first");
+    shaders::compile_record(first).program = 1;
+
+    // e.g. a long hot reload session
+    std::size_t last = first;
+    for (int i = 0; i < 1100; i++) {
+        last = shaders::add_compile_record("reload " + std::to_string(i));
+    }
+    shaders::compile_record(last).program = 2;
+
+    ASSERT_EQ(shaders::compile_records().size(), 1024u);
+    ASSERT_EQ(shaders::compile_records().back().label, "reload 1099");
+    ASSERT_EQ(shaders::compile_records().back().program, 2u);
+    ASSERT_EQ(shaders::compile_record(last - 1).label, "reload 1098");
+
+    // dropped, writes go nowhere
+    shaders::compile_record(first).program = 3;
+    ASSERT_EQ(shaders::compile_record(first).program, 0u);
+    ASSERT_EQ(shaders::compile_record(first).label, "");
+}
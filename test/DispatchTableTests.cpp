@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include "DispatchTable.hpp"
+#include "StateCache.hpp"
+
+#include <cstring>
+#include <latch>
+#include <thread>
+
+namespace {
+    GLbitfield cleared = 0;
+
+    void APIENTRY fake_clear(GLbitfield mask) {
+        cleared = mask;
+    }
+
+    const GLubyte* APIENTRY fake_get_string(GLenum name) {
+        return reinterpret_cast<const GLubyte*>(name == GL_VERSION ? "3.3.0" : "");
+    }
+
+    // one extension, glad fails a load that finds none
+    void APIENTRY fake_get_integerv(GLenum, GLint* data) {
+        *data = 1;
+    }
+
+    const GLubyte* APIENTRY fake_get_stringi(GLenum, GLuint) {
+        return reinterpret_cast<const GLubyte*>("GL_ARB_fake");
+    }
+
+    void* fake_loader(const char* name) {
+        if (std::strcmp(name, "glGetString") == 0) {
+            return reinterpret_cast<void*>(fake_get_string);
+        }
+        if (std::strcmp(name, "glGetIntegerv") == 0) {
+            return reinterpret_cast<void*>(fake_get_integerv);
+        }
+        if (std::strcmp(name, "glGetStringi") == 0) {
+            return reinterpret_cast<void*>(fake_get_stringi);
+        }
+        if (std::strcmp(name, "glClear") == 0) {
+            return reinterpret_cast<void*>(fake_clear);
+        }
+        return nullptr;
+    }
+
+    // glUseProgram calls that reached the fake driver of this thread
+    thread_local std::size_t use_program_calls = 0;
+
+    void APIENTRY fake_use_program(GLuint) {
+        use_program_calls++;
+    }
+} // namespace
+
+TEST(DispatchTableTests, thread_test) {
+    glad_glClear = fake_clear;
+    GLVersion = {3, 3};
+    GLAD_GL_VERSION_3_3 = 1;
+
+    gl::DispatchTable table;
+    table.capture();
+
+    std::thread worker([&] {
+        // a new thread starts with an empty table
+        EXPECT_EQ(glad_glClear, nullptr);
+        EXPECT_EQ(GLVersion.major, 0);
+        EXPECT_FALSE(GLAD_GL_VERSION_3_3);
+
+        table.make_current();
+        EXPECT_EQ(GLVersion.major, 3);
+        EXPECT_TRUE(GLAD_GL_VERSION_3_3);
+        glClear(GL_DEPTH_BUFFER_BIT);
+
+        gl::DispatchTable::release();
+        EXPECT_EQ(glad_glClear, nullptr);
+    });
+    worker.join();
+
+    ASSERT_EQ(cleared, GL_DEPTH_BUFFER_BIT);
+    // the main thread's table is untouched
+    ASSERT_EQ(glad_glClear, fake_clear);
+
+    gl::DispatchTable::release();
+    ASSERT_EQ(glad_glClear, nullptr);
+    ASSERT_EQ(GLVersion.major, 0);
+    ASSERT_FALSE(GLAD_GL_VERSION_3_3);
+}
+
+TEST(DispatchTableTests, lazy_thread_test) {
+    cleared = 0;
+    ASSERT_TRUE(gladLoadGLLoaderLazy(fake_loader));
+
+    gl::DispatchTable table;
+    table.capture();
+    gl::DispatchTable::release();
+
+    // glClear is still a trampoline, looked up on the worker through the
+    // loader kept in the table
+    std::thread worker([&] {
+        table.make_current();
+        glClear(GL_STENCIL_BUFFER_BIT);
+        EXPECT_EQ(glad_glClear, fake_clear);
+        gl::DispatchTable::release();
+    });
+    worker.join();
+
+    ASSERT_EQ(cleared, GL_STENCIL_BUFFER_BIT);
+    ASSERT_EQ(glad_glClear, nullptr);
+}
+
+TEST(DispatchTableTests, capped_load_test) {
+    // the context reports 3.3
+    ASSERT_TRUE(gladLoadGLLoaderUpTo(fake_loader, 3, 1));
+    ASSERT_EQ(GLVersion.major, 3);
+    ASSERT_EQ(GLVersion.minor, 1);
+    ASSERT_TRUE(GLAD_GL_VERSION_3_1);
+    ASSERT_FALSE(GLAD_GL_VERSION_3_2);
+    ASSERT_FALSE(GLAD_GL_VERSION_3_3);
+    ASSERT_EQ(glad_glClear, fake_clear);
+    gl::DispatchTable::release();
+
+    // a cap above the context changes nothing
+    ASSERT_TRUE(gladLoadGLLoaderUpTo(fake_loader, 4, 6));
+    ASSERT_EQ(GLVersion.major, 3);
+    ASSERT_EQ(GLVersion.minor, 3);
+    ASSERT_TRUE(GLAD_GL_VERSION_3_3);
+    ASSERT_FALSE(GLAD_GL_VERSION_4_0);
+    gl::DispatchTable::release();
+}
+
+TEST(DispatchTableTests, layer_per_thread_test) {
+    // both threads have the cache installed at the same time
+    std::latch installed(2);
+    std::latch checked(2);
+
+    auto worker = [&](GLuint program) {
+        glad_glUseProgram = fake_use_program;
+        gl::install_state_cache();
+        installed.arrive_and_wait();
+
+        // each thread's cache knows only its own calls
+        glUseProgram(program);
+        glUseProgram(program);
+        glUseProgram(program);
+        EXPECT_EQ(use_program_calls, 1u);
+        EXPECT_EQ(gl::state_cache_stats().forwarded, 1u);
+        EXPECT_EQ(gl::state_cache_stats().elided, 2u);
+        checked.arrive_and_wait();
+
+        gl::uninstall_state_cache();
+        EXPECT_EQ(glad_glUseProgram, fake_use_program);
+        glad_glUseProgram = NULL;
+    };
+
+    std::thread first(worker, 1);
+    std::thread second(worker, 2);
+    first.join();
+    second.join();
+
+    // and the main thread has none
+    ASSERT_FALSE(gl::state_cache_installed());
+    ASSERT_EQ(glad_glUseProgram, nullptr);
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+
+#include "Extensions.hpp"
+
+#include <string>
+#include <vector>
+
+TEST(ExtensionsTests, contains_test) {
+    std::vector<std::string> owned;
+    for (int i = 0; i < 100; i++) {
+        owned.push_back("GL_EXT_test_" + std::to_string(i));
+    }
+    std::vector<std::string_view> names(owned.begin(), owned.end());
+    names.push_back("GL_KHR_parallel_shader_compile");
+    names.push_back("GL_EXT_test_7");
+    names.push_back("");
+
+    gl::ExtensionSet set(names);
+    owned.clear();
+
+    // the duplicate and the empty name are dropped
+    ASSERT_EQ(set.size(), 101);
+    ASSERT_TRUE(set.contains("GL_KHR_parallel_shader_compile"));
+    ASSERT_TRUE(set.contains("GL_EXT_test_0"));
+    ASSERT_TRUE(set.contains("GL_EXT_test_99"));
+    ASSERT_FALSE(set.contains("GL_EXT_test_100"));
+    ASSERT_FALSE(set.contains("GL_EXT_test"));
+    ASSERT_FALSE(set.contains("GL_KHR_parallel_shader_compile "));
+    ASSERT_FALSE(set.contains(""));
+}
+
+TEST(ExtensionsTests, empty_test) {
+    gl::ExtensionSet set;
+    ASSERT_EQ(set.size(), 0);
+    ASSERT_FALSE(set.contains("GL_ARB_debug_output"));
+    // no context
+    ASSERT_FALSE(gl::has_extension("GL_ARB_debug_output"));
+}
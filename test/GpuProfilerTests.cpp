@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include "GpuProfiler.hpp"
+
+#include <map>
+#include <string_view>
+
+namespace {
+    // a GPU clock that advances 100 ns per query written
+    GLuint next_query = 1;
+    GLuint64 gpu_clock = 0;
+    std::map<GLuint, GLuint64> timestamps;
+    bool available = false;
+
+    void APIENTRY fake_gen_queries(GLsizei n, GLuint* ids) {
+        for (GLsizei i = 0; i < n; i++) {
+            ids[i] = next_query++;
+        }
+    }
+
+    void APIENTRY fake_delete_queries(GLsizei, const GLuint*) {}
+
+    void APIENTRY fake_query_counter(GLuint id, GLenum) {
+        gpu_clock += 100;
+        timestamps[id] = gpu_clock;
+    }
+
+    void APIENTRY fake_get_query_objectiv(GLuint, GLenum, GLint* params) {
+        *params = available;
+    }
+
+    void APIENTRY fake_get_query_objectui64v(GLuint id, GLenum, GLuint64* params) {
+        *params = timestamps[id];
+    }
+} // namespace
+
+TEST(GpuProfilerTests, tree_test) {
+    glad_glGenQueries = fake_gen_queries;
+    glad_glDeleteQueries = fake_delete_queries;
+    glad_glQueryCounter = fake_query_counter;
+    glad_glGetQueryObjectiv = fake_get_query_objectiv;
+    glad_glGetQueryObjectui64v = fake_get_query_objectui64v;
+    GLAD_GL_VERSION_3_3 = 1;
+
+    {
+        gl::GpuProfiler profiler(2);
+        ASSERT_TRUE(profiler.supported());
+
+        auto frame = [&] {
+            gl::GpuScope outer(profiler, "frame");
+            {
+                gl::GpuScope shadows(profiler, "shadows");
+            }
+            gl::GpuScope opaque(profiler, "opaque");
+            gl::GpuScope sky(profiler, "sky");
+        };
+
+        frame();
+        profiler.end_frame();
+        frame();
+        profiler.end_frame();
+        frame();
+        profiler.end_frame();
+        // nothing is read back before it is 2 frames old and available
+        ASSERT_EQ(profiler.last_frame(), nullptr);
+        ASSERT_EQ(profiler.pending(), 3u);
+
+        available = true;
+        frame();
+        profiler.end_frame();
+        ASSERT_EQ(profiler.pending(), 2u);
+
+        const gl::GpuFrame* last = profiler.last_frame();
+        ASSERT_NE(last, nullptr);
+        ASSERT_EQ(last->frame, 1u);
+        ASSERT_EQ(last->passes.size(), 4u);
+        ASSERT_STREQ(last->passes[0].name, "frame");
+        ASSERT_EQ(last->passes[0].parent, -1);
+        ASSERT_STREQ(last->passes[1].name, "shadows");
+        ASSERT_EQ(last->passes[1].parent, 0);
+        ASSERT_EQ(last->passes[3].depth, 2u);
+        ASSERT_EQ(last->passes[3].parent, 2);
+
+        // frame, shadows, shadows end, opaque, sky, sky end, opaque end,
+        // frame end: 100 ns apart
+        ASSERT_EQ(last->passes[0].time.count(), 700);
+        ASSERT_EQ(last->passes[1].time.count(), 100);
+        ASSERT_EQ(last->passes[2].start.count(), 300);
+        ASSERT_EQ(last->passes[2].time.count(), 300);
+        ASSERT_EQ(last->time.count(), 700);
+
+        std::vector<gl::GpuPassStats> stats = profiler.stats();
+        ASSERT_EQ(stats.size(), 4u);
+        ASSERT_EQ(stats[0].name, "frame");
+        ASSERT_EQ(stats[0].samples, 2u);
+        ASSERT_EQ(stats[0].avg.count(), 700);
+        ASSERT_EQ(stats[3].name, "sky");
+        ASSERT_EQ(stats[3].depth, 2u);
+        ASSERT_EQ(stats[3].p99.count(), 100);
+
+        // an unclosed marker is ended with the frame
+        profiler.begin("open");
+        profiler.end_frame();
+        ASSERT_EQ(profiler.pending(), 2u);
+    }
+
+    glad_glGenQueries = NULL;
+    glad_glDeleteQueries = NULL;
+    glad_glQueryCounter = NULL;
+    glad_glGetQueryObjectiv = NULL;
+    glad_glGetQueryObjectui64v = NULL;
+    GLAD_GL_VERSION_3_3 = 0;
+}
@@ -0,0 +1,294 @@
+#include <gtest/gtest.h>
+
+#include "NullBackend.hpp"
+#include "Reflection.hpp"
+#include "Shaders.hpp"
+#include "UniformBuffers.hpp"
+#include "bindings/HelloUniforms.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+TEST(NullBackendTests, shader_test) {
+    gl::load_null_backend();
+    ASSERT_TRUE(gl::null_backend_loaded());
+    ASSERT_TRUE(GLAD_GL_VERSION_4_6);
+
+    namespace program = shaders::bindings::HelloUniforms;
+    shaders::Shader shader(program::vert_path, program::frag_path);
+    ASSERT_NE(shader.id, 0u);
+
+    const shaders::Reflection& r = shader.reflection();
+    ASSERT_EQ(r.attributes.size(), 1u);
+    ASSERT_EQ(r.attributes[0].name, "aPos");
+    ASSERT_EQ(r.attributes[0].type, GL_FLOAT_VEC3);
+    ASSERT_EQ(r.attributes[0].location, 0);
+    ASSERT_EQ(r.uniforms.size(), 1u);
+    ASSERT_EQ(r.uniforms[0].type, GL_FLOAT_VEC4);
+    ASSERT_GE(shader.uniform_location(program::u_color), 0);
+
+    const shaders::VertexFormat format{3 * sizeof(float), {{"aPos", 3}}};
+    ASSERT_TRUE(shader.vertex_layout(format).valid);
+
+    GLuint vao;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    shader.set_vec4(program::u_color, 0, 1, 0, 0);
+    shader.use();
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    ASSERT_EQ(gl::null_backend_stats().draws, 2u);
+
+    GLint bound = 0;
+    glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &bound);
+    ASSERT_EQ(GLuint(bound), vao);
+    glDeleteVertexArrays(1, &vao);
+    ASSERT_FALSE(glIsVertexArray(vao));
+
+    gl::unload_null_backend();
+    ASSERT_FALSE(gl::null_backend_loaded());
+    ASSERT_EQ(glad_glDrawArrays, nullptr);
+}
+
+TEST(NullBackendTests, reflection_test) {
+    gl::load_null_backend();
+
+    const char* vert =
+        "#version 330 core\n"
+        "layout (location = 2) in vec3 aPos;\n"
+        "in mat4 aModel; /* takes 4 locations */\n"
+        "layout (std140) uniform Frame {\n"
+        "    mat4 view;\n"
+        "    mat4 projection;\n"
+        "    vec4 camera_position;\n"
+        "    float time;\n"
+        "    float delta_time;\n"
+        "};\n"
+        "uniform float u_weights[4];\n"
+        "void main() {\n"
+        "    gl_Position = vec4(aPos, u_weights[1]);\n"
+        "}\n";
+    GLuint shader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(shader, 1, &vert, NULL);
+    glCompileShader(shader);
+    GLuint prgm = glCreateProgram();
+    glAttachShader(prgm, shader);
+    glLinkProgram(prgm);
+    glDeleteShader(shader);
+
+    shaders::Reflection r = shaders::reflect(prgm);
+    ASSERT_EQ(r.attributes.size(), 2u);
+    ASSERT_EQ(r.attributes[0].location, 2);
+    ASSERT_EQ(r.attributes[1].name, "aModel");
+    ASSERT_EQ(r.attributes[1].location, 3);
+
+    ASSERT_EQ(r.uniforms.size(), 1u);
+    ASSERT_EQ(r.uniforms[0].name, "u_weights[0]");
+    ASSERT_EQ(r.uniforms[0].size, 4);
+    GLint base = glGetUniformLocation(prgm, "u_weights");
+    ASSERT_EQ(glGetUniformLocation(prgm, "u_weights[3]"), base + 3);
+    ASSERT_EQ(glGetUniformLocation(prgm, "u_weights[4]"), -1);
+
+    // the block matches the C++ side
+    ASSERT_EQ(r.blocks.size(), 1u);
+    ASSERT_EQ(r.blocks[0].name, "Frame");
+    ASSERT_EQ(r.blocks[0].data_size, GLint(sizeof(shaders::FrameUniforms)));
+
+    gl::unload_null_backend();
+}
+
+TEST(NullBackendTests, buffer_test) {
+    gl::load_null_backend();
+
+    const char data[] = "null backend";
+    GLuint buffer;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(data), data, GL_DYNAMIC_DRAW);
+    ASSERT_EQ(gl::null_backend_stats().bytes, sizeof(data));
+
+    void* mapped = glMapBufferRange(GL_UNIFORM_BUFFER, 5, 7, GL_MAP_WRITE_BIT);
+    ASSERT_NE(mapped, nullptr);
+    std::memcpy(mapped, "BACKEND", 7);
+    ASSERT_TRUE(glUnmapBuffer(GL_UNIFORM_BUFFER));
+    ASSERT_EQ(glMapBufferRange(GL_UNIFORM_BUFFER, 8, 8, GL_MAP_WRITE_BIT), nullptr);
+
+    char read[sizeof(data)] = {};
+    glGetBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(read), read);
+    ASSERT_STREQ(read, "null BACKEND");
+
+    GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    ASSERT_NE(fence, nullptr);
+    ASSERT_EQ(glClientWaitSync(fence, 0, 0), GLenum(GL_ALREADY_SIGNALED));
+
+    gl::unload_null_backend();
+}
+
+namespace {
+    // fences the ring made, waited on and deleted
+    struct Fences {
+        std::size_t made = 0;
+        std::size_t waits = 0;
+        std::size_t deleted = 0;
+    };
+
+    Fences fences;
+
+    GLsync APIENTRY counting_fence_sync(GLenum, GLbitfield) {
+        return reinterpret_cast<GLsync>(++fences.made);
+    }
+
+    GLenum APIENTRY counting_client_wait_sync(GLsync, GLbitfield, GLuint64) {
+        fences.waits++;
+        return GL_ALREADY_SIGNALED;
+    }
+
+    void APIENTRY counting_delete_sync(GLsync) {
+        fences.deleted++;
+    }
+
+    // the last range bound to each uniform buffer binding point
+    std::vector<shaders::UniformRange> bound(8);
+
+    void APIENTRY recording_bind_buffer_range(
+        GLenum, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size
+    ) {
+        bound.at(index) = {buffer, offset, size};
+    }
+
+    GLint max_bindings = 0;
+
+    void APIENTRY fake_max_bindings(GLenum, GLint* data) {
+        *data = max_bindings;
+    }
+} // namespace
+
+TEST(NullBackendTests, uniform_ring_test) {
+    gl::load_null_backend();
+    glad_glFenceSync = counting_fence_sync;
+    glad_glClientWaitSync = counting_client_wait_sync;
+    glad_glDeleteSync = counting_delete_sync;
+    glad_glBindBufferRange = recording_bind_buffer_range;
+    fences = {};
+
+    {
+        // regions are rounded up to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+        shaders::UniformRing ring(1000, 3);
+        ASSERT_TRUE(ring.persistent());
+
+        ring.begin_frame();
+        shaders::FrameUniforms frame{};
+        frame.time = 1.5f;
+        ring.set_frame(frame);
+        ASSERT_EQ(bound[shaders::FRAME_BINDING].offset, 1024);
+        ASSERT_EQ(bound[shaders::FRAME_BINDING].size, GLsizeiptr(sizeof(frame)));
+        ASSERT_EQ(ring.used(), 256u);
+
+        // blocks start on aligned offsets within the frame's region
+        std140::vec4 colour{0, 1, 0, 1};
+        shaders::UniformRange range = ring.write(colour);
+        ASSERT_EQ(range.offset, 1024 + 256);
+        ASSERT_EQ(ring.used(), 512u);
+
+        // mapped writes reach the buffer
+        float read[4] = {};
+        glBindBuffer(GL_UNIFORM_BUFFER, range.buffer);
+        glGetBufferSubData(GL_UNIFORM_BUFFER, range.offset, sizeof(read), read);
+        ASSERT_EQ(read[1], 1.0f);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+        // a fence per frame, waited on when the ring comes back to its region
+        ring.end_frame();
+        ring.begin_frame();
+        ASSERT_EQ(ring.used(), 0u);
+        ASSERT_EQ(ring.write(colour).offset, 2048);
+        ring.end_frame();
+        ASSERT_EQ(fences.made, 2u);
+        ASSERT_EQ(fences.waits, 0u);
+
+        ring.begin_frame();
+        ASSERT_EQ(ring.write(colour).offset, 0);
+        ring.end_frame();
+        ring.begin_frame();
+        ASSERT_EQ(ring.write(colour).offset, 1024);
+        ASSERT_EQ(fences.made, 3u);
+        ASSERT_EQ(fences.waits, 1u);
+        ASSERT_EQ(fences.deleted, 1u);
+        ring.end_frame();
+    }
+    // the ones left are deleted with the ring
+    ASSERT_EQ(fences.deleted, 4u);
+
+    gl::unload_null_backend();
+}
+
+TEST(NullBackendTests, uniform_ring_full_test) {
+    gl::load_null_backend();
+    glad_glBindBufferRange = recording_bind_buffer_range;
+    bound.assign(bound.size(), {});
+
+    {
+        shaders::UniformRing ring(256, 2);
+        ring.begin_frame();
+        shaders::FrameUniforms frame{};
+        ASSERT_EQ(ring.write(frame).size, GLsizeiptr(sizeof(frame)));
+
+        // nothing is written or bound once the region is full
+        ASSERT_EQ(ring.write(frame).size, 0);
+        ring.set_frame(frame);
+        ASSERT_EQ(bound[shaders::FRAME_BINDING].buffer, 0u);
+        ASSERT_EQ(ring.used(), 256u);
+
+        // until the next frame
+        ring.end_frame();
+        ring.begin_frame();
+        ring.set_frame(frame);
+        ASSERT_EQ(bound[shaders::FRAME_BINDING].offset, 0);
+        ASSERT_NE(bound[shaders::FRAME_BINDING].buffer, 0u);
+    }
+
+    gl::unload_null_backend();
+}
+
+TEST(NullBackendTests, uniform_ring_fallback_test) {
+    gl::load_null_backend();
+    // no GL 4.4, so no buffer storage
+    GLAD_GL_VERSION_4_4 = 0;
+
+    {
+        shaders::UniformRing ring(256, 2);
+        ASSERT_FALSE(ring.persistent());
+        std::uint64_t bytes = gl::null_backend_stats().bytes;
+
+        ring.begin_frame();
+        std140::vec4 colour{1, 0, 1, 0};
+        shaders::UniformRange range = ring.write(colour);
+        ASSERT_EQ(range.offset, 256);
+        ASSERT_EQ(gl::null_backend_stats().bytes, bytes + sizeof(colour));
+
+        float read[4] = {};
+        glBindBuffer(GL_UNIFORM_BUFFER, range.buffer);
+        glGetBufferSubData(GL_UNIFORM_BUFFER, range.offset, sizeof(read), read);
+        ASSERT_EQ(read[2], 1.0f);
+    }
+
+    gl::unload_null_backend();
+}
+
+TEST(NullBackendTests, block_binding_test) {
+    gl::load_null_backend();
+
+    ASSERT_EQ(shaders::block_binding(shaders::FRAME_BLOCK), shaders::FRAME_BINDING);
+    GLuint binding = shaders::block_binding("NullBackendTestsBlock");
+    ASSERT_NE(binding, GL_INVALID_INDEX);
+    ASSERT_EQ(shaders::block_binding("NullBackendTestsBlock"), binding);
+
+    // a driver with no binding left for another name
+    max_bindings = GLint(binding) + 1;
+    glad_glGetIntegerv = fake_max_bindings;
+    ASSERT_EQ(shaders::block_binding("NullBackendTestsFull"), GL_INVALID_INDEX);
+    ASSERT_EQ(shaders::block_binding("NullBackendTestsBlock"), binding);
+
+    gl::unload_null_backend();
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include "NullBackend.hpp"
+#include "PipelineCache.hpp"
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+
+namespace {
+    PFNGLLINKPROGRAMPROC null_link_program = nullptr;
+    // programs linked, once per stage when nothing is linked twice
+    std::size_t links = 0;
+    // the programs glUseProgramStages put in each pipeline
+    std::map<GLuint, std::pair<GLuint, GLuint>> stages_of;
+
+    void APIENTRY fake_link_program(GLuint prgm) {
+        links++;
+        null_link_program(prgm);
+    }
+
+    void APIENTRY fake_use_program_stages(GLuint pipeline, GLbitfield stages, GLuint prgm) {
+        if (stages & GL_VERTEX_SHADER_BIT) {
+            stages_of[pipeline].first = prgm;
+        }
+        if (stages & GL_FRAGMENT_SHADER_BIT) {
+            stages_of[pipeline].second = prgm;
+        }
+    }
+
+    void load_fakes() {
+        gl::load_null_backend();
+        null_link_program = glad_glLinkProgram;
+        glad_glLinkProgram = fake_link_program;
+        glad_glUseProgramStages = fake_use_program_stages;
+        links = 0;
+        stages_of.clear();
+    }
+
+    std::string vert(int n) {
+        return "#version 410 core\n"
+            "layout (location = 0) in vec3 aPos;\n"
+            "out gl_PerVertex { vec4 gl_Position; };\n"
+            "void main() {\n"
+            "    gl_Position = vec4(aPos * " + std::to_string(n) + ".0, 1.0);\n"
+            "}\n";
+    }
+
+    std::string frag(int n) {
+        return "#version 410 core\n"
+            "out vec4 colour;\n"
+            "void main() {\n"
+            "    colour = vec4(" + std::to_string(n) + ".0);\n"
+            "}\n";
+    }
+} // namespace
+
+TEST(PipelineCacheTests, stage_dedup_test) {
+    load_fakes();
+    {
+        shaders::PipelineCache cache;
+        ASSERT_TRUE(cache.supported());
+
+        std::size_t verts[] = {
+            cache.add_stage_source(GL_VERTEX_SHADER, vert(1), "v1"),
+            cache.add_stage_source(GL_VERTEX_SHADER, vert(2), "v2"),
+        };
+        std::size_t frags[] = {
+            cache.add_stage_source(GL_FRAGMENT_SHADER, frag(1), "f1"),
+            cache.add_stage_source(GL_FRAGMENT_SHADER, frag(2), "f2"),
+            cache.add_stage_source(GL_FRAGMENT_SHADER, frag(3), "f3"),
+        };
+        ASSERT_EQ(cache.size(), 5u);
+        ASSERT_EQ(links, 5u);
+
+        for (std::size_t index = 0; index < cache.size(); index++) {
+            GLint separable = GL_FALSE;
+            glGetProgramiv(cache.stage(index).id, GL_PROGRAM_SEPARABLE, &separable);
+            ASSERT_TRUE(separable);
+        }
+
+        // M + N links for all M x N pairs
+        for (std::size_t v : verts) {
+            for (std::size_t f : frags) {
+                ASSERT_NE(cache.pipeline(v, f), 0u);
+            }
+        }
+        ASSERT_EQ(links, 5u);
+        ASSERT_EQ(cache.stats().stages, 5u);
+        ASSERT_EQ(cache.stats().pipelines, 6u);
+    }
+    gl::unload_null_backend();
+}
+
+TEST(PipelineCacheTests, pipeline_per_pair_test) {
+    load_fakes();
+    {
+        shaders::PipelineCache cache;
+        std::size_t v1 = cache.add_stage_source(GL_VERTEX_SHADER, vert(1), "v1");
+        std::size_t v2 = cache.add_stage_source(GL_VERTEX_SHADER, vert(2), "v2");
+        std::size_t f1 = cache.add_stage_source(GL_FRAGMENT_SHADER, frag(1), "f1");
+
+        GLuint first = cache.pipeline(v1, f1);
+        GLuint second = cache.pipeline(v2, f1);
+        ASSERT_NE(first, 0u);
+        ASSERT_NE(second, 0u);
+        ASSERT_NE(first, second);
+        ASSERT_EQ(stages_of[first], std::make_pair(cache.stage(v1).id, cache.stage(f1).id));
+        ASSERT_EQ(stages_of[second], std::make_pair(cache.stage(v2).id, cache.stage(f1).id));
+
+        // asked for again, the same object
+        ASSERT_EQ(cache.pipeline(v1, f1), first);
+        ASSERT_EQ(cache.stats().pipelines, 2u);
+        ASSERT_EQ(cache.stats().hits, 1u);
+
+        cache.use(v2, f1);
+        GLint bound = 0;
+        glGetIntegerv(GL_PROGRAM_PIPELINE_BINDING, &bound);
+        ASSERT_EQ(GLuint(bound), second);
+        ASSERT_EQ(cache.stats().hits, 2u);
+
+        // stages the wrong way round give no pipeline, once
+        ASSERT_EQ(cache.pipeline(f1, v1), 0u);
+        ASSERT_EQ(cache.pipeline(f1, v1), 0u);
+        ASSERT_EQ(cache.stats().pipelines, 2u);
+        ASSERT_EQ(cache.stats().hits, 3u);
+        ASSERT_EQ(stages_of.size(), 2u);
+    }
+    gl::unload_null_backend();
+}
+
+TEST(PipelineCacheTests, unsupported_test) {
+    load_fakes();
+    ASSERT_TRUE(shaders::pipelines_supported());
+
+    // a GL 3.3 context
+    GLAD_GL_VERSION_4_1 = 0;
+    ASSERT_FALSE(shaders::pipelines_supported());
+    {
+        shaders::PipelineCache cache;
+        ASSERT_FALSE(cache.supported());
+
+        // stages are still indexed, but nothing is built
+        std::size_t v = cache.add_stage_source(GL_VERTEX_SHADER, vert(1), "v1");
+        std::size_t f = cache.add_stage_source(GL_FRAGMENT_SHADER, frag(1), "f1");
+        ASSERT_EQ(cache.size(), 2u);
+        ASSERT_EQ(cache.stage(v).id, 0u);
+        ASSERT_EQ(cache.stage(f).id, 0u);
+        ASSERT_EQ(links, 0u);
+
+        ASSERT_EQ(cache.pipeline(v, f), 0u);
+        cache.use(v, f);
+        ASSERT_EQ(cache.stats().pipelines, 0u);
+        ASSERT_TRUE(stages_of.empty());
+    }
+
+    // or a driver that does not give out the entry point
+    GLAD_GL_VERSION_4_1 = 1;
+    glad_glGenProgramPipelines = nullptr;
+    ASSERT_FALSE(shaders::pipelines_supported());
+    {
+        shaders::PipelineCache cache;
+        ASSERT_FALSE(cache.supported());
+    }
+    gl::unload_null_backend();
+}
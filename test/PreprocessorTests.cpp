@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include "Preprocessor.hpp"
+#include "Sources.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace {
+    class PreprocessorTests : public ::testing::Test {
+    protected:
+        std::filesystem::path dir;
+
+        void SetUp() override {
+            dir = std::filesystem::temp_directory_path() / "learn_opengl_preprocessor_tests";
+            std::filesystem::create_directories(dir / "common");
+
+            write("common/Colour.glsl",
+                "#pragma once\n"
+                "vec4 colour() {\n"
+                "    return vec4(1.0);\n"
+                "}\n");
+            write("Main.frag",
+                "#version 330 core\n"
+                "#include \"common/Colour.glsl\"\n"
+                "#include <common/Colour.glsl>\n"
+                "out vec4 frag_colour;\n"
+                "void main() {\n"
+                "    frag_colour = colour();\n"
+                "}\n");
+        }
+
+        void TearDown() override {
+            std::filesystem::remove_all(dir);
+        }
+
+        void write(const char* name, const char* text) {
+            std::ofstream file(dir / name);
+            file << text;
+        }
+    };
+} // namespace
+
+TEST_F(PreprocessorTests, include_test) {
+    shaders::Preprocessor preprocessor(dir);
+    std::string path = (dir / "Main.frag").string();
+
+    const shaders::PreprocessedSource& out = preprocessor.process(path);
+
+    const std::string expected =
+        "#version 330 core\n"
+        "#line 1 0\n"
+        "#line 2 0\n"
+        "#line 1 1\n"
+        "vec4 colour() {\n"
+        "    return vec4(1.0);\n"
+        "}\n"
+        "#line 3 0\n"
+        "#line 4 0\n"
+        "out vec4 frag_colour;\n"
+        "void main() {\n"
+        "    frag_colour = colour();\n"
+        "}\n";
+
+    ASSERT_EQ(out.code, expected);
+    ASSERT_EQ(out.files.size(), 2u);
+    ASSERT_EQ(out.files[0], path);
+    ASSERT_EQ(out.files[1], (dir / "common/Colour.glsl").string());
+}
+
+TEST_F(PreprocessorTests, variant_test) {
+    shaders::Preprocessor preprocessor(dir);
+    std::string path = (dir / "Main.frag").string();
+
+    std::vector<shaders::Variant> variants = shaders::permutations({"FOG", "SHADOWS"});
+    ASSERT_EQ(variants.size(), 4u);
+
+    std::vector<const shaders::PreprocessedSource*> out =
+        preprocessor.process_all(path, variants);
+
+    ASSERT_EQ(out[0]->code.find("#define"), std::string::npos);
+    ASSERT_EQ(out[3]->code.rfind("#version 330 core\n#define FOG 1\n#define SHADOWS 1\n", 0), 0u);
+
+    // same defines in another order share a key and the cached text
+    shaders::Variant swapped{{{"SHADOWS", "1"}, {"FOG", "1"}}};
+    ASSERT_EQ(swapped.key(), variants[3].key());
+    ASSERT_EQ(&preprocessor.process(path, swapped), out[3]);
+    ASSERT_NE(variants[1].key(), variants[2].key());
+}
+
+TEST(PreprocessorEmbeddedTests, relative_include_test) {
+#ifndef LEARN_OPENGL_EMBED_SHADERS
+    GTEST_SKIP() << "built with LEARN_OPENGL_EMBED_SHADERS off";
+#endif
+    bool from_disk = shaders::disk_sources();
+    shaders::set_disk_sources(false);
+    std::filesystem::path cwd = std::filesystem::current_path();
+    std::filesystem::current_path(std::filesystem::temp_directory_path());
+
+    // "common/Frame.glsl" is next to the including file, not under the root,
+    // and there is no shaders/ on disk from here
+    shaders::Preprocessor preprocessor("does_not_exist");
+    const shaders::PreprocessedSource& out =
+        preprocessor.process("shaders/HelloFrame.vert");
+
+    std::filesystem::current_path(cwd);
+    shaders::set_disk_sources(from_disk);
+
+    ASSERT_NE(out.code.find("uniform Frame"), std::string::npos);
+    ASSERT_EQ(out.files.size(), 2u);
+    ASSERT_EQ(out.files[1], "shaders/common/Frame.glsl");
+}
+
+TEST(PreprocessorRemapTests, remap_log_test) {
+    std::vector<std::string> files = {"Main.frag", "common/Colour.glsl"};
+
+    ASSERT_EQ(
+        shaders::remap_log("1:2(5): error: x\n0(7) : error C0000\n9:1: x", files),
+        "common/Colour.glsl:2(5): error: x\nMain.frag(7) : error C0000\n9:1: x"
+    );
+}
@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+
+#include "NullBackend.hpp"
+#include "ProgramCache.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+
+namespace {
+    // the null backend has no binary formats, these add one
+    PFNGLGETINTEGERVPROC null_get_integerv = nullptr;
+    PFNGLGETPROGRAMIVPROC null_get_programiv = nullptr;
+    const char* driver_version = "4.6 (Core Profile) null";
+    bool accept_binaries = true;
+    // programs created from a binary the fake driver accepted
+    std::set<GLuint> loaded;
+
+    constexpr const char BINARY[] = "binary";
+
+    void APIENTRY fake_get_integerv(GLenum pname, GLint* data) {
+        if (pname == GL_NUM_PROGRAM_BINARY_FORMATS) {
+            *data = 1;
+        } else {
+            null_get_integerv(pname, data);
+        }
+    }
+
+    void APIENTRY fake_get_programiv(GLuint prgm, GLenum pname, GLint* params) {
+        if (pname == GL_PROGRAM_BINARY_LENGTH) {
+            *params = sizeof(BINARY);
+        } else if (pname == GL_LINK_STATUS && loaded.contains(prgm)) {
+            *params = GL_TRUE;
+        } else {
+            null_get_programiv(prgm, pname, params);
+        }
+    }
+
+    void APIENTRY fake_get_program_binary(
+        GLuint, GLsizei size, GLsizei* length, GLenum* format, void* binary
+    ) {
+        std::memcpy(binary, BINARY, std::min<GLsizei>(size, sizeof(BINARY)));
+        *length = sizeof(BINARY);
+        *format = 1;
+    }
+
+    void APIENTRY fake_program_binary(
+        GLuint prgm, GLenum format, const void* binary, GLsizei length
+    ) {
+        if (accept_binaries && format == 1 && length == sizeof(BINARY)
+            && std::memcmp(binary, BINARY, length) == 0) {
+            loaded.insert(prgm);
+        }
+    }
+
+    const GLubyte* APIENTRY fake_get_string(GLenum name) {
+        const char* str = name == GL_VERSION ? driver_version : "null";
+        return reinterpret_cast<const GLubyte*>(str);
+    }
+
+    void load_fakes() {
+        gl::load_null_backend();
+        null_get_integerv = glad_glGetIntegerv;
+        null_get_programiv = glad_glGetProgramiv;
+        glad_glGetIntegerv = fake_get_integerv;
+        glad_glGetProgramiv = fake_get_programiv;
+        glad_glGetProgramBinary = fake_get_program_binary;
+        glad_glProgramBinary = fake_program_binary;
+        glad_glGetString = fake_get_string;
+        driver_version = "4.6 (Core Profile) null";
+        accept_binaries = true;
+        loaded.clear();
+    }
+
+    GLuint linked_program() {
+        GLuint prgm = glCreateProgram();
+        glLinkProgram(prgm);
+        return prgm;
+    }
+
+    std::filesystem::path entry_of(const std::filesystem::path& dir) {
+        for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+            return entry.path();
+        }
+        return {};
+    }
+} // namespace
+
+TEST(ProgramCacheTests, hit_and_miss_test) {
+    std::filesystem::path dir =
+        std::filesystem::temp_directory_path() / "learn_opengl_program_cache_test";
+    std::filesystem::remove_all(dir);
+    load_fakes();
+
+    shaders::ProgramCache cache(dir);
+    ASSERT_TRUE(cache.supported());
+    std::uint64_t key = cache.key("void main() {}", "out vec4 c; void main() {}");
+
+    ASSERT_EQ(cache.load(key), 0u);
+    ASSERT_EQ(cache.stats().misses, 1u);
+
+    cache.store(key, linked_program(), std::chrono::milliseconds(5));
+    ASSERT_EQ(cache.stats().stored, 1u);
+
+    GLuint prgm = cache.load(key);
+    ASSERT_NE(prgm, 0u);
+    ASSERT_TRUE(loaded.contains(prgm));
+    ASSERT_EQ(cache.stats().hits, 1u);
+    ASSERT_EQ(cache.stats().rejected, 0u);
+
+    // programs that failed to link are not stored
+    cache.store(cache.key("a", "b"), glCreateProgram(), std::chrono::milliseconds(5));
+    ASSERT_EQ(cache.stats().stored, 1u);
+
+    gl::unload_null_backend();
+    std::filesystem::remove_all(dir);
+}
+
+TEST(ProgramCacheTests, key_test) {
+    std::filesystem::path dir =
+        std::filesystem::temp_directory_path() / "learn_opengl_program_cache_test";
+    load_fakes();
+
+    shaders::ProgramCache cache(dir);
+    std::uint64_t key = cache.key("vert", "frag");
+    ASSERT_EQ(cache.key("vert", "frag"), key);
+    ASSERT_NE(cache.key("vert ", "frag"), key);
+    ASSERT_NE(cache.key("vert", "frag "), key);
+    // text moved from one stage to the other
+    ASSERT_NE(cache.key("ver", "tfrag"), key);
+
+    // a driver update
+    driver_version = "4.6 (Core Profile) null 2";
+    shaders::ProgramCache updated(dir);
+    ASSERT_NE(updated.key("vert", "frag"), key);
+
+    gl::unload_null_backend();
+    std::filesystem::remove_all(dir);
+}
+
+TEST(ProgramCacheTests, rejected_test) {
+    std::filesystem::path dir =
+        std::filesystem::temp_directory_path() / "learn_opengl_program_cache_test";
+    std::filesystem::remove_all(dir);
+    load_fakes();
+
+    shaders::ProgramCache cache(dir);
+    std::uint64_t key = cache.key("vert", "frag");
+    cache.store(key, linked_program(), std::chrono::milliseconds(5));
+    std::filesystem::path entry = entry_of(dir);
+    ASSERT_TRUE(std::filesystem::exists(entry));
+
+    // the driver no longer takes its own binary
+    accept_binaries = false;
+    ASSERT_EQ(cache.load(key), 0u);
+    ASSERT_EQ(cache.stats().rejected, 1u);
+    ASSERT_FALSE(std::filesystem::exists(entry));
+
+    gl::unload_null_backend();
+    std::filesystem::remove_all(dir);
+}
+
+TEST(ProgramCacheTests, corrupt_test) {
+    std::filesystem::path dir =
+        std::filesystem::temp_directory_path() / "learn_opengl_program_cache_test";
+    std::filesystem::remove_all(dir);
+    load_fakes();
+
+    shaders::ProgramCache cache(dir);
+    std::uint64_t key = cache.key("vert", "frag");
+    cache.store(key, linked_program(), std::chrono::milliseconds(5));
+    std::filesystem::path entry = entry_of(dir);
+    std::uintmax_t size = std::filesystem::file_size(entry);
+
+    // truncated
+    std::filesystem::resize_file(entry, size - 2);
+    ASSERT_EQ(cache.load(key), 0u);
+    ASSERT_EQ(cache.stats().rejected, 1u);
+    ASSERT_FALSE(std::filesystem::exists(entry));
+
+    // a length far past the end of the file, after the magic, version, key
+    // and format
+    cache.store(key, linked_program(), std::chrono::milliseconds(5));
+    {
+        std::fstream file(entry, std::ios::binary | std::ios::in | std::ios::out);
+        std::uint32_t length = 0xfffffff0;
+        file.seekp(20);
+        file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    }
+    ASSERT_EQ(cache.load(key), 0u);
+    ASSERT_EQ(cache.stats().rejected, 2u);
+    ASSERT_FALSE(std::filesystem::exists(entry));
+
+    // and stored again after
+    cache.store(key, linked_program(), std::chrono::milliseconds(5));
+    ASSERT_NE(cache.load(key), 0u);
+
+    gl::unload_null_backend();
+    std::filesystem::remove_all(dir);
+}
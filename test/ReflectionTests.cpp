@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include "Reflection.hpp"
+
+namespace {
+    shaders::Reflection mesh_program() {
+        shaders::Reflection r;
+        r.attributes = {
+            {"aPos", 0, GL_FLOAT_VEC3, 1},
+            {"aCol", 1, GL_FLOAT_VEC4, 1},
+            {"aModel", 2, GL_FLOAT_MAT4, 1},
+            {"gl_VertexID", -1, GL_INT, 1},
+        };
+        return r;
+    }
+} // namespace
+
+TEST(ReflectionTests, match_vertex_format_test) {
+    const shaders::VertexFormat format{
+        80,
+        {
+            {"aModel", 16, GL_FLOAT, false, 16},
+            {"aPos", 3},
+            // fewer components than a vec4 is allowed
+            {"aCol", 3, GL_UNSIGNED_BYTE, true, 12},
+            {"aUnused", 2},
+        },
+    };
+
+    shaders::VertexLayout layout = shaders::match_vertex_format(mesh_program(), format);
+
+    ASSERT_TRUE(layout.valid);
+    // one location per matrix column, sorted by location
+    ASSERT_EQ(layout.bindings.size(), 6u);
+    ASSERT_EQ(layout.bindings[0].location, 0u);
+    ASSERT_EQ(layout.bindings[1].location, 1u);
+    ASSERT_TRUE(layout.bindings[1].normalized);
+    for (int col = 0; col < 4; col++) {
+        const shaders::VertexBinding& b = layout.bindings[2 + col];
+        ASSERT_EQ(b.location, 2u + col);
+        ASSERT_EQ(b.components, 4);
+        ASSERT_EQ(b.offset, 16u + col * 16u);
+        ASSERT_EQ(b.stride, 80);
+    }
+}
+
+TEST(ReflectionTests, vertex_format_mismatch_test) {
+    const shaders::VertexFormat missing{12, {{"aPos", 3}}};
+    ASSERT_FALSE(shaders::match_vertex_format(mesh_program(), missing).valid);
+
+    shaders::Reflection r;
+    r.attributes = {{"aPos", 0, GL_FLOAT_VEC3, 1}, {"aIds", 1, GL_INT_VEC2, 1}};
+
+    const shaders::VertexFormat too_few{20, {{"aPos", 2}, {"aIds", 2, GL_INT, false, 8}}};
+    ASSERT_FALSE(shaders::match_vertex_format(r, too_few).valid);
+
+    // integer attributes need integer data
+    const shaders::VertexFormat floats{20, {{"aPos", 3}, {"aIds", 2, GL_FLOAT, false, 12}}};
+    ASSERT_FALSE(shaders::match_vertex_format(r, floats).valid);
+
+    const shaders::VertexFormat outside{16, {{"aPos", 3}, {"aIds", 2, GL_INT, false, 12}}};
+    ASSERT_FALSE(shaders::match_vertex_format(r, outside).valid);
+
+    const shaders::VertexFormat ints{20, {{"aPos", 3}, {"aIds", 2, GL_INT, false, 12}}};
+    shaders::VertexLayout layout = shaders::match_vertex_format(r, ints);
+    ASSERT_TRUE(layout.valid);
+    ASSERT_TRUE(layout.bindings[1].integer);
+}
+
+TEST(ReflectionTests, vertex_format_key_test) {
+    const shaders::VertexFormat a{12, {{"aPos", 3}}};
+    const shaders::VertexFormat b{12, {{"aPos", 3}}};
+    const shaders::VertexFormat c{16, {{"aPos", 3}}};
+
+    ASSERT_EQ(a.key(), b.key());
+    ASSERT_NE(a.key(), c.key());
+}
@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+
+#include "NullBackend.hpp"
+#include "ShaderLibrary.hpp"
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <string_view>
+
+namespace {
+    // the null backend compiles and links everything, these fail the
+    // shaders whose source says "broken" and the programs they are in
+    PFNGLSHADERSOURCEPROC null_shader_source = nullptr;
+    PFNGLATTACHSHADERPROC null_attach_shader = nullptr;
+    PFNGLGETSHADERIVPROC null_get_shaderiv = nullptr;
+    PFNGLGETPROGRAMIVPROC null_get_programiv = nullptr;
+    PFNGLDELETESHADERPROC null_delete_shader = nullptr;
+    PFNGLDELETEPROGRAMPROC null_delete_program = nullptr;
+
+    std::set<GLuint> broken;
+    std::map<GLuint, GLuint> broken_programs;
+
+    struct Calls {
+        std::size_t link_queries = 0;
+        // shaders whose compile status was asked for
+        std::set<GLuint> checked;
+        std::size_t deleted_shaders = 0;
+        std::size_t deleted_programs = 0;
+    };
+
+    Calls calls;
+
+    void APIENTRY fake_shader_source(
+        GLuint shader, GLsizei count, const GLchar* const* strings, const GLint* lengths
+    ) {
+        std::string_view code(strings[0], lengths[0]);
+        if (code.find("broken") != std::string_view::npos) {
+            broken.insert(shader);
+        }
+        null_shader_source(shader, count, strings, lengths);
+    }
+
+    void APIENTRY fake_attach_shader(GLuint prgm, GLuint shader) {
+        if (broken.contains(shader)) {
+            broken_programs[prgm] = shader;
+        }
+        null_attach_shader(prgm, shader);
+    }
+
+    void APIENTRY fake_get_shaderiv(GLuint shader, GLenum pname, GLint* params) {
+        if (pname == GL_COMPILE_STATUS) {
+            calls.checked.insert(shader);
+            *params = broken.contains(shader) ? GL_FALSE : GL_TRUE;
+            return;
+        }
+        null_get_shaderiv(shader, pname, params);
+    }
+
+    void APIENTRY fake_get_programiv(GLuint prgm, GLenum pname, GLint* params) {
+        if (pname == GL_LINK_STATUS) {
+            calls.link_queries++;
+            *params = broken_programs.contains(prgm) ? GL_FALSE : GL_TRUE;
+            return;
+        }
+        null_get_programiv(prgm, pname, params);
+    }
+
+    void APIENTRY fake_delete_shader(GLuint shader) {
+        calls.deleted_shaders++;
+        null_delete_shader(shader);
+    }
+
+    void APIENTRY fake_delete_program(GLuint prgm) {
+        calls.deleted_programs++;
+        null_delete_program(prgm);
+    }
+
+    void load_fakes() {
+        gl::load_null_backend();
+        null_shader_source = glad_glShaderSource;
+        null_attach_shader = glad_glAttachShader;
+        null_get_shaderiv = glad_glGetShaderiv;
+        null_get_programiv = glad_glGetProgramiv;
+        null_delete_shader = glad_glDeleteShader;
+        null_delete_program = glad_glDeleteProgram;
+        glad_glShaderSource = fake_shader_source;
+        glad_glAttachShader = fake_attach_shader;
+        glad_glGetShaderiv = fake_get_shaderiv;
+        glad_glGetProgramiv = fake_get_programiv;
+        glad_glDeleteShader = fake_delete_shader;
+        glad_glDeleteProgram = fake_delete_program;
+        broken.clear();
+        broken_programs.clear();
+        calls = {};
+    }
+
+    constexpr const char* VERT =
+        "#version 330 core\n"
+        "layout (location = 0) in vec3 aPos;\n"
+        "void main() {\n"
+        "    gl_Position = vec4(aPos, 1.0);\n"
+        "}\n";
+
+    constexpr const char* FRAG =
+        "#version 330 core\n"
+        "out vec4 colour;\n"
+        "void main() {\n"
+        "    colour = vec4(1.0);\n"
+        "}\n";
+
+    constexpr const char* BROKEN_FRAG =
+        "#version 330 core\n"
+        "out vec4 colour;\n"
+        "void main() {\n"
+        "    colour = broken;\n"
+        "}\n";
+} // namespace
+
+TEST(ShaderLibraryTests, deferred_check_test) {
+    load_fakes();
+    {
+        shaders::ShaderLibrary library;
+        ASSERT_FALSE(library.parallel());
+        std::size_t first = library.add_source(VERT, FRAG, "first");
+        std::size_t second = library.add_source(VERT, FRAG, "second");
+        ASSERT_EQ(library.size(), 2u);
+        ASSERT_FALSE(library.ready(first));
+
+        // linked, but nothing waited on
+        library.submit();
+        ASSERT_TRUE(library.ready(first));
+        ASSERT_TRUE(library.ready(second));
+        ASSERT_EQ(calls.link_queries, 0u);
+        ASSERT_TRUE(calls.checked.empty());
+
+        // only the program asked for is checked
+        shaders::Shader& shader = library.get(first);
+        ASSERT_NE(shader.id, 0u);
+        ASSERT_TRUE(shader.build_record()->linked);
+        ASSERT_TRUE(shader.build_record()->vertex.compiled);
+        ASSERT_TRUE(shader.build_record()->fragment.compiled);
+        ASSERT_EQ(calls.checked.size(), 2u);
+        std::size_t link_queries = calls.link_queries;
+        ASSERT_GE(link_queries, 1u);
+        ASSERT_EQ(&library.get(first), &shader);
+        ASSERT_EQ(calls.link_queries, link_queries);
+
+        library.finish();
+        ASSERT_EQ(calls.checked.size(), 4u);
+        ASSERT_EQ(library.timings().programs, 2u);
+
+        glDeleteProgram(shader.id);
+        glDeleteProgram(library.get(second).id);
+    }
+    gl::unload_null_backend();
+}
+
+TEST(ShaderLibraryTests, get_submits_test) {
+    load_fakes();
+    {
+        shaders::ShaderLibrary library;
+        std::size_t index = library.add_source(VERT, FRAG, "unsubmitted");
+
+        // get() links what add() left pending
+        shaders::Shader& shader = library.get(index);
+        ASSERT_NE(shader.id, 0u);
+        ASSERT_TRUE(shader.build_record()->linked);
+        glDeleteProgram(shader.id);
+    }
+    gl::unload_null_backend();
+}
+
+TEST(ShaderLibraryTests, failed_build_test) {
+    load_fakes();
+    {
+        shaders::ShaderLibrary library;
+        std::size_t good = library.add_source(VERT, FRAG, "good");
+        std::size_t bad = library.add_source(VERT, BROKEN_FRAG, "bad");
+        library.finish();
+
+        const shaders::ProgramRecord* record = library.get(bad).build_record();
+        ASSERT_NE(record, nullptr);
+        ASSERT_TRUE(record->vertex.compiled);
+        ASSERT_FALSE(record->fragment.compiled);
+        ASSERT_FALSE(record->linked);
+        ASSERT_EQ(record->label, "bad");
+
+        // the rest of the batch is not affected
+        ASSERT_TRUE(library.get(good).build_record()->linked);
+
+        glDeleteProgram(library.get(good).id);
+        glDeleteProgram(library.get(bad).id);
+    }
+    gl::unload_null_backend();
+}
+
+TEST(ShaderLibraryTests, unfetched_cleanup_test) {
+    load_fakes();
+    GLuint fetched_id = 0;
+    {
+        shaders::ShaderLibrary library;
+        library.add_source(VERT, FRAG, "submitted");
+        library.submit();
+        library.add_source(VERT, FRAG, "added");
+        library.add_source(VERT, FRAG, "unlinked");
+        std::size_t fetched = library.add_source(VERT, FRAG, "fetched");
+        // links "added", "unlinked" and "fetched" too
+        fetched_id = library.get(fetched).id;
+        library.add_source(VERT, FRAG, "never linked");
+
+        // checking a program deletes its stages
+        ASSERT_EQ(calls.deleted_shaders, 2u);
+        ASSERT_EQ(calls.deleted_programs, 0u);
+        calls = {};
+    }
+    // both stages of every program never fetched, and the programs linked
+    // for them. The fetched program is the caller's
+    ASSERT_EQ(calls.deleted_shaders, 8u);
+    ASSERT_EQ(calls.deleted_programs, 3u);
+    ASSERT_TRUE(glIsProgram(fetched_id));
+
+    gl::unload_null_backend();
+}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#ifdef LEARN_OPENGL_HOT_RELOAD
+
+#include "NullBackend.hpp"
+#include "ShaderWatcher.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace {
+    // shaders whose source says "broken" fail to compile, and programs
+    // they are attached to fail to link
+    PFNGLSHADERSOURCEPROC null_shader_source = nullptr;
+    PFNGLATTACHSHADERPROC null_attach_shader = nullptr;
+    PFNGLGETSHADERIVPROC null_get_shaderiv = nullptr;
+    PFNGLGETPROGRAMIVPROC null_get_programiv = nullptr;
+    std::set<GLuint> broken;
+    std::set<GLuint> broken_programs;
+    // sources given to the driver, two per relink
+    std::size_t compiles = 0;
+
+    void APIENTRY fake_shader_source(
+        GLuint shader, GLsizei count, const GLchar* const* strings, const GLint* lengths
+    ) {
+        std::string_view code(
+            strings[0], lengths != nullptr ? lengths[0] : std::strlen(strings[0])
+        );
+        if (code.find("broken") != std::string_view::npos) {
+            broken.insert(shader);
+        }
+        compiles++;
+        null_shader_source(shader, count, strings, lengths);
+    }
+
+    void APIENTRY fake_attach_shader(GLuint prgm, GLuint shader) {
+        if (broken.contains(shader)) {
+            broken_programs.insert(prgm);
+        }
+        null_attach_shader(prgm, shader);
+    }
+
+    void APIENTRY fake_get_shaderiv(GLuint shader, GLenum pname, GLint* params) {
+        if (pname == GL_COMPILE_STATUS) {
+            *params = broken.contains(shader) ? GL_FALSE : GL_TRUE;
+            return;
+        }
+        null_get_shaderiv(shader, pname, params);
+    }
+
+    void APIENTRY fake_get_programiv(GLuint prgm, GLenum pname, GLint* params) {
+        if (pname == GL_LINK_STATUS && broken_programs.contains(prgm)) {
+            *params = GL_FALSE;
+            return;
+        }
+        null_get_programiv(prgm, pname, params);
+    }
+
+    class ShaderWatcherTests : public ::testing::Test {
+    protected:
+        std::filesystem::path dir;
+
+        void SetUp() override {
+            dir = std::filesystem::temp_directory_path() / "learn_opengl_shader_watcher_tests";
+            std::filesystem::create_directories(dir);
+            write("Watched.vert",
+                "#version 330 core\n"
+                "void main() {\n"
+                "    gl_Position = vec4(0.0);\n"
+                "}\n");
+            write("Watched.frag",
+                "#version 330 core\n"
+                "out vec4 colour;\n"
+                "void main() {\n"
+                "    colour = vec4(1.0);\n"
+                "}\n");
+
+            gl::load_null_backend();
+            null_shader_source = glad_glShaderSource;
+            null_attach_shader = glad_glAttachShader;
+            null_get_shaderiv = glad_glGetShaderiv;
+            null_get_programiv = glad_glGetProgramiv;
+            glad_glShaderSource = fake_shader_source;
+            glad_glAttachShader = fake_attach_shader;
+            glad_glGetShaderiv = fake_get_shaderiv;
+            glad_glGetProgramiv = fake_get_programiv;
+            broken.clear();
+            broken_programs.clear();
+            compiles = 0;
+        }
+
+        void TearDown() override {
+            gl::unload_null_backend();
+            std::filesystem::remove_all(dir);
+        }
+
+        void write(const char* name, const char* text) {
+            std::ofstream file(dir / name);
+            file << text;
+        }
+
+        std::string path(const char* name) const {
+            return (dir / name).string();
+        }
+
+        /**
+         * @brief Poll until the watcher has relinked the program once,
+         * well past the time it waits for writes to settle
+         *
+         * @return programs poll() swapped in
+         */
+        std::size_t poll_until_relinked(shaders::ShaderWatcher& watcher) {
+            std::size_t start = compiles;
+            std::size_t swapped = 0;
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (compiles < start + 2 && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                swapped += watcher.poll();
+            }
+            return swapped;
+        }
+    };
+} // namespace
+
+TEST_F(ShaderWatcherTests, reload_test) {
+    std::string v_path = path("Watched.vert");
+    std::string f_path = path("Watched.frag");
+    shaders::Shader shader(v_path.c_str(), f_path.c_str());
+    GLuint old = shader.id;
+    ASSERT_NE(old, 0u);
+
+    shaders::ShaderWatcher watcher;
+    watcher.watch(shader);
+    ASSERT_EQ(watcher.poll(), 0u);
+
+    write("Watched.frag",
+        "#version 330 core\n"
+        "out vec4 colour;\n"
+        "uniform float u_fade;\n"
+        "void main() {\n"
+        "    colour = vec4(u_fade);\n"
+        "}\n");
+    ASSERT_EQ(poll_until_relinked(watcher), 1u);
+    ASSERT_NE(shader.id, old);
+    ASSERT_GE(shader.uniform_location("u_fade"), 0);
+
+    watcher.unwatch(shader);
+    glDeleteProgram(shader.id);
+}
+
+TEST_F(ShaderWatcherTests, broken_edit_test) {
+    std::string v_path = path("Watched.vert");
+    std::string f_path = path("Watched.frag");
+    shaders::Shader shader(v_path.c_str(), f_path.c_str());
+    GLuint old = shader.id;
+
+    shaders::ShaderWatcher watcher;
+    watcher.watch(shader);
+
+    // compiled and thrown away, the old program keeps running
+    write("Watched.frag",
+        "#version 330 core\n"
+        "out vec4 colour;\n"
+        "void main() {\n"
+        "    colour = broken;\n"
+        "}\n");
+    ASSERT_EQ(poll_until_relinked(watcher), 0u);
+    ASSERT_EQ(shader.id, old);
+    ASSERT_TRUE(glIsProgram(old));
+
+    watcher.unwatch(shader);
+    glDeleteProgram(shader.id);
+}
+
+#else
+
+TEST(ShaderWatcherTests, reload_test) {
+    GTEST_SKIP() << "built with LEARN_OPENGL_HOT_RELOAD off";
+}
+
+#endif
@@ -1,6 +1,16 @@
 #include <gtest/gtest.h>
 
+#include "MappedSource.hpp"
+#include "NullBackend.hpp"
 #include "Shaders.hpp"
+#include "Sources.hpp"
+#include "bindings/HelloShaders.hpp"
+#include "bindings/HelloUniforms.hpp"
+
+#include <array>
+#include <bit>
+#include <map>
+#include <type_traits>
 
 TEST(ShadersTests, read_shader_file_test) {
     const char *p_expected = 
@@ -17,4 +27,412 @@ TEST(ShadersTests, read_shader_file_test) {
     std::string actual = shaders::read_shader_file("shaders/BasicVertexShader.vert");
 
     ASSERT_EQ(actual, expected);
-}
\ No newline at end of file
+}
+
+TEST(ShadersTests, uniform_handle_test) {
+    constexpr shaders::UniformHandle handle = shaders::uniform("u_color");
+    static_assert(handle.hash == hash::fnv1a_32("u_color"));
+
+    ASSERT_EQ(shaders::uniform(std::string("u_color")).hash, handle.hash);
+    ASSERT_NE(shaders::uniform("u_colour").hash, handle.hash);
+}
+
+TEST(ShadersTests, mapped_source_test) {
+    shaders::MappedSource source("shaders/BasicVertexShader.vert");
+
+    ASSERT_TRUE(source.is_open());
+    ASSERT_EQ(source.view(), shaders::read_shader_file("shaders/BasicVertexShader.vert"));
+
+    shaders::MappedSource missing("shaders/DoesNotExist.vert");
+    ASSERT_FALSE(missing.is_open());
+    ASSERT_EQ(missing.size(), 0u);
+}
+
+TEST(ShadersTests, embedded_source_test) {
+    std::optional<std::string_view> source =
+        shaders::embedded_source("shaders/BasicVertexShader.vert");
+
+#ifndef LEARN_OPENGL_EMBED_SHADERS
+    ASSERT_FALSE(source.has_value());
+    GTEST_SKIP() << "built with LEARN_OPENGL_EMBED_SHADERS off";
+#endif
+    ASSERT_TRUE(source.has_value());
+    ASSERT_EQ(*source, shaders::read_shader_file("shaders/BasicVertexShader.vert"));
+    ASSERT_EQ(shaders::embedded_source("./shaders/BasicVertexShader.vert"), source);
+    ASSERT_FALSE(shaders::embedded_source("shaders/DoesNotExist.vert").has_value());
+}
+
+namespace {
+    template <typename U>
+    concept float_settable = requires(shaders::Shader& s, U u) {
+        s.set_float(u, 1.0f);
+    };
+
+    template <typename U>
+    concept vec4_settable = requires(shaders::Shader& s, U u) {
+        s.set_vec4(u, 0.0f, 0.0f, 0.0f, 0.0f);
+    };
+} // namespace
+
+TEST(ShadersTests, generated_bindings_test) {
+    namespace program = shaders::bindings::HelloUniforms;
+
+    static_assert(std::is_same_v<
+        decltype(program::u_color), const shaders::Uniform<std140::vec4>
+    >);
+    static_assert(program::u_color.hash == shaders::uniform("u_color").hash);
+    static_assert(program::aPos.location == 0);
+
+    // only the setter for the declared type compiles
+    static_assert(vec4_settable<decltype(program::u_color)>);
+    static_assert(!float_settable<decltype(program::u_color)>);
+
+    ASSERT_STREQ(program::vert_path, "shaders/HelloUniforms.vert");
+    ASSERT_EQ(shaders::bindings::HelloShaders::aCol.location, 1);
+}
+
+namespace {
+    // what the fake program holds per location, (1, 0, 0, 0) until set as
+    // if every uniform had an initializer. The components a type does not
+    // have stay 0, like the parts of the array glGetUniformfv does not write
+    std::map<GLint, std::array<GLfloat, 4>> program_values;
+    std::size_t uniform_calls = 0;
+
+    std::array<GLfloat, 4>& program_value(GLint loc) {
+        return program_values.try_emplace(loc, std::array<GLfloat, 4>{1, 0, 0, 0})
+            .first->second;
+    }
+
+    void APIENTRY fake_uniform_1f(GLint loc, GLfloat x) {
+        uniform_calls++;
+        program_value(loc) = {x, 0, 0, 0};
+    }
+
+    void APIENTRY fake_uniform_4f(GLint loc, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+        uniform_calls++;
+        program_value(loc) = {x, y, z, w};
+    }
+
+    void APIENTRY fake_get_uniformfv(GLuint, GLint loc, GLfloat* params) {
+        const std::array<GLfloat, 4>& v = program_value(loc);
+        std::copy(v.begin(), v.end(), params);
+    }
+
+    shaders::ProgramSources uniform_sources() {
+        shaders::ProgramSources sources;
+        sources.ok = true;
+        sources.vert.code =
+            "#version 330 core\n"
+            "uniform float u_scale;\n"
+            "uniform vec4 u_color;\n"
+            "uniform float u_weights[2];\n"
+            "void main() {\n"
+            "    gl_Position = u_color * u_scale * u_weights[1];\n"
+            "}\n";
+        sources.frag.code =
+            "#version 330 core\n"
+            "out vec4 colour;\n"
+            "void main() {\n"
+            "    colour = vec4(1.0);\n"
+            "}\n";
+        return sources;
+    }
+
+    void load_uniform_fakes() {
+        gl::load_null_backend();
+        glad_glUniform1f = fake_uniform_1f;
+        glad_glUniform4f = fake_uniform_4f;
+        glad_glGetUniformfv = fake_get_uniformfv;
+        program_values.clear();
+        uniform_calls = 0;
+    }
+
+    void expect_balanced(const shaders::UniformStats& stats) {
+        EXPECT_EQ(stats.requested, stats.elided + stats.issued);
+    }
+} // namespace
+
+TEST(ShadersTests, uniform_elision_test) {
+    load_uniform_fakes();
+    shaders::Shader shader(uniform_sources());
+    GLint scale = shader.uniform_location("u_scale");
+    ASSERT_GE(scale, 0);
+
+    // the value read back after linking
+    shader.set_float("u_scale", 1.0f);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 0u);
+
+    shader.set_float("u_scale", 2.0f);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 1u);
+    ASSERT_EQ(program_value(scale)[0], 2.0f);
+
+    // set, flushed, then set to the same value again
+    shader.set_float("u_scale", 2.0f);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 1u);
+
+    // overwritten before the flush, only the last value is sent
+    shader.set_vec4("u_color", 0.1f, 0.2f, 0.3f, 0.4f);
+    shader.set_vec4("u_color", 0.5f, 0.6f, 0.7f, 0.8f);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 2u);
+    std::array<GLfloat, 4> expected{0.5f, 0.6f, 0.7f, 0.8f};
+    ASSERT_EQ(program_value(shader.uniform_location("u_color")), expected);
+
+    const shaders::UniformStats& stats = shader.uniform_stats();
+    ASSERT_EQ(stats.requested, 5u);
+    ASSERT_EQ(stats.issued, 2u);
+    ASSERT_EQ(stats.elided, 3u);
+    expect_balanced(stats);
+
+    gl::unload_null_backend();
+}
+
+TEST(ShadersTests, uniform_round_trip_test) {
+    load_uniform_fakes();
+    shaders::Shader shader(uniform_sources());
+
+    // A -> B -> A within a frame sends nothing
+    shader.set_float("u_scale", 3.0f);
+    shader.set_float("u_scale", 1.0f);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 0u);
+    ASSERT_EQ(shader.uniform_stats().issued, 0u);
+    ASSERT_EQ(shader.uniform_stats().elided, 2u);
+    expect_balanced(shader.uniform_stats());
+
+    // and B after the flush is sent once
+    shader.set_float("u_scale", 3.0f);
+    shader.flush();
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 1u);
+    expect_balanced(shader.uniform_stats());
+
+    gl::unload_null_backend();
+}
+
+TEST(ShadersTests, uniform_array_slot_test) {
+    load_uniform_fakes();
+    shaders::Shader shader(uniform_sources());
+    GLint first = shader.uniform_location("u_weights[0]");
+    ASSERT_GE(first, 0);
+    ASSERT_EQ(shader.uniform_location("u_weights"), first);
+    ASSERT_NE(shader.uniform_location("u_weights[1]"), first);
+
+    // "name" and "name[0]" are the same slot
+    shader.set_float("u_weights", 4.0f);
+    shader.set_float("u_weights[0]", 5.0f);
+    shader.set_float("u_weights[1]", 4.0f);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 2u);
+    ASSERT_EQ(program_value(first)[0], 5.0f);
+    ASSERT_EQ(program_value(shader.uniform_location("u_weights[1]"))[0], 4.0f);
+
+    shader.set_float("u_weights[0]", 5.0f);
+    shader.set_float("u_weights", 5.0f);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 2u);
+
+    ASSERT_EQ(shader.uniform_stats().requested, 5u);
+    ASSERT_EQ(shader.uniform_stats().issued, 2u);
+    expect_balanced(shader.uniform_stats());
+
+    gl::unload_null_backend();
+}
+
+TEST(ShadersTests, unknown_uniform_test) {
+    load_uniform_fakes();
+    shaders::Shader shader(uniform_sources());
+
+    shader.set_float("u_missing", 2.0f);
+    shader.set_vec4("u_missing", 0, 0, 0, 0);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 0u);
+    ASSERT_EQ(shader.uniform_stats().requested, 2u);
+    ASSERT_EQ(shader.uniform_stats().elided, 2u);
+    expect_balanced(shader.uniform_stats());
+
+    shader.reset_uniform_stats();
+    ASSERT_EQ(shader.uniform_stats().requested, 0u);
+
+    gl::unload_null_backend();
+}
+
+namespace {
+    // the last values sent per location by the setters the fakes above
+    // do not cover
+    std::map<GLint, std::array<GLfloat, 16>> sent;
+
+    void APIENTRY fake_uniform_1ui(GLint loc, GLuint x) {
+        uniform_calls++;
+        sent[loc] = {GLfloat(x)};
+    }
+
+    void APIENTRY fake_uniform_2i(GLint loc, GLint x, GLint y) {
+        uniform_calls++;
+        sent[loc] = {GLfloat(x), GLfloat(y)};
+    }
+
+    void APIENTRY fake_uniform_2f(GLint loc, GLfloat x, GLfloat y) {
+        uniform_calls++;
+        sent[loc] = {x, y};
+    }
+
+    void APIENTRY fake_uniform_3f(GLint loc, GLfloat x, GLfloat y, GLfloat z) {
+        uniform_calls++;
+        sent[loc] = {x, y, z};
+    }
+
+    void APIENTRY fake_uniform_matrix_3fv(
+        GLint loc, GLsizei, GLboolean, const GLfloat* value
+    ) {
+        uniform_calls++;
+        sent[loc] = {};
+        std::copy(value, value + 9, sent[loc].begin());
+    }
+
+    void APIENTRY fake_uniform_matrix_4fv(
+        GLint loc, GLsizei, GLboolean, const GLfloat* value
+    ) {
+        uniform_calls++;
+        std::copy(value, value + 16, sent[loc].begin());
+    }
+
+    shaders::ProgramSources typed_sources() {
+        shaders::ProgramSources sources;
+        sources.ok = true;
+        sources.vert.code =
+            "#version 430 core\n"
+            "uniform vec2 u_uv;\n"
+            "uniform vec3 u_light;\n"
+            "uniform uint u_count;\n"
+            "uniform ivec2 u_cell;\n"
+            "uniform mat3 u_normal;\n"
+            "layout (location = 10) uniform mat4 u_model;\n"
+            "void main() {\n"
+            "    gl_Position = u_model * vec4(u_normal * u_light, u_uv.x);\n"
+            "}\n";
+        sources.frag.code = uniform_sources().frag.code;
+        return sources;
+    }
+} // namespace
+
+TEST(ShadersTests, typed_setters_test) {
+    load_uniform_fakes();
+    glad_glUniform1ui = fake_uniform_1ui;
+    glad_glUniform2i = fake_uniform_2i;
+    glad_glUniform2f = fake_uniform_2f;
+    glad_glUniform3f = fake_uniform_3f;
+    glad_glUniformMatrix3fv = fake_uniform_matrix_3fv;
+    glad_glUniformMatrix4fv = fake_uniform_matrix_4fv;
+    sent.clear();
+
+    shaders::Shader shader(typed_sources());
+    constexpr shaders::Uniform<std140::vec2> uv{"u_uv"};
+    constexpr shaders::Uniform<std140::vec3> light{"u_light"};
+    constexpr shaders::Uniform<unsigned int> count{"u_count"};
+    constexpr shaders::Uniform<std140::ivec2> cell{"u_cell"};
+    constexpr shaders::Uniform<std140::mat3> normal{"u_normal"};
+    constexpr shaders::Uniform<std140::mat4> model{"u_model", 10};
+
+    shader.set(uv, {0.5f, 0.25f});
+    shader.set(light, {1, 2, 3});
+    shader.set(count, 7u);
+    shader.set(cell, {4, 5});
+    shader.set(normal, {{{1, 2, 3, 0}, {4, 5, 6, 0}, {7, 8, 9, 0}}});
+    std140::mat4 m{{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {2, 3, 4, 1}}};
+    shader.set(model, m);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 6u);
+
+    ASSERT_EQ(sent[shader.uniform_location(uv)][1], 0.25f);
+    ASSERT_EQ(sent[shader.uniform_location(light)][2], 3.0f);
+    ASSERT_EQ(sent[shader.uniform_location(count)][0], 7.0f);
+    ASSERT_EQ(sent[shader.uniform_location(cell)][1], 5.0f);
+    // the std140 padding is not sent
+    std::array<GLfloat, 16> packed{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    ASSERT_EQ(sent[shader.uniform_location(normal)], packed);
+    ASSERT_EQ(sent[10][12], 2.0f);
+    ASSERT_EQ(sent[10][15], 1.0f);
+
+    // matrices are shadowed like the rest
+    shader.set(model, m);
+    shader.set(normal, {{{1, 2, 3, 9}, {4, 5, 6, 9}, {7, 8, 9, 9}}});
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 6u);
+    expect_balanced(shader.uniform_stats());
+
+    gl::unload_null_backend();
+}
+
+TEST(ShadersTests, uniform_layout_location_test) {
+    load_uniform_fakes();
+    glad_glUniformMatrix4fv = fake_uniform_matrix_4fv;
+    sent.clear();
+
+    shaders::Shader shader(typed_sources());
+    ASSERT_EQ(shader.uniform_location(shaders::Uniform<std140::mat4>{"u_model", 10}), 10);
+
+    // found by its location, not its name
+    constexpr shaders::Uniform<std140::mat4> renamed{"u_renamed", 10};
+    ASSERT_EQ(shader.uniform_location(renamed), 10);
+    std140::mat4 m{};
+    m.cols[3].w = 2;
+    shader.set(renamed, m);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 1u);
+    ASSERT_EQ(sent[10][15], 2.0f);
+
+    // and not found at a location nothing has
+    constexpr shaders::Uniform<std140::mat4> missing{"u_model", 20};
+    ASSERT_EQ(shader.uniform_location(missing), -1);
+    shader.set(missing, m);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 1u);
+
+    gl::unload_null_backend();
+}
+
+TEST(ShadersTests, uniform_hash_collision_test) {
+    static_assert(
+        shaders::uniform("u_vlcpnirl").hash == shaders::uniform("u_otpjyjaw").hash
+    );
+    load_uniform_fakes();
+
+    shaders::ProgramSources sources = uniform_sources();
+    sources.vert.code =
+        "#version 330 core\n"
+        "uniform float u_vlcpnirl;\n"
+        "uniform float u_otpjyjaw;\n"
+        "void main() {\n"
+        "    gl_Position = vec4(u_vlcpnirl, u_otpjyjaw, 0.0, 1.0);\n"
+        "}\n";
+    shaders::Shader shader(sources);
+
+    // names are compared, each finds its own location
+    GLint first = shader.uniform_location("u_vlcpnirl");
+    GLint second = shader.uniform_location("u_otpjyjaw");
+    ASSERT_GE(first, 0);
+    ASSERT_GE(second, 0);
+    ASSERT_NE(first, second);
+    ASSERT_EQ(shader.uniform_location(shaders::Uniform<float>{"u_otpjyjaw"}), second);
+    ASSERT_EQ(shader.uniform_location("u_missing"), -1);
+
+    shader.set_float("u_vlcpnirl", 2.0f);
+    shader.set(shaders::Uniform<float>{"u_otpjyjaw"}, 3.0f);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 2u);
+    ASSERT_EQ(program_value(first)[0], 2.0f);
+    ASSERT_EQ(program_value(second)[0], 3.0f);
+
+    // a handle cannot tell them apart, and finds neither
+    ASSERT_EQ(shader.uniform_location(shaders::uniform("u_vlcpnirl")), -1);
+    shader.set_float(shaders::uniform("u_vlcpnirl"), 4.0f);
+    shader.flush();
+    ASSERT_EQ(uniform_calls, 2u);
+    expect_balanced(shader.uniform_stats());
+
+    gl::unload_null_backend();
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "SourceLoader.hpp"
+
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <vector>
+
+namespace {
+    std::string read_file(const char* path) {
+        std::ifstream file(path);
+        std::stringstream stream;
+        stream << file.rdbuf();
+        return stream.str();
+    }
+} // namespace
+
+TEST(SourceLoaderTests, load_test) {
+    shaders::SourceLoader loader(2);
+    ASSERT_EQ(loader.threads(), 2u);
+
+    std::vector<std::future<shaders::ProgramSources>> pending;
+    for (int i = 0; i < 8; i++) {
+        pending.push_back(
+            loader.load("shaders/HelloShaders.vert", "shaders/HelloShaders.frag")
+        );
+    }
+
+    for (std::future<shaders::ProgramSources>& f : pending) {
+        shaders::ProgramSources sources = f.get();
+        ASSERT_TRUE(sources.ok);
+        ASSERT_FALSE(sources.info.preprocessed);
+        ASSERT_EQ(sources.info.v_path, "shaders/HelloShaders.vert");
+        ASSERT_EQ(sources.vert.code, read_file("shaders/HelloShaders.vert"));
+        ASSERT_EQ(sources.frag.code, read_file("shaders/HelloShaders.frag"));
+        ASSERT_TRUE(sources.vert.files.empty());
+    }
+}
+
+TEST(SourceLoaderTests, preprocess_test) {
+    shaders::SourceLoader loader(1);
+    shaders::Variant variant{{{"FOG", "1"}}};
+
+    shaders::ProgramSources sources = loader.load(
+        "shaders/HelloShaders.vert", "shaders/HelloShaders.frag", "shaders", variant
+    ).get();
+
+    ASSERT_TRUE(sources.ok);
+    ASSERT_TRUE(sources.info.preprocessed);
+    ASSERT_EQ(sources.info.variant.key(), variant.key());
+    ASSERT_NE(sources.frag.code.find("#define FOG 1\n"), std::string::npos);
+    ASSERT_EQ(sources.vert.files[0], "shaders/HelloShaders.vert");
+    ASSERT_EQ(sources.info.files.size(), 2u);
+}
+
+TEST(SourceLoaderTests, missing_file_test) {
+    shaders::SourceLoader loader(1);
+
+    ASSERT_FALSE(loader.load("shaders/Missing.vert", "shaders/HelloShaders.frag").get().ok);
+    ASSERT_FALSE(loader.load(
+        "shaders/Missing.vert", "shaders/HelloShaders.frag", "shaders"
+    ).get().ok);
+}
@@ -0,0 +1,283 @@
+#include <gtest/gtest.h>
+
+#include "StateCache.hpp"
+
+#include <cstddef>
+
+namespace {
+    // calls that reached the fake driver
+    struct Calls {
+        std::size_t use_program = 0;
+        std::size_t bind_vertex_array = 0;
+        std::size_t bind_buffer = 0;
+        std::size_t bind_buffer_base = 0;
+        std::size_t active_texture = 0;
+        std::size_t bind_texture = 0;
+        std::size_t bind_framebuffer = 0;
+        std::size_t enable = 0;
+        std::size_t disable = 0;
+        std::size_t deletes = 0;
+    };
+
+    Calls calls;
+
+    void APIENTRY fake_use_program(GLuint) {
+        calls.use_program++;
+    }
+
+    void APIENTRY fake_bind_vertex_array(GLuint) {
+        calls.bind_vertex_array++;
+    }
+
+    void APIENTRY fake_bind_buffer(GLenum, GLuint) {
+        calls.bind_buffer++;
+    }
+
+    void APIENTRY fake_bind_buffer_base(GLenum, GLuint, GLuint) {
+        calls.bind_buffer_base++;
+    }
+
+    void APIENTRY fake_bind_buffer_range(GLenum, GLuint, GLuint, GLintptr, GLsizeiptr) {
+        calls.bind_buffer_base++;
+    }
+
+    void APIENTRY fake_active_texture(GLenum) {
+        calls.active_texture++;
+    }
+
+    void APIENTRY fake_bind_texture(GLenum, GLuint) {
+        calls.bind_texture++;
+    }
+
+    void APIENTRY fake_bind_framebuffer(GLenum, GLuint) {
+        calls.bind_framebuffer++;
+    }
+
+    void APIENTRY fake_enable(GLenum) {
+        calls.enable++;
+    }
+
+    void APIENTRY fake_disable(GLenum) {
+        calls.disable++;
+    }
+
+    void APIENTRY fake_delete(GLsizei, const GLuint*) {
+        calls.deletes++;
+    }
+
+    void install_fakes() {
+        glad_glUseProgram = fake_use_program;
+        glad_glBindVertexArray = fake_bind_vertex_array;
+        glad_glBindBuffer = fake_bind_buffer;
+        glad_glBindBufferBase = fake_bind_buffer_base;
+        glad_glBindBufferRange = fake_bind_buffer_range;
+        glad_glActiveTexture = fake_active_texture;
+        glad_glBindTexture = fake_bind_texture;
+        glad_glBindFramebuffer = fake_bind_framebuffer;
+        glad_glEnable = fake_enable;
+        glad_glDisable = fake_disable;
+        glad_glDeleteBuffers = fake_delete;
+        glad_glDeleteVertexArrays = fake_delete;
+        glad_glDeleteTextures = fake_delete;
+        glad_glDeleteFramebuffers = fake_delete;
+        calls = {};
+        gl::install_state_cache();
+        gl::reset_state_cache_stats();
+    }
+
+    void clear_fakes() {
+        gl::uninstall_state_cache();
+        glad_glUseProgram = NULL;
+        glad_glBindVertexArray = NULL;
+        glad_glBindBuffer = NULL;
+        glad_glBindBufferBase = NULL;
+        glad_glBindBufferRange = NULL;
+        glad_glActiveTexture = NULL;
+        glad_glBindTexture = NULL;
+        glad_glBindFramebuffer = NULL;
+        glad_glEnable = NULL;
+        glad_glDisable = NULL;
+        glad_glDeleteBuffers = NULL;
+        glad_glDeleteVertexArrays = NULL;
+        glad_glDeleteTextures = NULL;
+        glad_glDeleteFramebuffers = NULL;
+    }
+} // namespace
+
+TEST(StateCacheTests, install_test) {
+    install_fakes();
+    ASSERT_TRUE(gl::state_cache_installed());
+    ASSERT_NE(glad_glUseProgram, fake_use_program);
+
+    clear_fakes();
+    ASSERT_FALSE(gl::state_cache_installed());
+}
+
+TEST(StateCacheTests, elision_test) {
+    install_fakes();
+
+    // nothing is known at first, so 0 is sent too
+    glUseProgram(0);
+    glUseProgram(0);
+    glUseProgram(3);
+    glUseProgram(3);
+    ASSERT_EQ(calls.use_program, 2u);
+
+    // one binding per target
+    glBindBuffer(GL_ARRAY_BUFFER, 1);
+    glBindBuffer(GL_UNIFORM_BUFFER, 1);
+    glBindBuffer(GL_ARRAY_BUFFER, 1);
+    glBindBuffer(GL_UNIFORM_BUFFER, 2);
+    ASSERT_EQ(calls.bind_buffer, 3u);
+
+    // the indexed binds set the generic binding and are always sent
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, 4);
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, 4);
+    glBindBuffer(GL_UNIFORM_BUFFER, 4);
+    ASSERT_EQ(calls.bind_buffer_base, 2u);
+    ASSERT_EQ(calls.bind_buffer, 3u);
+
+    // per unit and target, and not cached before the unit is known
+    glBindTexture(GL_TEXTURE_2D, 5);
+    glBindTexture(GL_TEXTURE_2D, 5);
+    ASSERT_EQ(calls.bind_texture, 2u);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 5);
+    glBindTexture(GL_TEXTURE_2D, 5);
+    glBindTexture(GL_TEXTURE_CUBE_MAP, 5);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, 5);
+    glActiveTexture(GL_TEXTURE1);
+    ASSERT_EQ(calls.active_texture, 2u);
+    ASSERT_EQ(calls.bind_texture, 5u);
+
+    // GL_FRAMEBUFFER sets both bindings
+    glBindFramebuffer(GL_FRAMEBUFFER, 6);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 6);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 6);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 6);
+    ASSERT_EQ(calls.bind_framebuffer, 3u);
+
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_DEPTH_TEST);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glDisable(GL_BLEND);
+    ASSERT_EQ(calls.enable, 1u);
+    ASSERT_EQ(calls.disable, 2u);
+
+    const gl::StateCacheStats& stats = gl::state_cache_stats();
+    ASSERT_EQ(stats.forwarded, 20u);
+    ASSERT_EQ(stats.elided, 10u);
+
+    clear_fakes();
+}
+
+TEST(StateCacheTests, element_array_test) {
+    install_fakes();
+
+    glBindVertexArray(1);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 2);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 2);
+    ASSERT_EQ(calls.bind_buffer, 1u);
+
+    // another vertex array has its own element buffer
+    glBindVertexArray(3);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 2);
+    ASSERT_EQ(calls.bind_buffer, 2u);
+
+    // but the array buffer binding is global
+    glBindBuffer(GL_ARRAY_BUFFER, 4);
+    glBindVertexArray(1);
+    glBindBuffer(GL_ARRAY_BUFFER, 4);
+    ASSERT_EQ(calls.bind_buffer, 3u);
+
+    // binding the same vertex array again keeps what is known
+    glBindVertexArray(1);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 2);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 2);
+    ASSERT_EQ(calls.bind_vertex_array, 3u);
+    ASSERT_EQ(calls.bind_buffer, 4u);
+
+    clear_fakes();
+}
+
+TEST(StateCacheTests, delete_test) {
+    install_fakes();
+
+    glBindBuffer(GL_ARRAY_BUFFER, 1);
+    glBindBuffer(GL_UNIFORM_BUFFER, 1);
+    GLuint buffer = 1;
+    glDeleteBuffers(1, &buffer);
+    ASSERT_EQ(calls.deletes, 1u);
+    // the driver bound 0 in its place, and the name may come back
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_UNIFORM_BUFFER, 1);
+    ASSERT_EQ(calls.bind_buffer, 3u);
+
+    glBindVertexArray(2);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 3);
+    GLuint array = 2;
+    glDeleteVertexArrays(1, &array);
+    glBindVertexArray(0);
+    glBindVertexArray(2);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 3);
+    ASSERT_EQ(calls.bind_vertex_array, 2u);
+    ASSERT_EQ(calls.bind_buffer, 5u);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 4);
+    glActiveTexture(GL_TEXTURE3);
+    glBindTexture(GL_TEXTURE_2D, 4);
+    GLuint texture = 4;
+    glDeleteTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 4);
+    ASSERT_EQ(calls.bind_texture, 3u);
+
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 5);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    GLuint framebuffer = 5;
+    glDeleteFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 5);
+    ASSERT_EQ(calls.bind_framebuffer, 3u);
+    ASSERT_EQ(calls.deletes, 4u);
+
+    clear_fakes();
+}
+
+TEST(StateCacheTests, invalidate_test) {
+    install_fakes();
+
+    glUseProgram(1);
+    glBindVertexArray(2);
+    glBindBuffer(GL_ARRAY_BUFFER, 3);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 4);
+    glBindFramebuffer(GL_FRAMEBUFFER, 5);
+    glEnable(GL_BLEND);
+
+    // e.g. a library with its own loader changed the state
+    gl::invalidate_state_cache();
+    glUseProgram(1);
+    glBindVertexArray(2);
+    glBindBuffer(GL_ARRAY_BUFFER, 3);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, 4);
+    glBindFramebuffer(GL_FRAMEBUFFER, 5);
+    glEnable(GL_BLEND);
+
+    ASSERT_EQ(calls.use_program, 2u);
+    ASSERT_EQ(calls.bind_vertex_array, 2u);
+    ASSERT_EQ(calls.bind_buffer, 2u);
+    ASSERT_EQ(calls.active_texture, 2u);
+    ASSERT_EQ(calls.bind_texture, 2u);
+    ASSERT_EQ(calls.bind_framebuffer, 2u);
+    ASSERT_EQ(calls.enable, 2u);
+    ASSERT_EQ(gl::state_cache_stats().elided, 0u);
+
+    clear_fakes();
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "Std140.hpp"
+#include "UniformBuffers.hpp"
+
+#include <cstddef>
+
+namespace {
+    // offsets from the std140 rules in the GL 4.6 spec, section 7.6.2.2
+    struct alignas(16) Lights {
+        using layout = std140::Layout<
+            float, std140::vec3, std140::vec2, std140::mat3,
+            std140::array<float, 3>, std140::boolean
+        >;
+
+        float count;
+        std140::vec3 ambient;
+        std140::vec2 scale;
+        std140::mat3 basis;
+        std140::array<float, 3> weights;
+        std140::boolean enabled;
+    };
+    STD140_CHECK(Lights, count, 0);
+    STD140_CHECK(Lights, ambient, 1);
+    STD140_CHECK(Lights, scale, 2);
+    STD140_CHECK(Lights, basis, 3);
+    STD140_CHECK(Lights, weights, 4);
+    STD140_CHECK(Lights, enabled, 5);
+    STD140_CHECK_SIZE(Lights);
+} // namespace
+
+TEST(Std140Tests, layout_test) {
+    using layout = Lights::layout;
+
+    ASSERT_EQ(layout::offset(0), 0u);
+    ASSERT_EQ(layout::offset(1), 16u);
+    ASSERT_EQ(layout::offset(2), 32u);
+    ASSERT_EQ(layout::offset(3), 48u);
+    // array elements are padded to 16 bytes
+    ASSERT_EQ(layout::offset(4), 96u);
+    ASSERT_EQ(layout::offset(5), 144u);
+    ASSERT_EQ(layout::size, 160u);
+}
+
+TEST(Std140Tests, vec3_padding_test) {
+    // a scalar fits in the last 4 bytes of a vec3, C++ cannot pack it
+    // there so STD140_CHECK would reject this block
+    struct alignas(16) Packed {
+        using layout = std140::Layout<std140::vec3, float>;
+        std140::vec3 v;
+        float f;
+    };
+    ASSERT_EQ(Packed::layout::offset(1), 12u);
+    ASSERT_NE(offsetof(Packed, f), Packed::layout::offset(1));
+}
+
+TEST(Std140Tests, frame_uniforms_test) {
+    using layout = shaders::FrameUniforms::layout;
+
+    ASSERT_EQ(layout::offset(2), 128u);
+    ASSERT_EQ(layout::offset(3), 144u);
+    ASSERT_EQ(layout::offset(4), 148u);
+    ASSERT_EQ(sizeof(shaders::FrameUniforms), 160u);
+}
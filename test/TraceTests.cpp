@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include "Trace.hpp"
+
+namespace {
+    GLbitfield cleared = 0;
+
+    void APIENTRY fake_clear(GLbitfield mask) {
+        cleared = mask;
+    }
+
+    GLenum APIENTRY fake_get_error() {
+        return GL_INVALID_ENUM;
+    }
+} // namespace
+
+TEST(TraceTests, count_test) {
+    // no context, so only the fakes are wrapped
+    glad_glClear = fake_clear;
+    glad_glGetError = fake_get_error;
+
+    gl::install_trace();
+    ASSERT_TRUE(gl::trace_installed());
+    ASSERT_NE(glad_glClear, fake_clear);
+    ASSERT_EQ(glad_glDrawArrays, nullptr);
+
+    glClear(GL_COLOR_BUFFER_BIT);
+    glClear(GL_DEPTH_BUFFER_BIT);
+    ASSERT_EQ(cleared, GL_DEPTH_BUFFER_BIT);
+    ASSERT_EQ(glGetError(), GL_INVALID_ENUM);
+
+    const gl::FrameTrace& first = gl::end_trace_frame();
+    ASSERT_EQ(first.frame, 0);
+    ASSERT_EQ(first.calls, 3);
+    ASSERT_EQ(first.functions.size(), 2);
+    std::uint64_t bucketed = 0;
+    for (std::uint64_t n : first.durations) {
+        bucketed += n;
+    }
+    ASSERT_EQ(bucketed, 3);
+    for (const gl::TracedCall& call : first.functions) {
+        ASSERT_EQ(call.calls, std::string_view(call.name) == "glClear" ? 2 : 1);
+    }
+
+    const gl::FrameTrace& second = gl::end_trace_frame();
+    ASSERT_EQ(second.frame, 1);
+    ASSERT_EQ(second.calls, 0);
+    ASSERT_EQ(gl::trace_history().size(), 2);
+
+    gl::set_trace_history(1);
+    ASSERT_EQ(gl::trace_history().size(), 1);
+
+    gl::uninstall_trace();
+    ASSERT_FALSE(gl::trace_installed());
+    ASSERT_EQ(glad_glClear, fake_clear);
+    ASSERT_EQ(glad_glGetError, fake_get_error);
+
+    glad_glClear = NULL;
+    glad_glGetError = NULL;
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include "NullBackend.hpp"
+#include "Util.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+TEST(UtilTests, options_test) {
+    char program[] = "hellorectangle";
+    char headless[] = "--headless";
+    char size[] = "--size";
+    char wxh[] = "320x200";
+    char fill[] = "-f";
+    char frames[] = "--frames";
+    char n[] = "10";
+    char* argv[] = {program, headless, size, wxh, fill, frames, n, nullptr};
+    int argc = 7;
+
+    util::ContextOptions defaults;
+    defaults.visible = false;
+    util::ContextOptions options = util::parse_context_options(argc, argv, defaults);
+
+    ASSERT_EQ(options.backend, util::Backend::HEADLESS);
+    ASSERT_EQ(options.width, 320);
+    ASSERT_EQ(options.height, 200);
+    ASSERT_EQ(options.frames, 10u);
+    ASSERT_FALSE(options.visible);
+    ASSERT_EQ(options.screenshot, nullptr);
+
+    // the program's own arguments are left in order
+    ASSERT_EQ(argc, 2);
+    ASSERT_STREQ(argv[0], "hellorectangle");
+    ASSERT_STREQ(argv[1], "-f");
+    ASSERT_EQ(argv[2], nullptr);
+}
+
+TEST(UtilTests, null_context_test) {
+    std::filesystem::path screenshot =
+        std::filesystem::temp_directory_path() / "learn_opengl_util_test.ppm";
+    std::string path = screenshot.string();
+
+    util::ContextOptions options;
+    options.backend = util::Backend::NONE;
+    options.width = 4;
+    options.height = 2;
+    options.frames = 3;
+    options.screenshot = path.c_str();
+    {
+        util::Context context(options);
+        ASSERT_TRUE(context.valid());
+        ASSERT_TRUE(gl::null_backend_loaded());
+        ASSERT_EQ(context.window(), nullptr);
+        ASSERT_EQ(context.width(), 4);
+
+        int frames = 0;
+        while (!context.should_close()) {
+            glClear(GL_COLOR_BUFFER_BIT);
+            context.end_frame();
+            frames++;
+        }
+        ASSERT_EQ(frames, 3);
+        ASSERT_EQ(context.frame(), 3u);
+    }
+    ASSERT_FALSE(gl::null_backend_loaded());
+
+    std::ifstream in(screenshot, std::ios::binary);
+    std::string header;
+    std::getline(in, header);
+    ASSERT_EQ(header, "P6");
+    std::getline(in, header);
+    ASSERT_EQ(header, "4 2");
+    ASSERT_EQ(std::filesystem::file_size(screenshot), 11u + 4 * 2 * 3);
+    in.close();
+    std::filesystem::remove(screenshot);
+}
+
+TEST(UtilTests, loop_test) {
+    util::ContextOptions options;
+    options.backend = util::Backend::NONE;
+    options.frames = 4;
+    util::Context context(options);
+
+    // binary fractions so the accumulator is exact
+    util::LoopOptions loop;
+    loop.step = 0.25;
+    loop.frame_time = 0.625;
+
+    std::vector<double> times;
+    std::vector<double> alphas;
+    util::LoopStats stats = util::run_loop(
+        context,
+        [&](double time, double step) {
+            ASSERT_EQ(step, 0.25);
+            times.push_back(time);
+        },
+        [&](double alpha) { alphas.push_back(alpha); },
+        loop
+    );
+
+    ASSERT_EQ(stats.frames, 4u);
+    ASSERT_EQ(stats.steps, 10u);
+    ASSERT_EQ(stats.dropped, 0);
+    ASSERT_EQ(times.size(), 10u);
+    ASSERT_EQ(times.back(), 9 * 0.25);
+    ASSERT_EQ(alphas, (std::vector<double>{0.5, 0, 0.5, 0}));
+}
+
+TEST(UtilTests, loop_cap_test) {
+    util::ContextOptions options;
+    options.backend = util::Backend::NONE;
+    options.frames = 2;
+    util::Context context(options);
+
+    util::LoopOptions loop;
+    loop.step = 0.25;
+    loop.max_steps = 2;
+    loop.frame_time = 1.125;
+
+    std::vector<double> alphas;
+    util::LoopStats stats = util::run_loop(
+        context,
+        [](double, double) {},
+        [&](double alpha) { alphas.push_back(alpha); },
+        loop
+    );
+
+    // 4.5 steps in the first frame: 2 run, 2 dropped and the half kept.
+    // 5 in the second: 2 run and 3 dropped
+    ASSERT_EQ(stats.steps, 4u);
+    ASSERT_EQ(stats.dropped, 1.25);
+    ASSERT_EQ(alphas, (std::vector<double>{0.5, 0}));
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include "CompileRecords.hpp"
+#include "NullBackend.hpp"
+#include "WarmUp.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+    shaders::ProgramSources mesh_sources() {
+        shaders::ProgramSources sources;
+        sources.ok = true;
+        sources.vert.code =
+            "#version 330 core\n"
+            "layout (location = 0) in vec3 aPos;\n"
+            "layout (location = 1) in vec3 aNormal;\n"
+            "void main() {\n"
+            "    gl_Position = vec4(aPos + aNormal, 1.0);\n"
+            "}\n";
+        sources.frag.code =
+            "#version 330 core\n"
+            "out vec4 colour;\n"
+            "void main() {\n"
+            "    colour = vec4(1.0);\n"
+            "}\n";
+        return sources;
+    }
+
+    const std::vector<shaders::VertexFormat> FORMATS = {
+        {6 * sizeof(float), {{"aPos", 3}, {"aNormal", 3, GL_FLOAT, false, 3 * sizeof(float)}}},
+        // not in the shader
+        {3 * sizeof(float), {{"aTexCoords", 2}}},
+        {6 * sizeof(float), {{"aNormal", 3}, {"aPos", 3, GL_FLOAT, false, 3 * sizeof(float)}}},
+        // aPos is a vec3
+        {7 * sizeof(float), {{"aPos", 4}, {"aNormal", 3, GL_FLOAT, false, 4 * sizeof(float)}}},
+    };
+
+    /**
+     * @brief Bindings to compare before and after warm()
+     *
+     */
+    struct Bindings {
+        GLint draw_framebuffer = 0;
+        GLint read_framebuffer = 0;
+        GLint viewport[4] = {};
+        GLint program = 0;
+        GLint vertex_array = 0;
+    };
+
+    Bindings bindings() {
+        Bindings b;
+        glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &b.draw_framebuffer);
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &b.read_framebuffer);
+        glGetIntegerv(GL_VIEWPORT, b.viewport);
+        glGetIntegerv(GL_CURRENT_PROGRAM, &b.program);
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &b.vertex_array);
+        return b;
+    }
+
+    void expect_bindings(const Bindings& expected) {
+        Bindings b = bindings();
+        EXPECT_EQ(b.draw_framebuffer, expected.draw_framebuffer);
+        EXPECT_EQ(b.read_framebuffer, expected.read_framebuffer);
+        for (int i = 0; i < 4; i++) {
+            EXPECT_EQ(b.viewport[i], expected.viewport[i]);
+        }
+        EXPECT_EQ(b.program, expected.program);
+        EXPECT_EQ(b.vertex_array, expected.vertex_array);
+    }
+
+    /**
+     * @brief Bind something other than 0 everywhere warm() changes state
+     *
+     */
+    void bind_application_state(GLuint framebuffer, GLuint program, GLuint vertex_array) {
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glViewport(1, 2, 30, 40);
+        glUseProgram(program);
+        glBindVertexArray(vertex_array);
+    }
+} // namespace
+
+TEST(WarmUpTests, warm_test) {
+    gl::load_null_backend();
+    {
+        GLuint framebuffer, vertex_array;
+        glGenFramebuffers(1, &framebuffer);
+        glGenVertexArrays(1, &vertex_array);
+        shaders::Shader other(mesh_sources());
+        shaders::Shader shader(mesh_sources());
+        ASSERT_NE(shader.build_record(), nullptr);
+        ASSERT_FALSE(shader.build_record()->warmed);
+
+        shaders::WarmUp warm_up;
+        bind_application_state(framebuffer, other.id, vertex_array);
+        Bindings before = bindings();
+        std::uint64_t draws = gl::null_backend_stats().draws;
+
+        // one draw per format the shader can take, the others are skipped
+        std::chrono::nanoseconds elapsed = warm_up.warm(shader, FORMATS);
+        ASSERT_EQ(gl::null_backend_stats().draws - draws, 2u);
+        ASSERT_EQ(warm_up.stats().draws, 2u);
+        ASSERT_EQ(warm_up.stats().programs, 1u);
+        expect_bindings(before);
+
+        const shaders::ProgramRecord* record = shader.build_record();
+        ASSERT_TRUE(record->warmed);
+        ASSERT_EQ(record->warm_up, elapsed);
+        ASSERT_FALSE(other.build_record()->warmed);
+
+        // no formats is one draw with every attribute disabled
+        warm_up.warm(shader);
+        ASSERT_EQ(gl::null_backend_stats().draws - draws, 3u);
+        expect_bindings(before);
+
+        glDeleteProgram(shader.id);
+        glDeleteProgram(other.id);
+        glDeleteVertexArrays(1, &vertex_array);
+        glDeleteFramebuffers(1, &framebuffer);
+    }
+    gl::unload_null_backend();
+}
+
+TEST(WarmUpTests, warm_pipeline_test) {
+    gl::load_null_backend();
+    {
+        shaders::ProgramSources sources = mesh_sources();
+        shaders::PipelineCache cache;
+        std::size_t vert = cache.add_stage_source(GL_VERTEX_SHADER, sources.vert.code, "vert");
+        std::size_t frag = cache.add_stage_source(GL_FRAGMENT_SHADER, sources.frag.code, "frag");
+
+        GLuint framebuffer, vertex_array;
+        glGenFramebuffers(1, &framebuffer);
+        glGenVertexArrays(1, &vertex_array);
+        shaders::Shader other(mesh_sources());
+
+        shaders::WarmUp warm_up;
+        bind_application_state(framebuffer, other.id, vertex_array);
+        Bindings before = bindings();
+        std::uint64_t draws = gl::null_backend_stats().draws;
+
+        std::chrono::nanoseconds elapsed = warm_up.warm(cache, vert, frag, FORMATS);
+        ASSERT_EQ(gl::null_backend_stats().draws - draws, 2u);
+        expect_bindings(before);
+
+        // both stages are charged
+        for (std::size_t index : {vert, frag}) {
+            const shaders::ProgramRecord* record = cache.stage(index).build_record();
+            ASSERT_NE(record, nullptr);
+            ASSERT_TRUE(record->warmed);
+            ASSERT_EQ(record->warm_up, elapsed);
+        }
+
+        glDeleteProgram(other.id);
+        glDeleteVertexArrays(1, &vertex_array);
+        glDeleteFramebuffers(1, &framebuffer);
+    }
+    gl::unload_null_backend();
+}